@@ -0,0 +1,14 @@
+#pragma once
+#include <metal_stdlib>
+using namespace metal;
+
+struct VSOut {
+    float4 position [[position]];
+    float3 worldPos;
+    float2 uv;
+    float3 normal;
+    float3 worldTangent;
+    float3 worldBitangent;
+    float3 worldNormal;
+    float3 viewNormal;
+};
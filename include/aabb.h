@@ -41,6 +41,21 @@ int aabb_draw ( render_pass *p_render_pass, pipeline *p_pipeline, aabb *p_aabb )
  */
 int aabb_from_bounds ( aabb *p_aabb, vec3 min, vec3 max );
 
+/// transform
+/** 
+ * Compute the axis aligned bounding box of a transformed aabb; Store 
+ * result. The centre is transformed, and the half extents are transformed 
+ * by the absolute value of the upper 3x3, so no corners are expanded. The
+ * result may be the input.
+ * 
+ * @param p_result return
+ * @param p_aabb   the aabb
+ * @param m        affine matrix
+ * 
+ * @return 1 on success, 0 on error
+ */
+int aabb_transform ( aabb *p_result, const aabb *p_aabb, mat4 m );
+
 /// print
 /** 
  *  Print a textual representation of an aabb to standard output
@@ -102,4 +117,90 @@ int aabb_contains ( const aabb *p_aabb, vec3 point );
  *
  * @return 1 if outside (cull), 0 if inside/intersecting (keep)
  */
-int aabb_cull_frustum ( const aabb *p_aabb, const vec4 planes[6] );
\ No newline at end of file
+int aabb_cull_frustum ( const aabb *p_aabb, const vec4 planes[6] );
+
+/**
+ * Test if an aabb is outside a frustum, using only the planes that a parent
+ * volume did not already pass
+ *
+ * @param p_aabb the aabb
+ * @param planes the 6 frustum planes
+ * @param p_mask in: the planes to test, one bit per plane
+ *               out: the planes the aabb is not fully inside of
+ * @param p_hint in: the plane to test first
+ *               out: the plane that culled the aabb, if any
+ * @param p_tested the quantity of planes tested is added to this, or null
+ *
+ * @return 1 if outside (cull), 0 if inside/intersecting (keep)
+ */
+int aabb_cull_frustum_masked ( const aabb *p_aabb, const vec4 planes[6], u8 *p_mask, u8 *p_hint, size_t *p_tested );
+
+/// structure of arrays
+/** 
+ * Store an aabb in a structure of arrays, as a centre and half extents
+ * 
+ * @param soa    the structure of arrays
+ * @param index  the index to store at
+ * @param p_aabb the aabb
+ * 
+ * @return 1 on success, 0 on error
+ */
+int aabb_soa_set ( aabb_soa soa, size_t index, const aabb *p_aabb );
+
+/** 
+ * Load an aabb from a structure of arrays
+ * 
+ * @param p_aabb return
+ * @param soa    the structure of arrays
+ * @param index  the index to load from
+ * 
+ * @return 1 on success, 0 on error
+ */
+int aabb_soa_get ( aabb *p_aabb, aabb_soa soa, size_t index );
+
+/// batches
+/**
+ * Transform each aabb by its own affine matrix; Store results. The result 
+ * may be the input. scene_refit moves the bounds of every moved entity
+ * with one call.
+ *
+ * @param p_result return
+ * @param p_m      the matrices, one per aabb
+ * @param boxes    the aabbs
+ * @param count    the quantity of aabbs
+ *
+ * @sa aabb_transform
+ *
+ * @return void
+ */
+u0 aabb_transform_batch ( aabb_soa *p_result, const mat4 *p_m, aabb_soa boxes, size_t count );
+
+/**
+ * Test each aabb against a frustum. The scene culls through its hierarchy
+ * instead, so this serves flat lists, and the benchmarks.
+ *
+ * @param p_result return. 1 if the i'th aabb is outside (cull), 0 otherwise
+ * @param planes   the 6 frustum planes
+ * @param boxes    the aabbs
+ * @param count    the quantity of aabbs
+ *
+ * @sa aabb_cull_frustum
+ *
+ * @return the quantity of aabbs outside the frustum
+ */
+size_t aabb_cull_frustum_batch ( u8 *p_result, const vec4 planes[6], aabb_soa boxes, size_t count );
+
+/**
+ * Test each aabb for intersection with one aabb. Nothing in the engine 
+ * queries overlap yet; the benchmarks measure it.
+ *
+ * @param p_result return. 1 if the i'th aabb intersects, 0 otherwise
+ * @param p_aabb   the aabb
+ * @param boxes    the aabbs
+ * @param count    the quantity of aabbs
+ *
+ * @sa aabb_intersect
+ *
+ * @return the quantity of aabbs that intersect
+ */
+size_t aabb_overlap_batch ( u8 *p_result, const aabb *p_aabb, aabb_soa boxes, size_t count );
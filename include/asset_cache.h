@@ -0,0 +1,176 @@
+/** !
+ * Reference counted asset cache, keyed by path and content hash
+ *
+ * @file g10/asset_cache.h
+ *
+ * @author Jacob Smith
+ */
+
+// header guard
+#pragma once
+
+// standard library
+#include <stdio.h>
+#include <string.h>
+
+// gsdk
+/// core
+#include <core/log.h>
+#include <core/interfaces.h>
+
+/// data
+#include <data/dict.h>
+
+// g10
+#include <gtypedef.h>
+
+// function pointers
+/** !
+ * Construct an asset from the contents of a file
+ *
+ * @param pp_asset return
+ * @param p_path   the path the contents were loaded from
+ * @param p_data   the contents of the file, mapped read only. not null 
+ *                 terminated, and only valid for the duration of the call
+ * @param size     the size of the contents
+ *
+ * @return 1 on success, 0 on error
+ */
+typedef int (fn_asset_load)( void **pp_asset, const char *p_path, const void *p_data, size_t size );
+
+/** !
+ * Release an asset that is no longer referenced
+ *
+ * @param p_asset the asset
+ *
+ * @return 1 on success, 0 on error
+ */
+typedef int (fn_asset_release)( void *p_asset );
+
+// structure definitions
+struct asset_s
+{
+    char   _hash[16+1],
+           _value[16+1]; // the address of the value, as text, while it is loaded
+    u64    hash;
+    void  *p_value;
+    size_t size,
+           references;
+};
+
+struct asset_path_s
+{
+    char   _path[255+1];
+    asset *p_asset;
+};
+
+struct asset_cache_s
+{
+    char              _name[63+1];
+    dict             *p_paths,
+                     *p_hashes,
+                     *p_values;
+    fn_asset_load    *pfn_load;
+    fn_asset_release *pfn_release;
+
+    // metrics
+    struct
+    {
+        size_t path_hits,
+               hash_hits,
+               loads,
+               releases,
+               bytes;
+    } metrics;
+};
+
+// function declarations
+/// constructors
+/** !
+ * Construct an asset cache
+ *
+ * @param pp_asset_cache return
+ * @param _name          the name of the cache, for logging
+ * @param size           the expected quantity of unique assets
+ * @param pfn_load       constructs an asset from file contents
+ * @param pfn_release    releases an asset, or NULL to keep assets resident
+ *
+ * @return 1 on success, 0 on error
+ */
+int asset_cache_construct ( asset_cache **pp_asset_cache, const char *_name, size_t size, fn_asset_load *pfn_load, fn_asset_release *pfn_release );
+
+/// hash
+/** !
+ * Compute the 64-bit FNV-1a hash of a block of memory
+ *
+ * @param p_data the memory
+ * @param size   the size of the memory in bytes
+ *
+ * @return the hash
+ */
+u64 asset_hash ( const void *p_data, size_t size );
+
+/// acquire
+/** !
+ * Get an asset from a path, loading it on first use. A path that was seen
+ * before is returned without touching the disk. A new path is mapped, not
+ * read, and if its contents match a loaded asset it shares that asset. 
+ * Each successful call must be balanced by a call to asset_cache_release.
+ *
+ * @param p_asset_cache the asset cache
+ * @param p_path        path to the asset
+ * @param pp_value      return
+ *
+ * @return 1 on success, 0 on error
+ */
+int asset_cache_acquire ( asset_cache *p_asset_cache, const char *p_path, void **pp_value );
+
+/// release
+/** !
+ * Drop a reference to an asset. The asset is released when its last
+ * reference is dropped.
+ *
+ * @param p_asset_cache the asset cache
+ * @param p_value       an asset returned by asset_cache_acquire
+ *
+ * @return 1 on success, 0 if the asset is not in the cache
+ */
+int asset_cache_release ( asset_cache *p_asset_cache, void *p_value );
+
+/// info
+/** !
+ * Print a textual representation of an asset cache to standard output
+ *
+ * @param p_asset_cache the asset cache
+ *
+ * @return 1 on success, 0 on error
+ */
+int asset_cache_info ( asset_cache *p_asset_cache );
+
+/// key accessors
+/** !
+ * Get the content hash of an asset
+ *
+ * @param p_asset the asset
+ *
+ * @return the content hash, as text
+ */
+const char *asset_key_accessor ( const asset *const p_asset );
+
+/** !
+ * Get the address of the value of a loaded asset
+ *
+ * @param p_asset the asset
+ *
+ * @return the address of the value, as text
+ */
+const char *asset_value_key_accessor ( const asset *const p_asset );
+
+/** !
+ * Get the path of an asset path
+ *
+ * @param p_asset_path the asset path
+ *
+ * @return the path
+ */
+const char *asset_path_key_accessor ( const asset_path *const p_asset_path );
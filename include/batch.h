@@ -0,0 +1,88 @@
+/** !
+ * Instanced draw batches
+ *
+ * @file g10/batch.h
+ *
+ * @author Jacob Smith
+ */
+
+// header guard
+#pragma once
+
+// standard library
+#include <stdio.h>
+
+// gsdk
+/// core
+#include <core/log.h>
+#include <core/interfaces.h>
+
+// g10
+#include <gtypedef.h>
+#include <linear.h>
+#include <draw_list.h>
+
+// structure definitions
+struct batch_instance_s
+{
+    mat4 model,
+         inv_normal;
+};
+
+struct batch_s
+{
+
+    // the first entity of the batch, whose geometry and material every
+    // instance shares
+    entity *p_entity;
+
+    // the range of the batch in the instance array
+    u32 first,
+        count;
+};
+
+struct batch_list_s
+{
+    batch          *p_batches;
+    batch_instance *p_instances;
+    size_t          batch_count,
+                    batch_max,
+                    instance_count,
+                    instance_max;
+};
+
+// function declarations
+/// constructors
+/** !
+ * Construct a batch list
+ *
+ * @param pp_batch_list return
+ * @param max           the initial quantity of instances
+ *
+ * @return 1 on success, 0 on error
+ */
+int batch_list_construct ( batch_list **pp_batch_list, size_t max );
+
+/// build
+/** !
+ * Group a draw list of entities into batches. Consecutive entities that 
+ * share a geometry and material are one batch, so a draw list sorted by 
+ * state gives the fewest batches. The world and normal matrix of each 
+ * entity is written to the instance array, in draw list order.
+ *
+ * @param p_batch_list the batch list
+ * @param p_draw_list  a draw list of entities
+ *
+ * @return 1 on success, 0 on error
+ */
+int batch_list_build ( batch_list *p_batch_list, draw_list *p_draw_list );
+
+/// destructors
+/** !
+ * Release a batch list
+ *
+ * @param pp_batch_list pointer to batch list pointer
+ *
+ * @return 1 on success, 0 on error
+ */
+int batch_list_destroy ( batch_list **pp_batch_list );
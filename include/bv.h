@@ -24,10 +24,22 @@ typedef int (fn_bv_intersect)( bv *p_a, bv *p_b );
 typedef int (fn_bv_contains)( bv *p_bv, vec3 point );
 typedef int (fn_bv_cull)( bv *p_bv, const vec4 planes[6] );
 
+// enumeration definitions
+enum bv_build_e
+{
+    BV_BUILD_SAH,
+    BV_BUILD_LBVH,
+    BV_BUILD_QTY
+};
+
 // structure definitions
 struct bv_s
 {
     void         *p_data[4];
+    vec3          _min, _max;
+    float         _area;
+    bool          _dirty;
+    u8            _plane;
     struct bv_s  *p_parent;
     void         *p_user_data;
     fn_bv_bind   *pfn_bind;
@@ -53,12 +65,76 @@ int bv_cull ( bv *p_bv, const vec4 planes[6] );
 int bv_cull_pipeline ( render_pass *p_render_pass, pipeline *p_pipeline, bv *p_bv );
 
 /// constructors
+/** !
+ * Construct a bounding volume hierarchy from a scene's entities
+ * 
+ * @param pp_bv   return
+ * @param p_scene the scene
+ * 
+ * @return 1 on success, 0 on error
+ */
 int bv_from_scene ( bv **pp_bv, scene *p_scene );
+
+/** !
+ * Construct a 4-ary bounding volume hierarchy over a set of leaf volumes
+ * 
+ * @param pp_bv     return
+ * @param pp_leaves the leaf volumes
+ * @param count     the quantity of leaf volumes
+ * @param build     BV_BUILD_SAH for a binned surface area heuristic build,
+ *                  BV_BUILD_LBVH for a fast morton code build
+ * 
+ * @return 1 on success, 0 on error
+ */
+int bv_from_leaves ( bv **pp_bv, bv **pp_leaves, size_t count, enum bv_build_e build );
+
 int bv_from_entity ( bv **pp_bv, entity *p_entity );
 int bv_from_aabb ( bv **pp_bv, aabb *p_aabb );
 
 // resize
+/** !
+ * Recompute the bounds of an entity leaf from its geometry and transform
+ * 
+ * @param p_bv the leaf
+ * 
+ * @return 1 on success, 0 on error
+ */
 fn_bv_resize bv_entity_resize;
 
+/** !
+ * Recompute the bounds of a leaf
+ * 
+ * @param p_bv the leaf
+ * 
+ * @return 1 on success, 0 on error
+ */
+int bv_resize ( bv *p_bv );
+
+/// refit
+/** !
+ * Propagate a leaf's bounds to its ancestors. The walk stops at the first
+ * ancestor whose bounds did not change. 
+ * 
+ * @param p_leaf      the leaf whose bounds changed
+ * @param limit       the ratio of refit to built surface area past which an
+ *                    ancestor is considered degraded
+ * @param pp_degraded return the highest degraded ancestor, or null 
+ * 
+ * @return 1 on success, 0 on error
+ */
+int bv_refit ( bv *p_leaf, float limit, bv **pp_degraded );
+
+/** !
+ * Rebuild the subtree under an interior node in place. The leaves are kept, 
+ * and the interior nodes are replaced.
+ * 
+ * @param pp_root the root of the hierarchy, updated if p_node is the root
+ * @param p_node  the root of the subtree
+ * @param build   the build strategy
+ * 
+ * @return 1 on success, 0 on error
+ */
+int bv_rebuild ( bv **pp_root, bv *p_node, enum bv_build_e build );
+
 /// destructors
 int bv_destroy ( bv **pp_bv );
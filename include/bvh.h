@@ -0,0 +1,161 @@
+/** !
+ * Compiled, read only bounding volume hierarchy
+ *
+ * @file g10/bvh.h
+ *
+ * @author Jacob Smith
+ */
+
+// header guard
+#pragma once
+
+// standard library
+#include <stdio.h>
+#include <float.h>
+
+// gsdk
+/// core
+#include <core/log.h>
+#include <core/interfaces.h>
+
+// g10
+#include <gtypedef.h>
+#include <bv.h>
+
+// preprocessor definitions
+#define BVH_STACK_MAX  256
+#define BVH_EMPTY      ( (s32) 0x7fffffff )
+#define BVH_PLANES_ALL 0x3F
+#define BVH_TASKS_MAX  256
+
+// function pointers
+typedef void (fn_bvh_visit)( bv *p_leaf, void *p_context );
+
+// structure definitions
+struct bvh_node_s
+{
+
+    // bounds of each child, one lane per child
+    _Alignas(16) float min_x[4];
+    _Alignas(16) float min_y[4];
+    _Alignas(16) float min_z[4];
+    _Alignas(16) float max_x[4];
+    _Alignas(16) float max_y[4];
+    _Alignas(16) float max_z[4];
+
+    // >= 0 -> node index, < 0 -> ~leaf index, BVH_EMPTY -> unused
+    s32 child[4];
+
+    // the plane that culled a child last frame, tested first next frame
+    u8 plane;
+};
+
+typedef struct bvh_node_s bvh_node;
+
+struct bvh_s
+{
+    bvh_node *p_nodes;
+    bv      **pp_leaves;
+    size_t    node_count,
+              leaf_count,
+              depth;
+
+    // metrics for the last cull
+    bvh_cull_stats cull;
+};
+
+// function declarations
+/// constructors
+/** !
+ * Compile a pointer based bounding volume hierarchy into a flat array of
+ * 4-wide nodes. The source hierarchy is not modified, and remains the
+ * editable representation.
+ *
+ * @param pp_bvh return
+ * @param p_bv   the root of the source hierarchy
+ *
+ * @return 1 on success, 0 on error
+ */
+int bvh_from_bv ( bvh **pp_bvh, bv *p_bv );
+
+/// cull
+/** !
+ * Visit every leaf of a compiled hierarchy that is inside or intersecting
+ * a frustum. Each node classifies all four children in one test. Planes 
+ * that a node is fully inside of are not tested again in its subtree, and
+ * a subtree fully inside the frustum is visited without further tests.
+ *
+ * @param p_bvh     the compiled hierarchy
+ * @param planes    the 6 frustum planes
+ * @param pfn_visit called once for each visible leaf
+ * @param p_context passed through to pfn_visit
+ *
+ * @return the quantity of visible leaves
+ */
+size_t bvh_cull ( bvh *p_bvh, const vec4 planes[6], fn_bvh_visit *pfn_visit, void *p_context );
+
+/** !
+ * Cull the top of a compiled hierarchy breadth first, until it is split 
+ * into as many subtrees as fit in max. Leaves reached on the way are 
+ * visited here. The subtrees are disjoint and in a fixed order, so they 
+ * can be culled on any thread with bvh_cull_task, and their results 
+ * merged in order, for the same result as a serial cull.
+ *
+ * @param p_bvh     the compiled hierarchy
+ * @param planes    the 6 frustum planes
+ * @param p_tasks   return the subtrees
+ * @param max       the quantity of subtrees to split into, at most BVH_TASKS_MAX
+ * @param pfn_visit called once for each visible leaf above the subtrees
+ * @param p_context passed through to pfn_visit
+ * @param p_stats   the metrics of the split are added to this
+ *
+ * @return the quantity of subtrees
+ */
+size_t bvh_cull_split ( bvh *p_bvh, const vec4 planes[6], bvh_task *p_tasks, size_t max, fn_bvh_visit *pfn_visit, void *p_context, bvh_cull_stats *p_stats );
+
+/** !
+ * Visit every leaf of a subtree from bvh_cull_split that is inside or 
+ * intersecting a frustum. Distinct subtrees may be culled concurrently.
+ *
+ * @param p_bvh     the compiled hierarchy
+ * @param planes    the 6 frustum planes
+ * @param task      the subtree
+ * @param pfn_visit called once for each visible leaf
+ * @param p_context passed through to pfn_visit
+ * @param p_stats   the metrics of the cull are added to this
+ *
+ * @return the quantity of visible leaves
+ */
+size_t bvh_cull_task ( bvh *p_bvh, const vec4 planes[6], bvh_task task, fn_bvh_visit *pfn_visit, void *p_context, bvh_cull_stats *p_stats );
+
+/// refit
+/** !
+ * Refresh the bounds of a compiled hierarchy from the bounds of its leaves. 
+ * The topology is unchanged, so this is only valid after a refit of the 
+ * source hierarchy, not after a rebuild.
+ *
+ * @param p_bvh the compiled hierarchy
+ *
+ * @return 1 on success, 0 on error
+ */
+int bvh_refit ( bvh *p_bvh );
+
+/// info
+/** !
+ * Print a textual representation of a compiled hierarchy to standard output
+ *
+ * @param p_bvh the compiled hierarchy
+ *
+ * @return 1 on success, 0 on error
+ */
+int bvh_info ( bvh *p_bvh );
+
+/// destructors
+/** !
+ * Release a compiled hierarchy. The source hierarchy is not released.
+ *
+ * @param pp_bvh pointer to compiled hierarchy pointer
+ *
+ * @return 1 on success, 0 on error
+ */
+int bvh_destroy ( bvh **pp_bvh );
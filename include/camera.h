@@ -33,6 +33,12 @@ struct camera_s
     {
         vec3 location, target, up;
     } view;
+
+    // the view as of the previous simulation tick
+    struct
+    {
+        vec3 location, target;
+    } previous;
     
     struct
     {
@@ -144,6 +150,27 @@ u0 camera_matrix_view ( mat4 *p_view, vec3 eye, vec3 target, vec3 up );
  */
 u0 camera_matrix_projection_perspective ( mat4 *p_projection, float fov, float aspect, float near_clip, float far_clip );
 
+/// interpolation
+/** !
+ * Start a simulation tick. The current view becomes the previous view.
+ *
+ * @param p_camera the camera
+ *
+ * @return 1 on success, 0 on error
+ */
+int camera_tick ( camera *p_camera );
+
+/** !
+ * Compute the view matrix and frustum planes from a blend of the previous
+ * and current views. The view itself is not changed.
+ *
+ * @param p_camera the camera
+ * @param alpha    0 for the previous tick, 1 for the current tick
+ *
+ * @return 1 on success, 0 on error
+ */
+int camera_interpolate ( camera *p_camera, float alpha );
+
 /// info
 /** !
  *  Print information about a camera
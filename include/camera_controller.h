@@ -23,8 +23,9 @@
 /** !
  * Update the camera 
  * 
- * @param p_camera the camera
+ * @param p_camera   the camera
+ * @param delta_time the seconds to simulate
  * 
  * @return 1 on success, 0 on error
  */
-int camera_controller_first_person_update ( camera *p_camera );
+int camera_controller_first_person_update ( camera *p_camera, float delta_time );
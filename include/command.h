@@ -0,0 +1,186 @@
+/** !
+ * Backend neutral draw commands, recorded into a counting sink
+ *
+ * @file g10/command.h
+ *
+ * @author Jacob Smith
+ */
+
+// header guard
+#pragma once
+
+// standard library
+#include <stdio.h>
+#include <string.h>
+
+// gsdk
+/// core
+#include <core/log.h>
+#include <core/interfaces.h>
+
+// g10
+#include <gtypedef.h>
+
+// enumeration definitions
+enum g_backend_e
+{
+    G10_BACKEND_SDL3,
+    G10_BACKEND_NULL,
+    G10_BACKEND_QTY
+};
+
+// structure definitions
+struct command_sink_s
+{
+    size_t frames,
+           render_passes,
+           pipeline_binds,
+           uniform_pushes,
+           uniform_bytes,
+           vertex_buffer_binds,
+           index_buffer_binds,
+           storage_buffer_binds,
+           sampler_binds,
+           draws,
+           indexed_draws,
+           instances,
+           primitives,
+           uploads,
+           upload_bytes;
+};
+
+// data
+/** !
+ * Stands in for gpu handles under the null backend, so the cpu side takes
+ * the same branches it would on a device. Never dereferenced.
+ */
+extern u8 g_null_handle;
+
+#define G10_NULL_HANDLE ( (void *) &g_null_handle )
+
+// function declarations
+/// backend
+/** !
+ * Get a backend from its name
+ *
+ * @param p_name "sdl3" or "null"
+ *
+ * @return the backend on success, G10_BACKEND_QTY on error
+ */
+enum g_backend_e command_backend_from_string ( const char *p_name );
+
+/** !
+ * Get the name of a backend
+ *
+ * @param backend the backend
+ *
+ * @return the name
+ */
+const char *command_backend_name ( enum g_backend_e backend );
+
+/// commands
+/** !
+ * Push uniform data to the vertex and fragment stages
+ *
+ * @param slot   the uniform slot
+ * @param p_data the packed uniform data
+ * @param size   the size of the data in bytes
+ *
+ * @return 1 on success, 0 on error
+ */
+int command_push_uniform ( u32 slot, const void *p_data, size_t size );
+
+/** !
+ * Bind a graphics pipeline
+ *
+ * @param p_render_pass the render pass
+ * @param p_handle      the pipeline handle
+ *
+ * @return 1 on success, 0 on error
+ */
+int command_bind_pipeline ( render_pass *p_render_pass, void *p_handle );
+
+/** !
+ * Bind vertex buffers, starting at slot 0
+ *
+ * @param p_render_pass the render pass
+ * @param pp_handles    the buffer handles
+ * @param count         the quantity of buffers
+ *
+ * @return 1 on success, 0 on error
+ */
+int command_bind_vertex_buffers ( render_pass *p_render_pass, void *const *pp_handles, size_t count );
+
+/** !
+ * Bind a 32-bit index buffer
+ *
+ * @param p_render_pass the render pass
+ * @param p_handle      the buffer handle
+ *
+ * @return 1 on success, 0 on error
+ */
+int command_bind_index_buffer ( render_pass *p_render_pass, void *p_handle );
+
+/** !
+ * Bind a storage buffer to the vertex stage
+ *
+ * @param p_render_pass the render pass
+ * @param slot          the storage buffer slot
+ * @param p_handle      the buffer handle
+ *
+ * @return 1 on success, 0 on error
+ */
+int command_bind_storage_buffer ( render_pass *p_render_pass, u32 slot, void *p_handle );
+
+/** !
+ * Bind a texture and sampler to the fragment stage
+ *
+ * @param p_render_pass the render pass
+ * @param slot          the sampler slot
+ * @param p_texture     the texture handle
+ * @param p_sampler     the sampler handle
+ *
+ * @return 1 on success, 0 on error
+ */
+int command_bind_sampler ( render_pass *p_render_pass, u32 slot, void *p_texture, void *p_sampler );
+
+/** !
+ * Draw non indexed primitives
+ *
+ * @param p_render_pass  the render pass
+ * @param vertex_count   the quantity of vertices
+ * @param instance_count the quantity of instances
+ *
+ * @return 1 on success, 0 on error
+ */
+int command_draw ( render_pass *p_render_pass, u32 vertex_count, u32 instance_count );
+
+/** !
+ * Draw indexed primitives, from the bound index buffer
+ *
+ * @param p_render_pass  the render pass
+ * @param index_count    the quantity of indices
+ * @param instance_count the quantity of instances
+ *
+ * @return 1 on success, 0 on error
+ */
+int command_draw_indexed ( render_pass *p_render_pass, u32 index_count, u32 instance_count );
+
+/// sink
+/** !
+ * Zero a command sink
+ *
+ * @param p_command_sink the command sink
+ *
+ * @return 1 on success, 0 on error
+ */
+int command_sink_reset ( command_sink *p_command_sink );
+
+/** !
+ * Print a textual representation of a command sink to standard output
+ *
+ * @param p_command_sink the command sink
+ *
+ * @return 1 on success, 0 on error
+ */
+int command_sink_info ( command_sink *p_command_sink );
@@ -0,0 +1,148 @@
+/** !
+ * Frame linear draw lists
+ *
+ * @file g10/draw_list.h
+ *
+ * @author Jacob Smith
+ */
+
+// header guard
+#pragma once
+
+// standard library
+#include <stdio.h>
+
+// gsdk
+/// core
+#include <core/log.h>
+#include <core/interfaces.h>
+
+// g10
+#include <gtypedef.h>
+
+// preprocessor definitions
+#define DRAW_KEY_DEPTH_BITS 24
+
+// enumeration definitions
+enum draw_sort_e
+{
+    DRAW_SORT_NONE,
+    DRAW_SORT_OPAQUE,
+    DRAW_SORT_TRANSPARENT,
+    DRAW_SORT_QTY
+};
+
+// structure definitions
+struct draw_packet_s
+{
+    u64   key;
+    void *p_drawable;
+};
+
+struct draw_list_s
+{
+    draw_packet *p_packets,
+                *p_scratch;
+    size_t       count,
+                 max;
+};
+
+// function declarations
+/// constructors
+/** !
+ * Construct a draw list
+ *
+ * @param pp_draw_list return
+ * @param max          the initial quantity of packets
+ *
+ * @return 1 on success, 0 on error
+ */
+int draw_list_construct ( draw_list **pp_draw_list, size_t max );
+
+/// keys
+/** !
+ * Pack a sort key for a drawable.
+ * 
+ * DRAW_SORT_OPAQUE sorts by state, then front to back
+ *     [ pipeline : 8 ][ material : 16 ][ geometry : 16 ][ depth : 24 ]
+ * 
+ * DRAW_SORT_TRANSPARENT sorts back to front, then by state
+ *     [ ~depth : 24 ][ pipeline : 8 ][ material : 16 ][ geometry : 16 ]
+ * 
+ * State is folded from the pointers, so equal state sorts together. A 
+ * collision only costs a redundant bind.
+ *
+ * @param sort       the sort mode
+ * @param p_pipeline the pipeline
+ * @param p_material the material, or null
+ * @param p_geometry the geometry, or null
+ * @param depth      the view depth, normalized to [0, 1]
+ *
+ * @return the key
+ */
+u64 draw_key ( enum draw_sort_e sort, const void *p_pipeline, const void *p_material, const void *p_geometry, float depth );
+
+/// mutators
+/** !
+ * Append a drawable to a draw list. A full list doubles in size. Not safe
+ * to call while other threads are appending.
+ *
+ * @param p_draw_list the draw list
+ * @param p_drawable  the drawable
+ * @param key         the sort key
+ *
+ * @return 1 on success, 0 on error
+ */
+int draw_list_add ( draw_list *p_draw_list, void *p_drawable, u64 key );
+
+/** !
+ * Sort a draw list by key, with a stable least significant digit radix sort.
+ * Digits that every key shares are skipped. Not safe to call while other 
+ * threads are appending.
+ *
+ * @param p_draw_list the draw list
+ *
+ * @return 1 on success, 0 on error
+ */
+int draw_list_sort ( draw_list *p_draw_list );
+
+/** !
+ * Grow a draw list to hold at least max packets. Not safe to call while
+ * other threads are appending.
+ *
+ * @param p_draw_list the draw list
+ * @param max         the quantity of packets
+ *
+ * @return 1 on success, 0 on error
+ */
+int draw_list_reserve ( draw_list *p_draw_list, size_t max );
+
+/** !
+ * Empty a draw list in constant time. The packets are kept for the next
+ * frame
+ *
+ * @param p_draw_list the draw list
+ *
+ * @return 1 on success, 0 on error
+ */
+int draw_list_reset ( draw_list *p_draw_list );
+
+/// accessors
+/** !
+ * Get the quantity of packets in a draw list
+ *
+ * @param p_draw_list the draw list
+ *
+ * @return the quantity of packets
+ */
+size_t draw_list_size ( draw_list *p_draw_list );
+
+/// destructors
+/** !
+ * Release a draw list
+ *
+ * @param pp_draw_list pointer to draw list pointer
+ *
+ * @return 1 on success, 0 on error
+ */
+int draw_list_destroy ( draw_list **pp_draw_list );
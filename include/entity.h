@@ -22,6 +22,7 @@
 #include <render_pass.h>
 #include <sampler.h>
 #include <material.h>
+#include <batch.h>
 
 // structure definitions
 struct entity_s
@@ -32,7 +33,14 @@ struct entity_s
     material *p_material;
     bv *p_bounds;
     mat3 _inv_normal;
-    char *pipeline;
+    char _pipeline_name[63+1];
+    pipeline_handle _pipeline;
+
+    // the transform version each cache was built from
+    struct
+    {
+        u64 inv_normal, bounds;
+    } _version;
 };
 
 // function declarations
@@ -66,4 +74,39 @@ int entity_bind ( render_pass *p_render_pass, pipeline *p_pipeline, entity *p_en
 
 int entity_cull ( render_pass *p_render_pass, pipeline *p_pipeline, entity *p_entity );
 
-int entity_draw ( render_pass *p_render_pass, pipeline *p_pipeline, entity *p_entity );
\ No newline at end of file
+int entity_draw ( render_pass *p_render_pass, pipeline *p_pipeline, entity *p_entity );
+
+/// instancing
+/** !
+ * Bind the instance range, material and geometry of a batch of entities
+ * 
+ * @param p_render_pass the render pass
+ * @param p_pipeline    an instanced pipeline
+ * @param p_batch       the batch
+ * 
+ * @return 1 on success, 0 on error
+ */
+int entity_bind_batch ( render_pass *p_render_pass, pipeline *p_pipeline, batch *p_batch );
+
+/** !
+ * Draw every instance of a batch of entities with one call
+ * 
+ * @param p_render_pass the render pass
+ * @param p_pipeline    an instanced pipeline
+ * @param p_batch       the batch
+ * 
+ * @return 1 on success, 0 on error
+ */
+int entity_draw_batch ( render_pass *p_render_pass, pipeline *p_pipeline, batch *p_batch );
+
+/// destructors
+/** !
+ * Release an entity. Shared geometry and materials are dropped from their
+ * asset caches, and inline geometry is released. Remove the entity from
+ * its scene first.
+ * 
+ * @param pp_entity pointer to entity pointer
+ * 
+ * @return 1 on success, 0 on error
+ */
+int entity_destroy ( entity **pp_entity );
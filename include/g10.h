@@ -24,6 +24,7 @@
 #include <camera.h>
 #include <skybox.h>
 #include <scene.h>
+#include <command.h>
 
 #define G10_BUILD_WITH_SDL3
 
@@ -41,8 +42,14 @@ struct g_instance_s
     // running?
     bool running; 
 
+    // backend
+    enum g_backend_e backend;
+
+    // every command recorded by the renderer, on any backend
+    command_sink commands;
+
     // schedule
-    // schedule *p_schedule;
+    schedule *p_schedule;
 
     // context
     struct
@@ -51,7 +58,11 @@ struct g_instance_s
         renderer *p_renderer;
         scene *p_scene;
         input *p_input;
-        u16 fixed_tick_rate;
+        u16 fixed_tick_rate; // ticks per second, or 0 for one tick per frame
+
+        // the seconds the running system simulates, and how far the frame
+        // is from the previous tick to the current tick
+        f32 delta_time, interpolation;
     } context;
 
     // graphics
@@ -127,6 +138,11 @@ struct g_instance_s
               *p_attachment,
               *p_texture,
               *p_geometry;
+
+        // reference counted, keyed by path and content hash
+        asset_cache *p_geometry_files,
+                    *p_material_files,
+                    *p_texture_files;
     } cache;
     
     // time
@@ -173,6 +189,26 @@ int program_pipeline ( const char _name[], fn_pipeline_bind_once *pfn_once, fn_p
  */
 size_t load_file ( const char *path, void *buffer, bool binary_mode );
 
+/** !
+ * Map a file into the address space, read only
+ * 
+ * @param path   path to the file
+ * @param p_size return the size of the file
+ * 
+ * @return pointer to the contents on success, 0 on error
+ */
+const void *map_file ( const char *path, size_t *p_size );
+
+/** !
+ * Unmap a file mapped with map_file
+ * 
+ * @param p_data the contents
+ * @param size   the size of the file
+ * 
+ * @return 1 on success, 0 on error
+ */
+int unmap_file ( const void *p_data, size_t size );
+
 int instance_info ( g_instance *p_instance );
 
 void logger_push();
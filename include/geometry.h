@@ -18,6 +18,12 @@
 #include <bv.h>
 #include <g10.h>
 
+// preprocessor definitions
+#define GEOMETRY_PARTS_MAX      4
+#define GEOMETRY_BINARY_MAGIC   0x4d303147 // "G10M"
+#define GEOMETRY_BINARY_VERSION 1
+#define GEOMETRY_BINARY_ALIGN   16
+
 // enumeration definitions
 enum geometry_vertex_attribute_e
 { 
@@ -45,12 +51,106 @@ struct geometry_s
         u32 *p_data;
         size_t index_count;
         const char _material_name[63+1];
-    } _parts[4];
+    } _parts[GEOMETRY_PARTS_MAX];
+};
+
+// a region of a binary geometry file. size is 0 if absent
+struct geometry_binary_range_s
+{
+    u64 offset,
+        size;
+};
+
+// binary geometry file header. streams follow, each aligned to 
+// GEOMETRY_BINARY_ALIGN bytes, in host byte order
+struct geometry_binary_header_s
+{
+    u32 magic,
+        version,
+        header_size,
+        part_count;
+    char _name[63+1];
+
+    // precomputed bounds
+    _Alignas(16) f32 min[4];
+    _Alignas(16) f32 max[4];
+
+    // same units as the geometry structure
+    u32 vertex_count,
+        index_count,
+        _reserved[2];
+
+    // vertex attributes, f32
+    geometry_binary_range _attributes[GEOMETRY_QTY];
+
+    // triangle indices, u32
+    geometry_binary_range idx;
+
+    // parts, u32 indices
+    struct
+    {
+        char _material_name[63+1];
+        geometry_binary_range idx;
+        u32 index_count,
+            _reserved[3];
+    } _parts[GEOMETRY_PARTS_MAX];
 };
 
+_Static_assert(sizeof(geometry_binary_header) % GEOMETRY_BINARY_ALIGN == 0, "binary geometry header must keep streams aligned");
+
 // function declarations
 int geometry_bind ( render_pass *p_render_pass, geometry *p_geometry );
 
+/// asset cache
+/** !
+ * Construct a geometry from the contents of a geometry file, binary or
+ * json. Signature matches fn_asset_load, for the geometry asset cache.
+ * 
+ * @param pp_geometry return
+ * @param p_path      the path of the file, for logging
+ * @param p_data      the contents of the file
+ * @param size        the size of the contents
+ * 
+ * @return 1 on success, 0 on error
+ */
+int geometry_load ( geometry **pp_geometry, const char *p_path, const void *p_data, size_t size );
+
+/** !
+ * Release a geometry and its GPU buffers. Signature matches 
+ * fn_asset_release, for the geometry asset cache.
+ * 
+ * @param p_geometry the geometry
+ * 
+ * @return 1 on success, 0 on error
+ */
+int geometry_release ( geometry *p_geometry );
+
+/// binary
+/** !
+ * Check that a block of memory is a well formed binary geometry file. 
+ * Every stream must lie inside the block and be aligned. A present vertex
+ * stream holds one element per vertex: uv has 2 floats, txyz has 4, and 
+ * the others have 3.
+ * 
+ * @param p_data      the contents of the file
+ * @param size        the size of the contents
+ * @param pp_header   return the header
+ * 
+ * @return 1 if well formed, 0 if not
+ */
+int geometry_binary_validate ( const void *p_data, size_t size, const geometry_binary_header **pp_header );
+
+/** !
+ * Convert a json geometry into a binary geometry file
+ * 
+ * @param p_value the json geometry object
+ * @param pp_data return the contents of the file
+ * @param p_size  return the size of the contents
+ * 
+ * @return 1 on success, 0 on error
+ */
+int geometry_binary_from_json ( const json_value *p_value, void **pp_data, size_t *p_size );
+
 /// print
 /** 
  *  Print a textual representation of an geometry to standard output
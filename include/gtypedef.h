@@ -9,6 +9,9 @@
 // header guard
 #pragma once
 
+// standard library
+#include <stddef.h>
+
 // void
 typedef void u0;
 
@@ -30,10 +33,24 @@ typedef          long long i64;
 typedef float  f32;
 typedef double f64;
 
+// aligned linear algebra storage. build with -DG10_LINEAR_ALIGNED to give
+// vec4 and mat4 16 byte alignment, so the simd kernels use aligned loads
+#ifdef G10_LINEAR_ALIGNED
+    #define G10_LINEAR_ALIGN _Alignas(16)
+#else
+    #define G10_LINEAR_ALIGN
+#endif
+
 // vector
-typedef struct { float x, y; }       vec2;
-typedef struct { float x, y, z; }    vec3;
-typedef struct { float x, y, z, w; } vec4;
+typedef struct { float x, y; }                              vec2;
+typedef struct { float x, y, z; }                           vec3;
+typedef struct { G10_LINEAR_ALIGN float x; float y, z, w; } vec4;
+
+// structure of arrays of 4 component vectors
+typedef struct { float *p_x, *p_y, *p_z, *p_w; } vec4_soa;
+
+// structure of arrays of axis aligned bounding boxes, as centres and half extents
+typedef struct { float *p_cx, *p_cy, *p_cz, *p_ex, *p_ey, *p_ez; } aabb_soa;
 
 // 2x2 matrix
 typedef struct { float a, b, c, d; } mat2;
@@ -42,33 +59,56 @@ typedef struct { float a, b, c, d; } mat2;
 typedef struct { float a, b, c, d, e, f, g, h, i; } mat3;
 
 // 4x4 matrix
-typedef struct { float a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p; } mat4;
+typedef struct { G10_LINEAR_ALIGN float a; float b, c, d, e, f, g, h, i, j, k, l, m, n, o, p; } mat4;
 
 // quaternions
 typedef struct { float u, i, j, k; } quaternion;
 
 // structure declarations
 struct aabb_s;
+struct asset_s;
+struct asset_cache_s;
+struct asset_path_s;
 struct attachment_s;
+struct batch_s;
+struct batch_instance_s;
+struct batch_list_s;
 struct bv_s;
+struct bvh_s;
 struct camera_s;
+struct command_sink_s;
+struct draw_list_s;
+struct draw_packet_s;
 struct entity_s;
 struct framebuffer_s;
 struct g_instance_s;
 struct geometry_s;
+struct geometry_binary_header_s;
+struct geometry_binary_range_s;
 struct light_s;
 struct material_s;
 struct pipeline_s;
+struct pipeline_handle_s;
 struct renderer_s;
 struct render_pass_s;
 struct scene_s;
+struct scene_draw_s;
+struct scene_gather_bucket_s;
+struct schedule_s;
+struct schedule_entry_s;
+struct schedule_system_s;
 struct skybox_s;
 struct sampler_s;
 struct transform_s;
+struct transform_hierarchy_s;
+struct transform_record_s;
+struct transform_stream_header_s;
 struct texture_s;
 struct uniform_s;
 struct input_s;
 struct input_bind_s;
+struct job_s;
+struct job_counter_s;
 
 // struct ai_s;
 // struct bv_s;
@@ -81,26 +121,72 @@ struct input_bind_s;
 
 // type definitions
 typedef struct aabb_s        aabb;
+typedef struct asset_s       asset;
+typedef struct asset_cache_s asset_cache;
+typedef struct asset_path_s  asset_path;
 typedef struct attachment_s  attachment;
+typedef struct batch_s       batch;
+typedef struct batch_instance_s batch_instance;
+typedef struct batch_list_s  batch_list;
 typedef struct bv_s           bv;
+typedef struct bvh_s         bvh;
 typedef struct camera_s      camera;
+typedef struct command_sink_s command_sink;
+typedef struct draw_list_s   draw_list;
+typedef struct draw_packet_s draw_packet;
 typedef struct entity_s      entity;
 typedef struct framebuffer_s framebuffer;
 typedef struct g_instance_s  g_instance;
 typedef struct geometry_s    geometry;
+typedef struct geometry_binary_header_s geometry_binary_header;
+typedef struct geometry_binary_range_s  geometry_binary_range;
 typedef struct light_s       light;
 typedef struct material_s    material;
 typedef struct pipeline_s    pipeline;
+typedef struct pipeline_handle_s pipeline_handle;
 typedef struct renderer_s    renderer;
 typedef struct render_pass_s render_pass;
 typedef struct scene_s       scene;
+typedef struct scene_draw_s  scene_draw;
+typedef struct scene_gather_bucket_s scene_gather_bucket;
+typedef struct schedule_s    schedule;
+typedef struct schedule_entry_s  schedule_entry;
+typedef struct schedule_system_s schedule_system;
 typedef struct skybox_s      skybox;
 typedef struct sampler_s     sampler;
 typedef struct transform_s   transform;
+typedef struct transform_hierarchy_s transform_hierarchy;
+typedef struct transform_record_s    transform_record;
+typedef struct transform_stream_header_s transform_stream_header;
 typedef struct texture_s     texture;
 typedef struct uniform_s     uniform;
 typedef struct input_s       input;
 typedef struct input_bind_s  input_bind;
+typedef struct job_s         job;
+typedef struct job_counter_s job_counter;
+
+// bounding volume hierarchy culling metrics
+typedef struct
+{
+    size_t nodes_visited,
+           nodes_culled,
+           planes_tested;
+} bvh_cull_stats;
+
+// a subtree of a compiled hierarchy, and the frustum planes it still tests
+typedef struct
+{
+    s32 node;
+    u8  mask;
+} bvh_task;
+
+// a pipeline resolved by name. valid while its generation matches the 
+// generation of the pipeline cache. see pipeline_handle_get
+struct pipeline_handle_s
+{
+    pipeline *p_pipeline;
+    u64       generation;
+};
 
 // typedef struct ai_s               ai;
 // typedef struct cull_operation_s   cull_operation;
@@ -123,7 +209,8 @@ typedef int (fn_pipeline_bind_each)( render_pass *p_render_pass, pipeline *p_pip
 typedef int (fn_pipeline_cull)( render_pass *p_render_pass, pipeline *p_pipeline, void *p_drawable );
 typedef int (fn_pipeline_draw)( render_pass *p_render_pass, pipeline *p_pipeline, void *p_drawable );
 typedef int (fn_user_code)( g_instance *p_instance );
-typedef int (fn_camera_controller)( camera *p_camera );
+typedef int (fn_schedule_system)( g_instance *p_instance );
+typedef int (fn_camera_controller)( camera *p_camera, float delta_time );
 
 // typedef int (*fn_bv_bounds_getter)( void *p_value, vec3 *p_min, vec3 *p_max );
 // typedef int (*fn_cull_operation)( void *p_object );
\ No newline at end of file
@@ -0,0 +1,153 @@
+/** !
+ * Jobs on a pool of work stealing worker threads
+ *
+ * @file g10/job.h
+ *
+ * @author Jacob Smith
+ */
+
+// header guard
+#pragma once
+
+// standard library
+#include <stdio.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+// gsdk
+/// core
+#include <core/log.h>
+
+// g10
+#include <gtypedef.h>
+
+// preprocessor definitions
+#define JOB_WORKERS_MAX 64
+#define JOB_DEQUE_MAX   4096 // queued jobs per thread. more go to a shared queue
+#define JOB_BLOCK       256  // jobs allocated at a time, per thread
+
+// type definitions
+/** !
+ * A job
+ *
+ * @param p_context the context passed to job_submit
+ *
+ * @return void
+ */
+typedef void (fn_job)( void *p_context );
+
+/** !
+ * Process the elements [ begin, end ) of a parallel for
+ *
+ * @param p_context the context passed to job_parallel_for
+ * @param begin     the first element
+ * @param end       one past the last element
+ *
+ * @return void
+ */
+typedef void (fn_job_range)( void *p_context, size_t begin, size_t end );
+
+// structure definitions
+// the unfinished jobs of a group. zero initialize, and wait on it with
+// job_wait before it goes out of scope
+struct job_counter_s
+{
+    atomic_size_t  pending;
+    atomic_uint    _releasing; // threads still touching the counter
+    _Atomic(job *) _p_waiters; // jobs submitted to run after this group
+};
+
+// function declarations
+/// initializer
+/** !
+ * Start the worker threads. The calling thread gets a queue too, and runs
+ * jobs while it waits. Called on the first submit if it was not called
+ * before.
+ *
+ * @param workers the quantity of worker threads, or 0 for one less than the
+ *                quantity of online processors
+ *
+ * @return 1 on success, 0 on error
+ */
+int job_init ( size_t workers );
+
+/// accessors
+/** !
+ * Get the quantity of worker threads
+ *
+ * @return the quantity of worker threads
+ */
+size_t job_worker_count ( void );
+
+/// submit
+/** !
+ * Queue a job. Idle threads steal it from the queue of the submitting
+ * thread. With no worker threads, the job runs before this returns.
+ *
+ * @param pfn_job   the job
+ * @param p_context passed to the job
+ * @param p_counter the group of the job, or null
+ *
+ * @return 1 on success, 0 on error
+ */
+int job_submit ( fn_job *pfn_job, void *p_context, job_counter *p_counter );
+
+/** !
+ * Queue a job to run once every job of another group is done
+ *
+ * @param pfn_job      the job
+ * @param p_context    passed to the job
+ * @param p_counter    the group of the job, or null
+ * @param p_dependency the group to run after
+ *
+ * @return 1 on success, 0 on error
+ */
+int job_submit_after ( fn_job *pfn_job, void *p_context, job_counter *p_counter, job_counter *p_dependency );
+
+/** !
+ * Wait for every job of a group. The calling thread runs queued jobs, its
+ * own first, until the group is done.
+ *
+ * @param p_counter the group
+ *
+ * @return 1 on success, 0 on error
+ */
+int job_wait ( job_counter *p_counter );
+
+/// parallel for
+/** !
+ * Queue a parallel for over the elements [ 0, count ). The range is halved
+ * as it is run, and the upper halves are queued, so idle threads steal the
+ * largest pieces first. Ranges of grain elements or fewer are not split.
+ *
+ * @param count     the quantity of elements
+ * @param grain     the most elements per call of the job
+ * @param pfn_job   the job
+ * @param p_context passed to each call of the job
+ * @param p_counter the group of the parallel for
+ *
+ * @return 1 on success, 0 on error
+ */
+int job_parallel_for_async ( size_t count, size_t grain, fn_job_range *pfn_job, void *p_context, job_counter *p_counter );
+
+/** !
+ * Run a parallel for over the elements [ 0, count ), and wait for it. Runs
+ * inline when there is one range or no worker threads.
+ *
+ * @param count     the quantity of elements
+ * @param grain     the most elements per call of the job
+ * @param pfn_job   the job
+ * @param p_context passed to each call of the job
+ *
+ * @return 1 on success, 0 on error
+ */
+int job_parallel_for ( size_t count, size_t grain, fn_job_range *pfn_job, void *p_context );
+
+/// cleanup
+/** !
+ * Stop and join the worker threads. Every group must be done.
+ *
+ * @return 1 on success, 0 on error
+ */
+int job_quit ( void );
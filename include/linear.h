@@ -11,6 +11,62 @@
 #include <gtypedef.h>
 #include <g10.h>
 
+// enumeration definitions
+enum linear_isa_e
+{
+    LINEAR_ISA_SCALAR,
+    LINEAR_ISA_SSE,
+    LINEAR_ISA_AVX2,
+    LINEAR_ISA_NEON,
+    LINEAR_ISA_QTY
+};
+
+// kernels
+/** !
+ * The 4x4 matrix kernels (mat4_mul_vec4, mat4_mul_mat4, mat4_inverse,  
+ * mat4_model_from_vec3 and the batches) have scalar, SSE, AVX2 and NEON 
+ * implementations. 
+ * The first call picks the best implementation the processor supports, or 
+ * the one named by the G10_LINEAR_ISA environment variable. Build with 
+ * -DG10_LINEAR_SCALAR to compile only the scalar kernels.
+ */
+
+/** !
+ * Use a set of kernels
+ *
+ * @param isa the instruction set
+ *
+ * @return 1 on success, 0 if the instruction set is not supported
+ */
+int linear_isa_set ( enum linear_isa_e isa );
+
+/** !
+ * Get the instruction set of the kernels in use
+ *
+ * @param void
+ *
+ * @return the instruction set
+ */
+enum linear_isa_e linear_isa_get ( void );
+
+/** !
+ * Get the fastest instruction set this build supports on this processor
+ *
+ * @param void
+ *
+ * @return the instruction set
+ */
+enum linear_isa_e linear_isa_best ( void );
+
+/** !
+ * Get the name of an instruction set
+ *
+ * @param isa the instruction set
+ *
+ * @return "scalar", "sse", "avx2", "neon" or "unknown"
+ */
+const char *linear_isa_name ( enum linear_isa_e isa );
+
 // 2 component vectors
 /** !
  * Add vector a to vector b; Store result
@@ -647,6 +703,21 @@ u0 mat4_rotation_from_vec3 ( mat4 *p_result, vec3 rotation );
  */
 u0 mat4_model_from_vec3 ( mat4 *p_result, vec3 location, vec3 rotation, vec3 scale );
 
+/** !
+ * Compute a model matrix from a location vector, a rotation matrix, and a 
+ * scale vector; Store result
+ *
+ * @param p_result return
+ * @param location location vector
+ * @param rotation rotation matrix
+ * @param scale    scale vector
+ *
+ * @sa mat4_model_from_vec3
+ *
+ * @return void
+ */
+u0 mat4_model_from_rotation ( mat4 *p_result, vec3 location, mat4 rotation, vec3 scale );
+
 u0 mat4_model_from_bounds ( mat4 *p_result, vec3 min, vec3 max );
 
 /** !
@@ -658,3 +729,151 @@ u0 mat4_model_from_bounds ( mat4 *p_result, vec3 min, vec3 max );
  * @return bytes written
  */
 int mat4_pack ( void *p_buffer, mat4 *p_m );
+
+// affine matrices. the bottom row of an affine matrix is [ 0 0 0 1 ], which
+// every model and view matrix satisfies. these skip the work the general
+// functions spend on it
+/** !
+ * Multiply affine matrix m by affine matrix n; Store result. The bottom row
+ * of the result is [ 0 0 0 1 ]. The result may be either input.
+ *
+ * @param p_result return
+ * @param m        affine matrix
+ * @param n        affine matrix
+ *
+ * @sa mat4_mul_mat4
+ *
+ * @return void
+ */
+u0 mat4_mul_mat4_affine ( mat4 *p_result, mat4 m, mat4 n );
+
+/** !
+ * Compute the inverse of an affine matrix; Store result. The upper 3x3 is
+ * inverted on its own, and the translation is carried through it. A
+ * singular matrix has no inverse, so the result is the identity.
+ *
+ * @param p_result return
+ * @param m        affine matrix
+ *
+ * @sa mat4_inverse
+ * @sa mat4_inverse_rigid
+ *
+ * @return void
+ */
+u0 mat4_inverse_affine ( mat4 *p_result, mat4 m );
+
+/** !
+ * Compute the inverse of a rotation and translation matrix; Store result.
+ * The inverse of a rotation is its transpose. Only valid without scale.
+ *
+ * @param p_result return
+ * @param m        rotation and translation matrix
+ *
+ * @sa mat4_inverse_affine
+ *
+ * @return void
+ */
+u0 mat4_inverse_rigid ( mat4 *p_result, mat4 m );
+
+/** !
+ * Transform a point by an affine matrix; Store result. w is implicitly 1.
+ *
+ * @param p_result return
+ * @param m        affine matrix
+ * @param p        the point
+ *
+ * @sa mat4_mul_direction
+ *
+ * @return void
+ */
+u0 mat4_mul_point ( vec3 *p_result, mat4 m, vec3 p );
+
+/** !
+ * Transform a direction by an affine matrix; Store result. w is implicitly
+ * 0, so the translation is ignored. Transform normals with the normal matrix.
+ *
+ * @param p_result return
+ * @param m        affine matrix
+ * @param d        the direction
+ *
+ * @sa mat4_mul_point
+ * @sa mat4_normal_matrix
+ *
+ * @return void
+ */
+u0 mat4_mul_direction ( vec3 *p_result, mat4 m, vec3 d );
+
+/** !
+ * Compute the normal matrix of an affine matrix; Store result. The normal
+ * matrix is the inverse transpose of the upper 3x3, which is its cofactor
+ * matrix over its determinant. A singular matrix stores the identity.
+ *
+ * @param p_result return
+ * @param m        affine matrix
+ *
+ * @return void
+ */
+u0 mat4_normal_matrix ( mat3 *p_result, mat4 m );
+
+// batches
+/** !
+ * Multiply a matrix by an array of vectors; Store results. The result may 
+ * be the input.
+ *
+ * @param p_result return
+ * @param m        the matrix
+ * @param p_v      the vectors
+ * @param count    the quantity of vectors
+ *
+ * @sa mat4_mul_vec4
+ * @sa mat4_mul_vec4_soa
+ *
+ * @return void
+ */
+u0 mat4_mul_vec4_array ( vec4 *p_result, mat4 m, const vec4 *p_v, size_t count );
+
+/** !
+ * Multiply a matrix by a structure of arrays of vectors; Store results. If 
+ * the w array of the input is null, each w is 1. If the w array of the 
+ * result is null, w is not stored. The result may be the input.
+ *
+ * @param p_result return
+ * @param m        the matrix
+ * @param v        the vectors
+ * @param count    the quantity of vectors
+ *
+ * @sa mat4_mul_vec4_array
+ *
+ * @return void
+ */
+u0 mat4_mul_vec4_soa ( vec4_soa *p_result, mat4 m, vec4_soa v, size_t count );
+
+/** !
+ * Multiply each m by each n; Store results. The result may be either input.
+ *
+ * @param p_result return
+ * @param p_m      the left matrices
+ * @param p_n      the right matrices
+ * @param count    the quantity of matrices
+ *
+ * @sa mat4_mul_mat4
+ *
+ * @return void
+ */
+u0 mat4_mul_mat4_array ( mat4 *p_result, const mat4 *p_m, const mat4 *p_n, size_t count );
+
+/** !
+ * Compute model matrices from arrays of location, rotation, and scale 
+ * vectors; Store results
+ *
+ * @param p_result   return
+ * @param p_location the location vectors
+ * @param p_rotation the rotation vectors
+ * @param p_scale    the scale vectors
+ * @param count      the quantity of matrices
+ *
+ * @sa mat4_model_from_vec3
+ *
+ * @return void
+ */
+u0 mat4_model_from_vec3_array ( mat4 *p_result, const vec3 *p_location, const vec3 *p_rotation, const vec3 *p_scale, size_t count );
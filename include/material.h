@@ -12,6 +12,7 @@
 #include <g10.h>
 #include <texture.h>
 #include <uniform.h>
+#include <asset_cache.h>
 
 // structure definitions
 struct material_s
@@ -44,6 +45,29 @@ struct material_s
  */
 int material_from_json ( material **pp_material, json_value *p_value );
 
+/** !
+ * Construct a material from the contents of a material file. Signature 
+ * matches fn_asset_load, for the material asset cache.
+ * 
+ * @param pp_material result
+ * @param p_path      the path of the file, for logging
+ * @param p_data      the contents of the file
+ * @param size        the size of the contents
+ * 
+ * @return 1 on success, 0 on error
+ */
+int material_load ( material **pp_material, const char *p_path, const void *p_data, size_t size );
+
+/** !
+ * Release a material, and drop its references to cached textures. 
+ * Signature matches fn_asset_release, for the material asset cache.
+ * 
+ * @param p_material the material
+ * 
+ * @return 1 on success, 0 on error
+ */
+int material_release ( material *p_material );
+
 /** !
  * Bind the material to a pipeline
  * 
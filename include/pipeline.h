@@ -16,6 +16,8 @@
 // g10
 #include <gtypedef.h>
 #include <g10.h>
+#include <draw_list.h>
+#include <batch.h>
 
 // structure definitions
 struct pipeline_s
@@ -25,7 +27,17 @@ struct pipeline_s
     void *pipeline;
 
     array *p_static_draw_list;
-    array *p_dynamic_draw_list;
+    draw_list *p_dynamic_draw_list;
+    enum draw_sort_e sort;
+
+    // instanced pipelines draw one batch per geometry and material
+    struct
+    {
+        batch_list *p_batches;
+        void       *p_buffer,
+                   *p_transfer;
+        size_t      capacity;
+    } instancing;
 
     array *p_uniforms;
     array *p_samplers;
@@ -73,4 +85,32 @@ const char *pipeline_key_accessor ( const pipeline *const p_pipeline );
  * 
  * @return the name of the pipeline
  */
-int pipeline_equality ( const pipeline *p_a, const pipeline *p_b );
\ No newline at end of file
+int pipeline_equality ( const pipeline *p_a, const pipeline *p_b );
+
+/// handles
+/** !
+ * Get the pipeline of a handle. The name is looked up in the pipeline 
+ * cache only when the handle is older than the cache, so a handle that is
+ * still valid costs one comparison.
+ * 
+ * @param p_handle the handle
+ * @param p_name   the name of the pipeline
+ * 
+ * @return the pipeline, or null if there is no pipeline with that name
+ */
+pipeline *pipeline_handle_get ( pipeline_handle *p_handle, const char *p_name );
+
+/** !
+ * Invalidate every pipeline handle. Call after a pipeline is added to, 
+ * removed from, or reloaded in the pipeline cache.
+ * 
+ * @return void
+ */
+void pipeline_cache_invalidate ( void );
+
+/** !
+ * Get the quantity of pipeline name lookups made through handles
+ * 
+ * @return the quantity of lookups
+ */
+u64 pipeline_lookup_count ( void );
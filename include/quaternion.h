@@ -0,0 +1,175 @@
+/** !
+ * Quaternion rotations
+ *
+ * @file g10/quaternion.h
+ *
+ * @author Jacob Smith
+ */
+
+// header guard
+#pragma once
+
+// standard library
+#include <stdio.h>
+#include <math.h>
+
+// g10
+#include <gtypedef.h>
+#include <linear.h>
+
+// function declarations
+/// constructors
+/** !
+ * Store the identity quaternion
+ *
+ * @param p_result return
+ *
+ * @return void
+ */
+u0 quaternion_identity ( quaternion *p_result );
+
+/** !
+ * Compute a quaternion from a rotation vector in degrees. The quaternion
+ * rotates the same way as mat4_rotation_from_vec3.
+ *
+ * @param p_result return
+ * @param rotation rotation vector
+ *
+ * @sa mat4_rotation_from_vec3
+ *
+ * @return void
+ */
+u0 quaternion_from_euler ( quaternion *p_result, vec3 rotation );
+
+/** !
+ * Compute a quaternion from an axis and an angle in degrees
+ *
+ * @param p_result return
+ * @param axis     the axis of rotation. need not be normalized
+ * @param angle    the angle of rotation in degrees
+ *
+ * @return void
+ */
+u0 quaternion_from_axis_angle ( quaternion *p_result, vec3 axis, float angle );
+
+/// operations
+/** !
+ * Multiply q by r; Store result. The product rotates by r, then by q.
+ *
+ * @param p_result return
+ * @param q        quaternion
+ * @param r        quaternion
+ *
+ * @return q times r
+ */
+u0 quaternion_mul_quaternion ( quaternion *p_result, quaternion q, quaternion r );
+
+/** !
+ * Compute the conjugate of a quaternion; Store result. The conjugate of a
+ * unit quaternion is its inverse.
+ *
+ * @param p_result return
+ * @param q        the quaternion
+ *
+ * @return void
+ */
+u0 quaternion_conjugate ( quaternion *p_result, quaternion q );
+
+/** !
+ * Scale a quaternion to unit length; Store result
+ *
+ * @param p_result return
+ * @param q        the quaternion
+ *
+ * @return void
+ */
+u0 quaternion_normalize ( quaternion *p_result, quaternion q );
+
+/** !
+ * Normalized linear interpolation along the shorter arc; Store result
+ *
+ * @param p_result return
+ * @param q        the quaternion at t = 0
+ * @param r        the quaternion at t = 1
+ * @param t        the interpolant
+ *
+ * @sa quaternion_slerp
+ *
+ * @return void
+ */
+u0 quaternion_nlerp ( quaternion *p_result, quaternion q, quaternion r, float t );
+
+/** !
+ * Spherical linear interpolation along the shorter arc; Store result
+ *
+ * @param p_result return
+ * @param q        the quaternion at t = 0
+ * @param r        the quaternion at t = 1
+ * @param t        the interpolant
+ *
+ * @sa quaternion_nlerp
+ *
+ * @return void
+ */
+u0 quaternion_slerp ( quaternion *p_result, quaternion q, quaternion r, float t );
+
+/** !
+ * Rotate a vector by a unit quaternion; Store result
+ *
+ * @param p_result return
+ * @param q        the quaternion
+ * @param v        the vector
+ *
+ * @return void
+ */
+u0 quaternion_rotate_vec3 ( vec3 *p_result, quaternion q, vec3 v );
+
+/// conversions
+/** !
+ * Compute a rotation matrix from a unit quaternion; Store result. No trig.
+ *
+ * @param p_result return
+ * @param q        the quaternion
+ *
+ * @sa mat4_rotation_from_vec3
+ *
+ * @return void
+ */
+u0 quaternion_to_mat4 ( mat4 *p_result, quaternion q );
+
+/** !
+ * Compute a rotation vector in degrees from a unit quaternion; Store result.
+ * Inverse of quaternion_from_euler.
+ *
+ * @param p_result return
+ * @param q        the quaternion
+ *
+ * @return void
+ */
+u0 quaternion_to_euler ( vec3 *p_result, quaternion q );
+
+/** !
+ * Compute a model matrix from a location, a unit quaternion, and a scale
+ * vector; Store result. No trig.
+ *
+ * @param p_result return
+ * @param location location vector
+ * @param rotation the quaternion
+ * @param scale    scale vector
+ *
+ * @sa mat4_model_from_vec3
+ *
+ * @return void
+ */
+u0 mat4_model_from_quaternion ( mat4 *p_result, vec3 location, quaternion rotation, vec3 scale );
+
+/// reflection
+/** !
+ * Serialize a quaternion to a buffer
+ *
+ * @param p_buffer the buffer
+ * @param p_q      pointer to the quaternion
+ *
+ * @return bytes written
+ */
+int quaternion_pack ( void *p_buffer, quaternion *p_q );
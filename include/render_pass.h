@@ -24,6 +24,15 @@ struct render_pass_s
     framebuffer *p_framebuffer;
     array *p_pipelines;
     void *p_handle;
+
+    // state bound by the last draw, so consecutive draws can skip it
+    struct
+    {
+        void *p_transform,
+             *p_material,
+             *p_geometry;
+        size_t binds_skipped;
+    } bound;
 };
 
 // function declarations
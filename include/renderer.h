@@ -37,4 +37,16 @@ struct renderer_s
  */
 int renderer_info ( renderer *p_renderer );
 
-int renderer_render ( g_instance *p_instance );
\ No newline at end of file
+int renderer_render ( g_instance *p_instance );
+
+/// benchmark
+/** !
+ * Run a fixed quantity of frames, then print the cpu frame times and the 
+ * commands they recorded. Use the null backend to time the cpu side alone.
+ * 
+ * @param p_instance the instance
+ * @param frames     the quantity of frames
+ * 
+ * @return 1 on success, 0 on error
+ */
+int renderer_benchmark ( g_instance *p_instance, size_t frames );
\ No newline at end of file
@@ -18,8 +18,31 @@
 #include <entity.h>
 #include <camera.h>
 #include <bv.h>
+#include <bvh.h>
+#include <draw_list.h>
+
+// preprocessor definitions
+#define SCENE_REFIT_LIMIT  2.0f
+#define SCENE_GATHER_TASKS 128 // subtrees per gather, on any quantity of threads
+#define SCENE_GATHER_LISTS 32  // draw lists grown once per gather
 
 // structure definitions
+// a draw found by a gather task
+struct scene_draw_s
+{
+    draw_list   *p_draw_list;
+    draw_packet  packet;
+};
+
+// the draws of one gather task, in the order they were found
+struct scene_gather_bucket_s
+{
+    scene          *p_scene;
+    scene_draw     *p_draws;
+    size_t          count, max;
+    bvh_cull_stats  cull;
+};
+
 struct scene_s
 {
     char _name[63+1];
@@ -29,6 +52,44 @@ struct scene_s
     camera *p_active_camera;
     skybox *p_skybox;
     bv *p_bounds;
+    bvh *p_bvh;
+    transform_hierarchy *p_transforms;
+
+    // every entity, for tracking moved bounds
+    entity **pp_entities;
+    size_t   entity_count;
+    enum bv_build_e bvh_build;
+
+    // leaves whose entities moved since the last refit, and room to 
+    // transform their bounds in one batch
+    struct
+    {
+        bv   **pp_leaves;
+        mat4  *p_world;
+        float *p_boxes; // 6 arrays of max floats, as an aabb_soa
+        size_t count, max;
+    } dirty;
+
+    // culling metrics for the last gather
+    struct
+    {
+        size_t nodes_visited,
+               nodes_culled,
+               planes_tested,
+               drawables,
+               refits,
+               rebuilds,
+               pipeline_lookups;
+    } cull;
+
+    // parallel gather. subtrees of the compiled hierarchy, and one bucket 
+    // per subtree after one for the leaves above them. reused each frame
+    struct
+    {
+        bvh_task            *p_tasks;   // BVH_TASKS_MAX
+        scene_gather_bucket *p_buckets; // BVH_TASKS_MAX + 1
+        size_t               task_count;
+    } gather;
 };
 
 // function declarations
@@ -36,4 +97,36 @@ int scene_from_json ( scene **pp_scene, json_value *p_value );
 
 int scene_info ( scene *p_scene );
 
+/** !
+ * Fill the dynamic draw list of each pipeline with the visible drawables
+ * of a scene. The top of the compiled hierarchy is split into subtrees,
+ * which the worker threads cull into their own buckets. The buckets are 
+ * merged in subtree order, so the draw lists are the same on any quantity
+ * of threads.
+ * 
+ * @param p_scene the scene
+ * 
+ * @return 1 on success, 0 on error
+ */
 int scene_gather_drawable ( scene *p_scene );
+
+/** !
+ * Mark an entity's bounds as stale after its transform changed. The 
+ * bounds are recomputed by the next refit.
+ * 
+ * @param p_scene  the scene
+ * @param p_entity the entity that moved
+ * 
+ * @return 1 on success, 0 on error
+ */
+int scene_entity_moved ( scene *p_scene, entity *p_entity );
+
+/** !
+ * Refit the scene hierarchy along the paths of each moved entity. Subtrees
+ * that degrade past SCENE_REFIT_LIMIT are rebuilt in place.
+ * 
+ * @param p_scene the scene
+ * 
+ * @return 1 on success, 0 on error
+ */
+int scene_refit ( scene *p_scene );
@@ -0,0 +1,164 @@
+/** !
+ * Per frame system scheduler
+ *
+ * @file g10/schedule.h
+ *
+ * @author Jacob Smith
+ */
+
+// header guard
+#pragma once
+
+// standard library
+#include <stdio.h>
+#include <stdbool.h>
+
+// gsdk
+/// core
+#include <core/log.h>
+#include <core/sync.h>
+
+/// reflection
+#include <reflection/json.h>
+
+// g10
+#include <gtypedef.h>
+
+// preprocessor definitions
+#define SCHEDULE_SYSTEMS_MAX     64 // registered systems
+#define SCHEDULE_ENTRIES_MAX     64 // systems in one schedule
+#define SCHEDULE_NAME_MAX        63
+#define SCHEDULE_TICKS_MAX       8   // ticks per frame. time beyond is dropped
+#define SCHEDULE_MAIN_THREAD     0x1 // the system must run on the thread that calls schedule_run
+#define SCHEDULE_TICK            0x2 // the system simulates, at the fixed tick rate of the instance
+
+// enumeration definitions
+// engine data a system reads or writes. systems that write something
+// another system touches do not run at the same time
+enum schedule_resource_e
+{
+    SCHEDULE_INPUT      = 1 << 0,
+    SCHEDULE_TRANSFORMS = 1 << 1,
+    SCHEDULE_BOUNDS     = 1 << 2,
+    SCHEDULE_CAMERA     = 1 << 3,
+    SCHEDULE_DRAW_LISTS = 1 << 4,
+    SCHEDULE_RESOURCE_QTY = 5
+};
+
+// structure definitions
+struct schedule_system_s
+{
+    char                _name[SCHEDULE_NAME_MAX + 1];
+    fn_schedule_system *pfn_system;
+    u32                 reads, writes, flags;
+};
+
+// a system in a schedule
+struct schedule_entry_s
+{
+    char             _name[SCHEDULE_NAME_MAX + 1];
+    schedule_system *p_system; // resolved by name on the first run
+    schedule        *p_schedule;
+    u32              reads, writes;
+    bool             declared; // reads and writes came from the instance file
+    u8               phase;    // before the ticks, a tick, or after the ticks
+    size_t           wave;     // systems in the same wave run at the same time
+
+    // milliseconds
+    struct
+    {
+        f64 last, total, max;
+    } time;
+};
+
+struct schedule_s
+{
+    schedule_entry _entries[SCHEDULE_ENTRIES_MAX];
+    size_t         count, waves, frames, ticks, tick_systems;
+    u64            generation;
+    g_instance    *p_instance;
+
+    // the start of the last frame, and the seconds not yet simulated
+    timestamp last;
+    f64       accumulator;
+};
+
+// function declarations
+/// registry
+/** !
+ * Register a system by name. Schedules resolve the name the next time they
+ * run. Registering a name again replaces the system.
+ *
+ * @param name       the name of the system
+ * @param pfn_system the system
+ * @param reads      the engine data the system reads, a mask of schedule_resource_e
+ * @param writes     the engine data the system writes, a mask of schedule_resource_e
+ * @param flags      SCHEDULE_MAIN_THREAD, or 0
+ *
+ * @return 1 on success, 0 on error
+ */
+int schedule_system_register ( const char *name, fn_schedule_system *pfn_system, u32 reads, u32 writes, u32 flags );
+
+/// constructors
+/** !
+ * Construct a schedule from a json array of systems, in order. Each system
+ * is a name, or an object with a name, and the names of the engine data it
+ * reads and writes. Systems given by name use the reads and writes they
+ * were registered with.
+ *
+ * @param pp_schedule return
+ * @param p_value     the json array
+ *
+ * @return 1 on success, 0 on error
+ */
+int schedule_from_json ( schedule **pp_schedule, const json_value *p_value );
+
+/** !
+ * Construct the default schedule. Input, then user code, then render.
+ *
+ * @param pp_schedule return
+ *
+ * @return 1 on success, 0 on error
+ */
+int schedule_default ( schedule **pp_schedule );
+
+/// run
+/** !
+ * Run one frame of a schedule. The frame systems before the first tick
+ * system run, then the tick systems run once per tick, then the rest of
+ * the frame systems run. At a fixed tick rate, the frame time accumulates,
+ * and a tick runs for each whole tick. The active camera, and the transforms
+ * the tick systems move, keep the state of the previous tick, and are 
+ * interpolated before the later frame systems, so rendering can run faster
+ * than the simulation. Without a fixed tick
+ * rate, the tick systems run once per frame.
+ *
+ * Systems run in waves, and systems in the same wave run on the job
+ * system. Each system is timed.
+ *
+ * @param p_schedule the schedule
+ * @param p_instance the instance passed to each system
+ *
+ * @return 1 on success, 0 on error
+ */
+int schedule_run ( schedule *p_schedule, g_instance *p_instance );
+
+/// info
+/** !
+ * Print the systems of a schedule, their waves, and their timings
+ *
+ * @param p_schedule the schedule
+ *
+ * @return 1 on success, 0 on error
+ */
+int schedule_info ( const schedule *p_schedule );
+
+/// destructors
+/** !
+ * Destroy a schedule
+ *
+ * @param pp_schedule pointer to schedule pointer
+ *
+ * @return 1 on success, 0 on error
+ */
+int schedule_destroy ( schedule **pp_schedule );
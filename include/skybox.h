@@ -8,7 +8,8 @@ struct skybox_s {
     char _name[63+1];
     texture *p_texture;
     geometry *p_geometry;
-    char *pipeline;
+    char _pipeline_name[63+1];
+    pipeline_handle _pipeline;
 };
 
 /** !
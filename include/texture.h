@@ -3,6 +3,7 @@
 
 // standard library
 #include <stdio.h>
+#include <string.h>
 
 // gsdk
 /// core
@@ -45,3 +46,27 @@ const char *texture_key_accessor ( const texture *const p_texture );
  * @return the name of the texture
  */
 int texture_equality ( const texture *p_a, const texture *p_b );
+
+/// asset cache
+/** !
+ * Construct a texture from the contents of an image file. Signature matches
+ * fn_asset_load, for the texture asset cache.
+ * 
+ * @param pp_texture return
+ * @param p_path     the path of the file, used as the name of the texture
+ * @param p_data     the contents of the file
+ * @param size       the size of the contents
+ * 
+ * @return 1 on success, 0 on error
+ */
+int texture_load ( texture **pp_texture, const char *p_path, const void *p_data, size_t size );
+
+/** !
+ * Release a texture and its GPU image. Signature matches fn_asset_release, 
+ * for the texture asset cache.
+ * 
+ * @param p_texture the texture
+ * 
+ * @return 1 on success, 0 on error
+ */
+int texture_release ( texture *p_texture );
@@ -4,6 +4,7 @@
 // standard library
 #include <stdio.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -21,19 +22,81 @@
 // g10
 #include <gtypedef.h>
 #include <linear.h>
+#include <quaternion.h>
+
+// preprocessor definitions
+#define TRANSFORM_STREAM_MAGIC    0x54303147 // "G10T"
+#define TRANSFORM_STREAM_VERSION  1
+#define TRANSFORM_RECORD_ROOT     UINT32_MAX
+#define TRANSFORM_HIERARCHY_GRAIN 1024 // the most transforms per range of an update
 
 // structure definitions
 struct transform_s
 {
-    vec3 location;
-    vec3 rotation;
-    vec3 scale;
+    vec3       location;
+    quaternion orientation; // euler angles are derived from this on demand
+    vec3       scale;
+
+    mat4 model; // local
+    mat4 world; // cached, valid while this transform and its ancestors are clean
 
-    mat4 model;
+    // the state at the start of the tick that moved this transform. the
+    // model matrix is blended from it between ticks. see transform_hierarchy_tick
+    struct
+    {
+        vec3       location;
+        quaternion orientation;
+        vec3       scale;
+    } previous;
 
     transform *p_parent;
+    bool       dirty,  // the local matrix changed since the world matrix was computed
+               moving; // the state changed during the last tick
+
+    // the change that last touched this transform, and the version the 
+    // cached world matrix was built from. see transform_version
+    u64 version, world_version;
+
+    // owning hierarchy, and the index of this transform in it
+    transform_hierarchy *p_hierarchy;
+    size_t               _index;
 };
 
+struct transform_hierarchy_s
+{
+    transform **pp_transforms; // preorder. the subtree of i is [ i, i + p_extent[i] )
+    size_t     *p_extent;
+    size_t     *p_ranges; // scratch. the begin and end of each range of an update
+    size_t      count, max, ranges_max;
+    bool        sorted,
+                ticking; // between transform_hierarchy_tick and transform_hierarchy_interpolate
+};
+
+// transform stream header. count records follow, in host byte order. The
+// records are fixed size, so a mapped stream is an array of records
+struct transform_stream_header_s
+{
+    u32 magic,
+        version,
+        header_size,
+        record_size;
+    u64 count,
+        _reserved;
+};
+
+// one transform in a transform stream
+struct transform_record_s
+{
+    f32 location[3],
+        orientation[4], // u, i, j, k
+        scale[3];
+    u32 parent,         // index of the parent record, or TRANSFORM_RECORD_ROOT
+        _reserved;
+};
+
+_Static_assert(sizeof(transform_stream_header) % 16 == 0, "transform stream header must keep records aligned");
+_Static_assert(sizeof(transform_record) == 48, "transform records must be tightly packed");
+
 // function definitions
 /// constructors
 /** !
@@ -83,6 +146,89 @@ int transform_get_matrix_local (
     mat4      *p_model_matrix
 );
 
+/** !
+ * Get the world 4x4 model matrix from a transform. The cached world matrix
+ * is returned when it was built from the current version, otherwise the
+ * model matrix of each parent is applied. Only transform_hierarchy_update
+ * writes the cache, so this is read only, and safe to call from any thread
+ * while the transforms are not being modified.
+ * 
+ * @param p_transform    the transform
+ * @param p_model_matrix return
+ * 
+ * @return 1 on success, 0 on error
+ */
+int transform_get_matrix_world ( 
+    transform *p_transform, 
+    mat4      *p_model_matrix
+);
+
+/** !
+ * Get the version of a transform. The version increases whenever the world
+ * matrix of the transform changes, including through a change to any of
+ * its ancestors. Derived data stores the version it was built from, and 
+ * is rebuilt when the versions differ.
+ * 
+ * @param p_transform the transform
+ * 
+ * @return the version, or 0 if p_transform is null
+ */
+u64 transform_version ( const transform *p_transform );
+
+/// mutators
+/** !
+ * Set the parent of a transform. The transform is marked dirty, and its
+ * hierarchy is sorted again before the next update.
+ * 
+ * @param p_transform the transform
+ * @param p_parent    the new parent, or null for a root
+ * 
+ * @return 1 on success, 0 on error
+ */
+int transform_set_parent ( transform *p_transform, transform *p_parent );
+
+/** !
+ * Set the location of a transform, and update its model matrix
+ * 
+ * @param p_transform the transform
+ * @param location    the location
+ * 
+ * @return 1 on success, 0 on error
+ */
+int transform_set_location ( transform *p_transform, vec3 location );
+
+/** !
+ * Set the scale of a transform, and update its model matrix
+ * 
+ * @param p_transform the transform
+ * @param scale       the scale
+ * 
+ * @return 1 on success, 0 on error
+ */
+int transform_set_scale ( transform *p_transform, vec3 scale );
+
+/** !
+ * Set the rotation of a transform, and update its model matrix. No trig.
+ * 
+ * @param p_transform the transform
+ * @param rotation    the rotation, as a unit quaternion
+ * 
+ * @return 1 on success, 0 on error
+ */
+int transform_set_rotation ( transform *p_transform, quaternion rotation );
+
+/** !
+ * Apply a rotation on top of the current rotation of a transform, and 
+ * update its model matrix. Animated rotation precomputes the delta once, 
+ * so each frame costs no trig.
+ * 
+ * @param p_transform the transform
+ * @param delta       the rotation to apply, as a unit quaternion
+ * 
+ * @return 1 on success, 0 on error
+ */
+int transform_rotate ( transform *p_transform, quaternion delta );
+
 /// bind
 int transform_bind ( render_pass *p_render_pass, pipeline *p_pipeline, transform *p_transform );
 
@@ -93,6 +239,46 @@ int transform_info ( transform *p_transform );
 int transform_pack ( void *p_buffer, transform *p_transform );
 int transform_unpack ( transform **pp_transform, void *p_buffer );
 
+/** !
+ * Write a transform stream. The header is followed by one record per 
+ * transform. Parents outside the array are written as roots. Write the
+ * transforms of a hierarchy in its order, so each parent precedes its 
+ * children and is found by its index instead of through a table.
+ * 
+ * @param p_buffer      the buffer, or null to compute the size
+ * @param pp_transforms the transforms
+ * @param count         the quantity of transforms
+ * 
+ * @return the size of the stream in bytes on success, 0 on error
+ */
+size_t transform_pack_many ( void *p_buffer, transform *const *pp_transforms, size_t count );
+
+/** !
+ * Validate a transform stream, and get its records. The records are not 
+ * copied, so a mapped stream is read in place.
+ * 
+ * @param p_buffer the stream
+ * @param size     the size of the stream in bytes
+ * @param p_count  return the quantity of records
+ * 
+ * @return pointer to the first record on success, null on error
+ */
+const transform_record *transform_stream_records ( const void *p_buffer, size_t size, size_t *p_count );
+
+/** !
+ * Read records into an array of transforms. Parent indices become pointers
+ * into the same array, so a parent may precede or follow its child. A record
+ * whose parent is outside the stream, or whose parent link closes a cycle, is
+ * read as a root, and the quantity of dropped links is logged.
+ * 
+ * @param p_transforms the transforms, at least count elements
+ * @param p_records    the records
+ * @param count        the quantity of records
+ * 
+ * @return the quantity of transforms read
+ */
+size_t transform_unpack_many ( transform *p_transforms, const transform_record *p_records, size_t count );
+
 /** !
  * Construct a transform from an AABB
  * 
@@ -103,6 +289,77 @@ int transform_unpack ( transform **pp_transform, void *p_buffer );
  */
 int transform_from_aabb ( transform *p_transform, aabb *p_aabb );
 
+/// hierarchy
+/** !
+ * Construct an empty transform hierarchy
+ * 
+ * @param pp_hierarchy return
+ * 
+ * @return 1 on success, 0 on error
+ */
+int transform_hierarchy_construct ( transform_hierarchy **pp_hierarchy );
+
+/** !
+ * Add a transform, and each of its ancestors, to a hierarchy. A transform
+ * belongs to at most one hierarchy.
+ * 
+ * @param p_hierarchy the hierarchy
+ * @param p_transform the transform
+ * 
+ * @return 1 on success, 0 on error
+ */
+int transform_hierarchy_add ( transform_hierarchy *p_hierarchy, transform *p_transform );
+
+/** !
+ * Recompute the world matrix of each dirty transform and its descendants
+ * in one pass over the hierarchy, parents first. A clean transform costs
+ * one test, so the matrix work follows the size of the dirty subtrees, not
+ * a walk up the tree per draw. The dirty subtrees are gathered into ranges
+ * of at most TRANSFORM_HIERARCHY_GRAIN transforms, which are split across 
+ * the worker threads. This is the only writer of the cached world matrices;
+ * call it before the frame reads them.
+ * 
+ * @param p_hierarchy the hierarchy
+ * 
+ * @return the quantity of world matrices recomputed
+ */
+size_t transform_hierarchy_update ( transform_hierarchy *p_hierarchy );
+
+/** !
+ * Start a simulation tick. The model matrix of each transform that moved
+ * during the last tick is rebuilt from its current state, and the next 
+ * change stores the current state as the previous state. Changes are
+ * blended until the next transform_hierarchy_interpolate; changes made
+ * after it snap.
+ *
+ * @param p_hierarchy the hierarchy
+ *
+ * @return 1 on success, 0 on error
+ */
+int transform_hierarchy_tick ( transform_hierarchy *p_hierarchy );
+
+/** !
+ * Blend the model matrix of each transform that moved during the last tick
+ * between its previous and current states. The state itself is not changed,
+ * and the next transform_hierarchy_update rebuilds the world matrices.
+ *
+ * @param p_hierarchy the hierarchy
+ * @param alpha       0 for the previous tick, 1 for the current tick
+ *
+ * @return 1 on success, 0 on error
+ */
+int transform_hierarchy_interpolate ( transform_hierarchy *p_hierarchy, float alpha );
+
+/** !
+ * Destroy and deallocate a transform hierarchy. The transforms are not
+ * destroyed.
+ * 
+ * @param pp_hierarchy pointer to transform hierarchy pointer
+ * 
+ * @return 1 on success, 0 on error
+ */
+int transform_hierarchy_destroy ( transform_hierarchy **pp_hierarchy );
+
 /// destructors
 /** !
  * Destroy and deallocate a transform
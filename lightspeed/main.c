@@ -8,6 +8,8 @@
 
 // standard library
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 // gsdk
 /// core
@@ -25,6 +27,7 @@
 #include <uniform.h>
 #include <bv.h>
 #include <user_code.h>
+#include <schedule.h>
 #include <skybox.h>
 
 // function declarations
@@ -34,18 +37,30 @@ int game_logic ( g_instance *p_instance );
 int main ( int argc, const char *argv[] ) 
 {
     
-    // unused
-    (void) argc, (void) argv;
-
     // initialized data
     g_instance *p_instance = NULL;
+    const char *p_instance_path = "assets/lightspeed.json";
+    size_t frames = 0;
     skybox *p_skybox = NULL;
     json_value *p_s = NULL;
     char _buf[1024] = { 0 };
     bool ok = true;
 
+    // parse command line arguments
+    for (int i = 1; i < argc; i++)
+    {
+
+        // run a fixed quantity of frames, and report cpu frame times
+        if ( 0 == strcmp(argv[i], "--frames") && i + 1 < argc )
+            frames = (size_t) strtoull(argv[++i], NULL, 10);
+
+        // use another instance, e.g. one with "backend" : "null"
+        else if ( 0 == strcmp(argv[i], "--instance") && i + 1 < argc )
+            p_instance_path = argv[++i];
+    }
+
     // initialize g10
-    if ( 0 == g_init(&p_instance, "assets/lightspeed.json") ) goto failed_to_initialize_g10;
+    if ( 0 == g_init(&p_instance, p_instance_path) ) goto failed_to_initialize_g10;
 
     load_file("assets/skybox/skybox.json", _buf, true);
     json_value_parse(_buf, 0, &p_s);
@@ -90,18 +105,16 @@ int main ( int argc, const char *argv[] )
     // set running flag
     p_instance->running = ok;
 
+    // benchmark
+    if ( frames )
+        renderer_benchmark(p_instance, frames);
+
     // main loop
-    while ( p_instance->running )
+    else while ( p_instance->running )
     {
 
-        // poll input
-        poll_input(p_instance);
-        
-        // user code
-        user_code(p_instance);
-
-        // render the frame
-        renderer_render(p_instance);
+        // input, then user code, then render
+        schedule_run(p_instance->p_schedule, p_instance);
     }
     
     // success
@@ -132,7 +145,7 @@ int game_logic ( g_instance *p_instance )
 {
 
     // update the camera
-    camera_controller_first_person_update(p_instance->context.p_scene->p_active_camera);
+    camera_controller_first_person_update(p_instance->context.p_scene->p_active_camera, p_instance->context.delta_time);
 
     if ( input_bind_value("SNAPSHOT") )    
     {
@@ -140,7 +153,7 @@ int game_logic ( g_instance *p_instance )
         static int time = 0;
         pipeline *p_pipeline = NULL;
         dict_get(p_instance->cache.p_pipeline, "default", (void**)&p_pipeline);
-        size_t l = array_size(p_pipeline->p_dynamic_draw_list);
+        size_t l = draw_list_size(p_pipeline->p_dynamic_draw_list);
 
         printf("[%d] : %d\n",time,l);
 
@@ -8,6 +8,8 @@
 
 // standard library
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 // gsdk
 /// core
@@ -25,6 +27,7 @@
 #include <uniform.h>
 #include <bv.h>
 #include <user_code.h>
+#include <schedule.h>
 
 // function declarations
 int game_logic ( g_instance *p_instance );
@@ -33,15 +36,27 @@ int game_logic ( g_instance *p_instance );
 int main ( int argc, const char *argv[] ) 
 {
     
-    // unused
-    (void) argc, (void) argv;
-
     // initialized data
     g_instance *p_instance = NULL;
+    const char *p_instance_path = "assets/instance.json";
+    size_t frames = 0;
     bool ok = true;
 
+    // parse command line arguments
+    for (int i = 1; i < argc; i++)
+    {
+
+        // run a fixed quantity of frames, and report cpu frame times
+        if ( 0 == strcmp(argv[i], "--frames") && i + 1 < argc )
+            frames = (size_t) strtoull(argv[++i], NULL, 10);
+
+        // use another instance, e.g. one with "backend" : "null"
+        else if ( 0 == strcmp(argv[i], "--instance") && i + 1 < argc )
+            p_instance_path = argv[++i];
+    }
+
     // initialize g10
-    if ( 0 == g_init(&p_instance, "assets/instance.json") ) goto failed_to_initialize_g10;
+    if ( 0 == g_init(&p_instance, p_instance_path) ) goto failed_to_initialize_g10;
 
     // program pipelines
     {
@@ -54,6 +69,14 @@ int main ( int argc, const char *argv[] )
             (fn_pipeline_draw *)entity_draw
         );
 
+        // program instanced default pipeline
+        ok &= program_pipeline("default_instanced", 
+            (fn_pipeline_bind_once *)lighting_bind_once,
+            NULL,
+            (fn_pipeline_bind_each *)entity_bind_batch,
+            (fn_pipeline_draw *)entity_draw_batch
+        );
+
         // program aabb pipeline
         ok &= program_pipeline("aabb", 
             (fn_pipeline_bind_once *)camera_bind_active,
@@ -63,8 +86,8 @@ int main ( int argc, const char *argv[] )
         );
     }
 
-    // user code 
-    user_code_set_callback((fn_user_code *)game_logic);
+    // systems
+    schedule_system_register("camera controller", game_logic, SCHEDULE_INPUT, SCHEDULE_CAMERA, SCHEDULE_TICK);
 
     // logs
     instance_info(p_instance);
@@ -72,18 +95,16 @@ int main ( int argc, const char *argv[] )
     // set running flag
     p_instance->running = ok;
 
+    // benchmark
+    if ( frames )
+        renderer_benchmark(p_instance, frames);
+
     // main loop
-    while ( p_instance->running )
+    else while ( p_instance->running )
     {
 
-        // poll input
-        poll_input(p_instance);
-        
-        // user code
-        user_code(p_instance);
-
-        // render the frame
-        renderer_render(p_instance);
+        // run each system of the schedule
+        schedule_run(p_instance->p_schedule, p_instance);
     }
     
     // success
@@ -109,7 +130,7 @@ int game_logic ( g_instance *p_instance )
 {
 
     // update the camera
-    camera_controller_first_person_update(p_instance->context.p_scene->p_active_camera);
+    camera_controller_first_person_update(p_instance->context.p_scene->p_active_camera, p_instance->context.delta_time);
     
     // success
     return 1;
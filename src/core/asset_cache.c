@@ -0,0 +1,445 @@
+/** !
+ * Reference counted asset cache
+ *
+ * @file src/core/asset_cache.c
+ *
+ * @author Jacob Smith
+ */
+
+// header
+#include <asset_cache.h>
+#include <g10.h>
+
+// standard library
+#include <stdint.h>
+
+// preprocessor definitions
+#define ASSET_FNV_OFFSET 0xcbf29ce484222325ULL
+#define ASSET_FNV_PRIME  0x00000100000001b3ULL
+
+// key accessors
+const char *asset_key_accessor ( const asset *const p_asset )
+{
+    return p_asset->_hash;
+}
+
+const char *asset_value_key_accessor ( const asset *const p_asset )
+{
+    return p_asset->_value;
+}
+
+const char *asset_path_key_accessor ( const asset_path *const p_asset_path )
+{
+    return p_asset_path->_path;
+}
+
+// static function definitions
+/** !
+ * Write the address of an asset value as a lookup key
+ *
+ * @param _key    return
+ * @param p_value the value
+ *
+ * @return void
+ */
+static void asset_value_key ( char _key[16+1], const void *p_value )
+{
+    snprintf(_key, 16 + 1, "%016llx", (unsigned long long) (uintptr_t) p_value);
+}
+
+// function definitions
+int asset_cache_construct ( asset_cache **pp_asset_cache, const char *_name, size_t size, fn_asset_load *pfn_load, fn_asset_release *pfn_release )
+{
+
+    // argument check
+    if ( NULL == pp_asset_cache ) goto no_asset_cache;
+    if ( NULL ==          _name ) goto no_name;
+    if ( NULL ==       pfn_load ) goto no_load;
+
+    // initialized data
+    asset_cache *p_asset_cache = default_allocator(0, sizeof(asset_cache));
+
+    // error check
+    if ( NULL == p_asset_cache ) goto no_mem;
+
+    // populate the cache
+    *p_asset_cache = (asset_cache)
+    {
+        .pfn_load    = pfn_load,
+        .pfn_release = pfn_release
+    };
+
+    // store the name
+    strncpy(p_asset_cache->_name, _name, sizeof(p_asset_cache->_name) - 1);
+
+    // construct the path and content lookups
+    dict_construct(&p_asset_cache->p_paths , size, NULL, (fn_key_accessor *)asset_path_key_accessor, NULL);
+    dict_construct(&p_asset_cache->p_hashes, size, NULL, (fn_key_accessor *)asset_key_accessor, NULL);
+    dict_construct(&p_asset_cache->p_values, size, NULL, (fn_key_accessor *)asset_value_key_accessor, NULL);
+
+    // return a pointer to the caller
+    *pp_asset_cache = p_asset_cache;
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_asset_cache:
+                #ifndef NDEBUG
+                    log_error("[g10] [asset] Null pointer provided for parameter \"pp_asset_cache\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_name:
+                #ifndef NDEBUG
+                    log_error("[g10] [asset] Null pointer provided for parameter \"_name\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_load:
+                #ifndef NDEBUG
+                    log_error("[g10] [asset] Null pointer provided for parameter \"pfn_load\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+u64 asset_hash ( const void *p_data, size_t size )
+{
+
+    // initialized data
+    const u8 *p_bytes = p_data;
+    u64 hash = ASSET_FNV_OFFSET;
+
+    // fnv-1a
+    for (size_t i = 0; i < size; i++)
+        hash ^= p_bytes[i],
+        hash *= ASSET_FNV_PRIME;
+
+    // done
+    return hash;
+}
+
+int asset_cache_acquire ( asset_cache *p_asset_cache, const char *p_path, void **pp_value )
+{
+
+    // argument check
+    if ( NULL == p_asset_cache ) goto no_asset_cache;
+    if ( NULL ==        p_path ) goto no_path;
+    if ( NULL ==      pp_value ) goto no_value;
+
+    // initialized data
+    asset_path *p_asset_path = NULL;
+    asset      *p_asset      = NULL;
+    const void *p_data       = NULL;
+    char        _hash[16+1]  = { 0 };
+    size_t      size         = 0;
+    u64         hash         = 0;
+
+    // path hit -> no disk access
+    dict_get(p_asset_cache->p_paths, p_path, (void **)&p_asset_path);
+
+    if ( p_asset_path && p_asset_path->p_asset->p_value )
+    {
+
+        // store the asset
+        p_asset = p_asset_path->p_asset;
+
+        // count the hit
+        p_asset_cache->metrics.path_hits++;
+
+        goto done;
+    }
+
+    // map the file
+    p_data = map_file(p_path, &size);
+
+    // error check
+    if ( NULL == p_data ) goto failed_to_load_file;
+
+    // hash the contents
+    hash = asset_hash(p_data, size);
+    snprintf(_hash, sizeof(_hash), "%016llx", (unsigned long long) hash);
+
+    // content hit -> share the asset under a new path
+    dict_get(p_asset_cache->p_hashes, _hash, (void **)&p_asset);
+
+    if ( p_asset && p_asset->p_value )
+    {
+
+        // count the hit
+        p_asset_cache->metrics.hash_hits++;
+
+        goto add_path;
+    }
+
+    // first use of this content
+    if ( NULL == p_asset )
+    {
+
+        // allocate an asset
+        p_asset = default_allocator(0, sizeof(asset));
+
+        // error check
+        if ( NULL == p_asset ) goto no_mem;
+
+        // populate the asset
+        *p_asset = (asset) { .hash = hash };
+        memcpy(p_asset->_hash, _hash, sizeof(_hash));
+
+        // add the asset to the content lookup
+        dict_add(p_asset_cache->p_hashes, p_asset);
+    }
+
+    // construct the asset
+    if ( 0 == p_asset_cache->pfn_load(&p_asset->p_value, p_path, p_data, size) ) goto failed_to_construct_asset;
+
+    // store the size
+    p_asset->size       = size,
+    p_asset->references = 0;
+
+    // add the asset to the value lookup, for release
+    asset_value_key(p_asset->_value, p_asset->p_value);
+    dict_add(p_asset_cache->p_values, p_asset);
+
+    // count the load
+    p_asset_cache->metrics.loads++,
+    p_asset_cache->metrics.bytes += size;
+
+    add_path:
+
+    // the path was released and reloaded
+    if ( p_asset_path )
+        p_asset_path->p_asset = p_asset;
+
+    // first use of this path
+    else
+    {
+
+        // allocate an asset path
+        p_asset_path = default_allocator(0, sizeof(asset_path));
+
+        // error check
+        if ( NULL == p_asset_path ) goto no_mem;
+
+        // populate the asset path
+        *p_asset_path = (asset_path) { .p_asset = p_asset };
+        strncpy(p_asset_path->_path, p_path, sizeof(p_asset_path->_path) - 1);
+
+        // add the asset path to the path lookup
+        dict_add(p_asset_cache->p_paths, p_asset_path);
+    }
+
+    // unmap the contents
+    unmap_file(p_data, size);
+
+    done:
+
+    // count the reference
+    p_asset->references++;
+
+    // return a pointer to the caller
+    *pp_value = p_asset->p_value;
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_asset_cache:
+                #ifndef NDEBUG
+                    log_error("[g10] [asset] Null pointer provided for parameter \"p_asset_cache\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_path:
+                #ifndef NDEBUG
+                    log_error("[g10] [asset] Null pointer provided for parameter \"p_path\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_value:
+                #ifndef NDEBUG
+                    log_error("[g10] [asset] Null pointer provided for parameter \"pp_value\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // file errors
+        {
+            failed_to_load_file:
+                #ifndef NDEBUG
+                    log_error("[g10] [asset] Failed to load file \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+        }
+
+        // asset errors
+        {
+            failed_to_construct_asset:
+                #ifndef NDEBUG
+                    log_error("[g10] [asset] Failed to construct %s asset from \"%s\" in call to function \"%s\"\n", p_asset_cache->_name, p_path, __FUNCTION__);
+                #endif
+
+                // unmap the contents
+                unmap_file(p_data, size);
+
+                // error
+                return 0;
+        }
+
+        // standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // unmap the contents
+                if ( p_data ) unmap_file(p_data, size);
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int asset_cache_release ( asset_cache *p_asset_cache, void *p_value )
+{
+
+    // argument check
+    if ( NULL == p_asset_cache ) goto no_asset_cache;
+    if ( NULL ==       p_value ) goto no_value;
+
+    // initialized data
+    asset *p_asset = NULL;
+    char   _key[16+1] = { 0 };
+
+    // find the asset
+    asset_value_key(_key, p_value);
+    dict_get(p_asset_cache->p_values, _key, (void **)&p_asset);
+
+    // not in this cache
+    if ( NULL == p_asset ) return 0;
+
+    // drop the reference
+    if ( p_asset->references ) p_asset->references--;
+
+    // still referenced
+    if ( p_asset->references ) return 1;
+
+    // release the asset. the lookups keep the entry, so the next acquire reloads it
+    if ( p_asset_cache->pfn_release )
+    {
+        dict_pop(p_asset_cache->p_values, p_asset->_value, NULL);
+        p_asset_cache->pfn_release(p_asset->p_value);
+        p_asset->p_value = NULL;
+        p_asset_cache->metrics.releases++;
+        p_asset_cache->metrics.bytes -= p_asset->size;
+    }
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_asset_cache:
+                #ifndef NDEBUG
+                    log_error("[g10] [asset] Null pointer provided for parameter \"p_asset_cache\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_value:
+                #ifndef NDEBUG
+                    log_error("[g10] [asset] Null pointer provided for parameter \"p_value\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int asset_cache_info ( asset_cache *p_asset_cache )
+{
+
+    // argument check
+    if ( NULL == p_asset_cache ) goto no_asset_cache;
+
+    // initialized data
+    size_t paths  = 0,
+           unique = 0;
+
+    // count the paths and unique assets
+    dict_size(p_asset_cache->p_paths, &paths);
+    dict_size(p_asset_cache->p_hashes, &unique);
+
+    // print the cache
+    logger_pad(), log_info("Asset cache %s @%p\n", p_asset_cache->_name, p_asset_cache),
+    logger_push(),
+    logger_pad(), printf("paths     - %zu\n", paths),
+    logger_pad(), printf("unique    - %zu\n", unique),
+    logger_pad(), printf("path hits - %zu\n", p_asset_cache->metrics.path_hits),
+    logger_pad(), printf("hash hits - %zu\n", p_asset_cache->metrics.hash_hits),
+    logger_pad(), printf("loads     - %zu\n", p_asset_cache->metrics.loads),
+    logger_pad(), printf("releases  - %zu\n", p_asset_cache->metrics.releases),
+    logger_pad(), printf("bytes     - %zu\n", p_asset_cache->metrics.bytes),
+    logger_pop();
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_asset_cache:
+                #ifndef NDEBUG
+                    log_error("[g10] [asset] Null pointer provided for parameter \"p_asset_cache\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
@@ -1,6 +1,19 @@
 // header
 #include <g10.h>
+
+// standard library
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// g10
 #include <input.h>
+#include <asset_cache.h>
+#include <material.h>
+#include <job.h>
+#include <schedule.h>
+#include <user_code.h>
 
 // data
 static int logger_depth = 0;
@@ -58,6 +71,9 @@ int g_init
     dict_construct(&p_instance->cache.p_pipeline, 64, NULL, (fn_key_accessor *)pipeline_key_accessor, NULL);
     dict_construct(&p_instance->cache.p_texture, 64, NULL, (fn_key_accessor *)texture_key_accessor, NULL);
     dict_construct(&p_instance->cache.p_geometry, 64, NULL, (fn_key_accessor *)geometry_key_accessor, NULL);
+    asset_cache_construct(&p_instance->cache.p_geometry_files, "geometry", 64, (fn_asset_load *)geometry_load, (fn_asset_release *)geometry_release);
+    asset_cache_construct(&p_instance->cache.p_material_files, "material", 64, (fn_asset_load *)material_load, (fn_asset_release *)material_release);
+    asset_cache_construct(&p_instance->cache.p_texture_files , "texture" , 64, (fn_asset_load *)texture_load , (fn_asset_release *)texture_release);
 
     // parse the json value into an instance
     {
@@ -72,7 +88,9 @@ int g_init
                    *p_vulkan          = NULL,
                    *p_scene           = NULL,
                    *p_input           = NULL,
-                   *p_window          = NULL;
+                   *p_window          = NULL,
+                   *p_backend         = NULL,
+                   *p_workers         = NULL;
     
         dict_get(p_dict, "name"           , (void **)&p_name_value);
         dict_get(p_dict, "version"        , (void **)&p_version);
@@ -83,6 +101,8 @@ int g_init
         dict_get(p_dict, "scene"          , (void **)&p_scene);
         dict_get(p_dict, "input"          , (void **)&p_input);
         dict_get(p_dict, "window"         , (void **)&p_window);
+        dict_get(p_dict, "backend"        , (void **)&p_backend);
+        dict_get(p_dict, "workers"        , (void **)&p_workers);
 
                 
         // store the name
@@ -147,6 +167,60 @@ int g_init
             p_instance->version.major = (u16)0,
             p_instance->version.patch = (u16)0;
 
+        // store the backend
+        if ( p_backend )
+        {
+
+            // error check
+            if ( p_backend->type != JSON_VALUE_STRING ) goto backend_property_is_wrong_type;
+
+            // store the backend
+            p_instance->backend = command_backend_from_string(p_backend->string);
+
+            // error check
+            if ( G10_BACKEND_QTY == p_instance->backend ) goto unknown_backend;
+        }
+
+        // default to sdl3
+        else
+            p_instance->backend = G10_BACKEND_SDL3;
+
+        // store the fixed tick rate
+        if ( p_fixed_tick_rate )
+        {
+
+            // error check
+            if ( p_fixed_tick_rate->type    != JSON_VALUE_INTEGER ) goto fixed_tick_rate_is_wrong_type;
+            if ( p_fixed_tick_rate->integer <  0 || p_fixed_tick_rate->integer > UINT16_MAX ) goto fixed_tick_rate_is_wrong_type;
+
+            // store the tick rate
+            p_instance->context.fixed_tick_rate = (u16) p_fixed_tick_rate->integer;
+        }
+
+        // default to one tick per frame
+        else
+            p_instance->context.fixed_tick_rate = 0;
+
+        // nothing simulated yet
+        p_instance->context.delta_time    = 0.f,
+        p_instance->context.interpolation = 1.f;
+
+        // start the job system. 0 workers is one per processor, less this thread
+        if ( p_workers )
+        {
+
+            // error check
+            if ( p_workers->type    != JSON_VALUE_INTEGER ) goto workers_property_is_wrong_type;
+            if ( p_workers->integer <  0                  ) goto workers_property_is_wrong_type;
+
+            // start the workers
+            job_init((size_t) p_workers->integer);
+        }
+
+        // default to one per processor
+        else
+            job_init(0);
+
         // initialize window system integration
         #ifdef G10_BUILD_WITH_SDL3
 
@@ -187,6 +261,21 @@ int g_init
 
         // load a scene
         scene_from_json(&p_instance->context.p_scene, p_scene);
+
+        // register the engine systems. render writes the world matrices and
+        // the bounds, which it updates before it gathers the draws
+        schedule_system_register("input"    , poll_input     , 0              , SCHEDULE_INPUT                                              , SCHEDULE_MAIN_THREAD);
+        schedule_system_register("user code", user_code      , SCHEDULE_INPUT , SCHEDULE_CAMERA | SCHEDULE_TRANSFORMS                       , SCHEDULE_MAIN_THREAD);
+        schedule_system_register("render"   , renderer_render, SCHEDULE_CAMERA, SCHEDULE_TRANSFORMS | SCHEDULE_BOUNDS | SCHEDULE_DRAW_LISTS, SCHEDULE_MAIN_THREAD);
+
+        // construct the schedule
+        if ( p_schedule )
+        {
+            if ( 0 == schedule_from_json(&p_instance->p_schedule, p_schedule) ) goto failed_to_load_schedule_from_json_value;
+        }
+
+        // input, then user code, then render
+        else if ( 0 == schedule_default(&p_instance->p_schedule) ) goto failed_to_load_schedule_from_json_value;
     }
 
     srand(time(NULL));
@@ -269,6 +358,15 @@ int g_init
                 // error
                 goto error_after_json_parsed;
 
+            workers_property_is_wrong_type:
+                #ifndef NDEBUG
+                    log_error("[g10] Property \"workers\" must be a non negative integer in call to function \"%s\"\n", __FUNCTION__);
+                    log_info("\tRefer to gschema: https://schema.g10.app/instance.json\n");
+                #endif
+
+                // error
+                goto error_after_json_parsed;
+
             missing_version_properties:
                 #ifndef NDEBUG
                     log_error("[g10] \"version\" property is missing required properties in call to function \"%s\"\n", __FUNCTION__);
@@ -332,6 +430,24 @@ int g_init
                 // error
                 goto error_after_json_parsed;
 
+            backend_property_is_wrong_type:
+                #ifndef NDEBUG
+                    log_error("[g10] \"backend\" property of instance object must be of type [ string ] in call to function \"%s\"\n", __FUNCTION__);
+                    log_info("\tRefer to gschema: https://schema.g10.app/instance.json\n");
+                #endif
+
+                // error
+                goto error_after_json_parsed;
+
+            unknown_backend:
+                #ifndef NDEBUG
+                    log_error("[g10] \"backend\" property of instance object must be one of [ \"sdl3\", \"null\" ] in call to function \"%s\"\n", __FUNCTION__);
+                    log_info("\tRefer to gschema: https://schema.g10.app/instance.json\n");
+                #endif
+
+                // error
+                goto error_after_json_parsed;
+
             wrong_version_type:
                 #ifndef NDEBUG
                     log_error("[g10] \"version\" property of instance object must be of type [ object ] in call to function \"%s\"\n", __FUNCTION__);
@@ -630,6 +746,97 @@ size_t load_file ( const char *path, void *buffer, bool binary_mode )
     }
 }
 
+const void *map_file ( const char *path, size_t *p_size )
+{
+
+    // argument checking
+    if ( path   == 0 ) goto no_path;
+    if ( p_size == 0 ) goto no_size;
+
+    // initialized data
+    struct stat _stat = { 0 };
+    void *p_data = 0;
+    int fd = open(path, O_RDONLY);
+
+    // check if file is valid
+    if ( fd == -1 ) goto invalid_file;
+
+    // find file size
+    if ( fstat(fd, &_stat) == -1 || _stat.st_size == 0 ) goto empty_file;
+
+    // map the file
+    p_data = mmap(0, (size_t) _stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // the descriptor is no longer needed
+    close(fd);
+
+    // error check
+    if ( p_data == MAP_FAILED ) goto failed_to_map_file;
+
+    // return the size to the caller
+    *p_size = (size_t) _stat.st_size;
+
+    // success
+    return p_data;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_path:
+                #ifndef NDEBUG
+                    log_error("Null pointer provided for parameter \"path\" in call to function \"%s\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_size:
+                #ifndef NDEBUG
+                    log_error("Null pointer provided for parameter \"p_size\" in call to function \"%s\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // file errors
+        {
+            invalid_file:
+
+                // error
+                return 0;
+
+            empty_file:
+
+                // release the descriptor
+                close(fd);
+
+                // error
+                return 0;
+
+            failed_to_map_file:
+                #ifndef NDEBUG
+                    log_error("Failed to map file \"%s\" in call to function \"%s\n", path, __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int unmap_file ( const void *p_data, size_t size )
+{
+
+    // argument checking
+    if ( p_data == 0 ) return 0;
+
+    // done
+    return munmap((void *) p_data, size) == 0;
+}
+
 int instance_info ( g_instance *p_instance )
 {
 
@@ -642,6 +849,7 @@ int instance_info ( g_instance *p_instance )
     logger_push(),
     logger_pad(), printf("name    - %s\n", p_instance->_name),
     logger_pad(), printf("running - %s\n", p_instance->running ? "true" : "false"),
+    logger_pad(), printf("backend - %s\n", command_backend_name(p_instance->backend)),
     logger_pad(), printf("version - %u.%u.%u\n", 
         p_instance->version.major,
         p_instance->version.minor, 
@@ -651,6 +859,9 @@ int instance_info ( g_instance *p_instance )
         p_instance->window.height, 
         p_instance->window.title
     ),
+    logger_pad(), printf("workers - %zu\n", job_worker_count()),
+    logger_pad(), printf("ticks   - %u Hz\n", p_instance->context.fixed_tick_rate),
+    schedule_info(p_instance->p_schedule),
     
     logger_pad(), printf("input: \n"),
     logger_push(),
@@ -667,6 +878,13 @@ int instance_info ( g_instance *p_instance )
     scene_info(p_instance->context.p_scene),
     logger_pop(),
 
+    logger_pad(), printf("assets: \n"),
+    logger_push(),
+    asset_cache_info(p_instance->cache.p_geometry_files),
+    asset_cache_info(p_instance->cache.p_material_files),
+    asset_cache_info(p_instance->cache.p_texture_files),
+    logger_pop(),
+
     logger_pop();
     
     // success
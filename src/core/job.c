@@ -0,0 +1,1038 @@
+/** !
+ * Jobs on a pool of work stealing worker threads
+ *
+ * @file src/core/job.c
+ *
+ * @author Jacob Smith
+ */
+
+// header
+#include <job.h>
+
+// g10
+#include <linear.h>
+
+// standard library
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+// preprocessor definitions
+#define JOB_SPIN 256 // failed attempts to find a job before a worker sleeps
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <immintrin.h>
+    #define JOB_PAUSE() _mm_pause()
+#else
+    #define JOB_PAUSE() ((void) 0)
+#endif
+
+// structure definitions
+struct job_s
+{
+    fn_job       *pfn_job;
+    fn_job_range *pfn_range;
+    void         *p_context;
+    size_t        begin, end, grain;
+    job_counter  *p_counter;
+    struct job_s *p_next; // free list, waiter list, or shared queue
+    s32           owner;  // the thread that allocated the job, or -1 for the heap
+};
+
+// a block of jobs
+struct job_block_s
+{
+    struct job_block_s *p_next;
+    job                 _jobs[JOB_BLOCK];
+};
+
+// the queue and job pool of one thread
+typedef struct
+{
+
+    // chase lev deque. the owner pushes and pops the bottom, thieves take
+    // the top
+    _Alignas(64) _Atomic(s64) top;
+    _Alignas(64) _Atomic(s64) bottom;
+    _Atomic(job *) _ring[JOB_DEQUE_MAX];
+
+    // free jobs, and the jobs of this thread that other threads finished
+    _Alignas(64) job *p_free;
+    _Atomic(job *)    p_returned;
+    struct job_block_s *p_blocks;
+} job_thread;
+
+// data
+static job_thread _threads[JOB_WORKERS_MAX + 1];
+
+static struct
+{
+    pthread_t       _threads[JOB_WORKERS_MAX];
+    size_t          workers;
+    _Atomic(bool)   running;
+
+    // one initializer at a time
+    pthread_mutex_t init;
+
+    // jobs queued on any thread, and the idle workers
+    _Atomic(s64)    queued;
+    atomic_size_t   sleeping;
+    pthread_mutex_t lock;
+    pthread_cond_t  wake;
+    bool            quit;
+
+    // jobs from threads without a queue, or from full queues
+    pthread_mutex_t shared;
+    job            *p_head,
+                   *p_tail;
+    atomic_size_t   shared_count;
+} _job =
+{
+    .init   = PTHREAD_MUTEX_INITIALIZER,
+    .lock   = PTHREAD_MUTEX_INITIALIZER,
+    .wake   = PTHREAD_COND_INITIALIZER,
+    .shared = PTHREAD_MUTEX_INITIALIZER
+};
+
+// the queue of this thread, or -1 for threads without one
+static _Thread_local s32 _index = -1;
+
+// function definitions
+/** !
+ * Push a job on the bottom of the deque of this thread
+ *
+ * @param p_thread the thread
+ * @param p_job    the job
+ *
+ * @return 1 on success, 0 if the deque is full
+ */
+static int job_deque_push ( job_thread *p_thread, job *p_job )
+{
+
+    // initialized data
+    s64 b = atomic_load_explicit(&p_thread->bottom, memory_order_relaxed),
+        t = atomic_load_explicit(&p_thread->top, memory_order_acquire);
+
+    // full
+    if ( b - t >= JOB_DEQUE_MAX ) return 0;
+
+    // store the job, then publish it
+    atomic_store_explicit(&p_thread->_ring[b % JOB_DEQUE_MAX], p_job, memory_order_relaxed);
+    atomic_store_explicit(&p_thread->bottom, b + 1, memory_order_release);
+
+    // success
+    return 1;
+}
+
+/** !
+ * Pop the newest job from the bottom of the deque of this thread
+ *
+ * @param p_thread the thread
+ *
+ * @return the job, or null if the deque is empty
+ */
+static job *job_deque_pop ( job_thread *p_thread )
+{
+
+    // initialized data
+    s64 b = atomic_load_explicit(&p_thread->bottom, memory_order_relaxed) - 1,
+        t = 0;
+    job *p_job = (void *) 0;
+
+    // claim the bottom before looking at the top
+    atomic_store_explicit(&p_thread->bottom, b, memory_order_seq_cst);
+    t = atomic_load_explicit(&p_thread->top, memory_order_seq_cst);
+
+    // empty
+    if ( t > b )
+    {
+        atomic_store_explicit(&p_thread->bottom, b + 1, memory_order_relaxed);
+
+        return (void *) 0;
+    }
+
+    // take the job
+    p_job = atomic_load_explicit(&p_thread->_ring[b % JOB_DEQUE_MAX], memory_order_relaxed);
+
+    // the last job. race the thieves for it
+    if ( t == b )
+    {
+        if ( !atomic_compare_exchange_strong_explicit(&p_thread->top, &t, t + 1, memory_order_seq_cst, memory_order_relaxed) ) p_job = (void *) 0;
+
+        atomic_store_explicit(&p_thread->bottom, b + 1, memory_order_relaxed);
+    }
+
+    // done
+    return p_job;
+}
+
+/** !
+ * Steal the oldest job from the top of the deque of another thread
+ *
+ * @param p_thread the victim
+ *
+ * @return the job, or null if the deque is empty or another thief won
+ */
+static job *job_deque_steal ( job_thread *p_thread )
+{
+
+    // initialized data
+    s64 t = atomic_load_explicit(&p_thread->top, memory_order_seq_cst),
+        b = atomic_load_explicit(&p_thread->bottom, memory_order_seq_cst);
+    job *p_job = (void *) 0;
+
+    // empty
+    if ( t >= b ) return (void *) 0;
+
+    // read the job, then claim it
+    p_job = atomic_load_explicit(&p_thread->_ring[t % JOB_DEQUE_MAX], memory_order_relaxed);
+
+    if ( !atomic_compare_exchange_strong_explicit(&p_thread->top, &t, t + 1, memory_order_seq_cst, memory_order_relaxed) ) return (void *) 0;
+
+    // done
+    return p_job;
+}
+
+/** !
+ * Allocate a job from the pool of this thread
+ *
+ * @return the job, or null on error
+ */
+static job *job_alloc ( void )
+{
+
+    // initialized data
+    job_thread *p_thread = ( _index >= 0 ) ? &_threads[_index] : (void *) 0;
+    job *p_job = (void *) 0;
+
+    // threads without a pool use the heap
+    if ( p_thread == (void *) 0 )
+    {
+        p_job = default_allocator(0, sizeof(job));
+
+        if ( p_job ) p_job->owner = -1;
+
+        return p_job;
+    }
+
+    // take back the jobs other threads finished
+    if ( p_thread->p_free == (void *) 0 )
+        p_thread->p_free = atomic_exchange_explicit(&p_thread->p_returned, (void *) 0, memory_order_acquire);
+
+    // grow the pool
+    if ( p_thread->p_free == (void *) 0 )
+    {
+
+        // initialized data
+        struct job_block_s *p_block = default_allocator(0, sizeof(struct job_block_s));
+
+        // error check
+        if ( p_block == (void *) 0 ) return (void *) 0;
+
+        // link the jobs
+        for (size_t i = 0; i < JOB_BLOCK; i++)
+            p_block->_jobs[i].owner  = _index,
+            p_block->_jobs[i].p_next = ( i + 1 < JOB_BLOCK ) ? &p_block->_jobs[i + 1] : (void *) 0;
+
+        p_block->p_next    = p_thread->p_blocks,
+        p_thread->p_blocks = p_block,
+        p_thread->p_free   = &p_block->_jobs[0];
+    }
+
+    // pop a free job
+    p_job            = p_thread->p_free,
+    p_thread->p_free = p_job->p_next;
+
+    // done
+    return p_job;
+}
+
+/** !
+ * Return a job to the pool it came from
+ *
+ * @param p_job the job
+ *
+ * @return void
+ */
+static void job_free ( job *p_job )
+{
+
+    // initialized data
+    s32 owner = p_job->owner;
+
+    // heap
+    if ( owner < 0 )
+    {
+        default_allocator(p_job, 0);
+
+        return;
+    }
+
+    // this thread
+    if ( owner == _index )
+    {
+        p_job->p_next = _threads[owner].p_free,
+        _threads[owner].p_free = p_job;
+
+        return;
+    }
+
+    // another thread
+    {
+
+        // initialized data
+        job *p_head = atomic_load_explicit(&_threads[owner].p_returned, memory_order_relaxed);
+
+        do p_job->p_next = p_head;
+        while ( !atomic_compare_exchange_weak_explicit(&_threads[owner].p_returned, &p_head, p_job, memory_order_release, memory_order_relaxed) );
+    }
+}
+
+/** !
+ * Queue a job, and wake a worker if one is asleep
+ *
+ * @param p_job the job
+ *
+ * @return void
+ */
+static void job_push ( job *p_job )
+{
+
+    // the deque of this thread
+    if ( _index < 0 || 0 == job_deque_push(&_threads[_index], p_job) )
+    {
+
+        // the shared queue
+        p_job->p_next = (void *) 0;
+
+        pthread_mutex_lock(&_job.shared);
+        if ( _job.p_tail ) _job.p_tail->p_next = p_job;
+        else               _job.p_head = p_job;
+        _job.p_tail = p_job;
+        atomic_fetch_add_explicit(&_job.shared_count, 1, memory_order_relaxed);
+        pthread_mutex_unlock(&_job.shared);
+    }
+
+    // count the job before looking for sleepers, so a worker about to
+    // sleep sees it
+    atomic_fetch_add_explicit(&_job.queued, 1, memory_order_seq_cst);
+
+    // wake a worker
+    if ( atomic_load_explicit(&_job.sleeping, memory_order_seq_cst) )
+        pthread_mutex_lock(&_job.lock),
+        pthread_cond_signal(&_job.wake),
+        pthread_mutex_unlock(&_job.lock);
+}
+
+/** !
+ * Find a job. The deque of this thread first, then the shared queue, then
+ * the other threads, starting at a random one.
+ *
+ * @return the job, or null if none was found
+ */
+static job *job_take ( void )
+{
+
+    // initialized data
+    job *p_job = (void *) 0;
+    size_t threads = _job.workers + 1;
+
+    // this thread
+    if ( _index >= 0 ) p_job = job_deque_pop(&_threads[_index]);
+
+    // the shared queue
+    if ( p_job == (void *) 0 && atomic_load_explicit(&_job.shared_count, memory_order_relaxed) )
+    {
+        pthread_mutex_lock(&_job.shared);
+        if ( ( p_job = _job.p_head ) )
+        {
+            _job.p_head = p_job->p_next;
+            if ( _job.p_head == (void *) 0 ) _job.p_tail = (void *) 0;
+            atomic_fetch_sub_explicit(&_job.shared_count, 1, memory_order_relaxed);
+        }
+        pthread_mutex_unlock(&_job.shared);
+    }
+
+    // steal
+    if ( p_job == (void *) 0 )
+    {
+
+        // initialized data
+        static _Thread_local u32 seed = 0;
+        size_t start = 0;
+
+        // xorshift
+        if ( seed == 0 ) seed = (u32) ( _index + 2 ) * 2654435761u;
+        seed ^= seed << 13, seed ^= seed >> 17, seed ^= seed << 5;
+
+        start = seed % threads;
+
+        for (size_t i = 0; i < threads && p_job == (void *) 0; i++)
+        {
+
+            // initialized data
+            size_t victim = ( start + i ) % threads;
+
+            if ( (s32) victim == _index ) continue;
+
+            p_job = job_deque_steal(&_threads[victim]);
+        }
+    }
+
+    // one less job queued
+    if ( p_job ) atomic_fetch_sub_explicit(&_job.queued, 1, memory_order_relaxed);
+
+    // done
+    return p_job;
+}
+
+/** !
+ * Finish one job of a group. The last job releases the jobs waiting on
+ * the group.
+ *
+ * @param p_counter the group, or null
+ *
+ * @return void
+ */
+static void job_counter_finish ( job_counter *p_counter )
+{
+
+    // no group
+    if ( p_counter == (void *) 0 ) return;
+
+    // keep waiters from returning until this thread is done with the counter
+    atomic_fetch_add_explicit(&p_counter->_releasing, 1, memory_order_seq_cst);
+
+    // the last job of the group
+    if ( atomic_fetch_sub_explicit(&p_counter->pending, 1, memory_order_seq_cst) == 1 )
+    {
+
+        // initialized data
+        job *p_waiter = atomic_exchange_explicit(&p_counter->_p_waiters, (void *) 0, memory_order_seq_cst);
+
+        // queue each dependent job
+        while ( p_waiter )
+        {
+
+            // initialized data
+            job *p_next = p_waiter->p_next;
+
+            job_push(p_waiter);
+
+            p_waiter = p_next;
+        }
+    }
+
+    // done with the counter
+    atomic_fetch_sub_explicit(&p_counter->_releasing, 1, memory_order_release);
+}
+
+/** !
+ * Run a job, and return it to its pool
+ *
+ * @param p_job the job
+ *
+ * @return void
+ */
+static void job_run ( job *p_job )
+{
+
+    // initialized data
+    job_counter *p_counter = p_job->p_counter;
+
+    // a range
+    if ( p_job->pfn_range )
+    {
+
+        // queue the upper half until one grain is left
+        while ( p_job->end - p_job->begin > p_job->grain )
+        {
+
+            // initialized data
+            size_t mid = p_job->begin + ( p_job->end - p_job->begin ) / 2;
+            job *p_half = job_alloc();
+
+            // run the rest here
+            if ( p_half == (void *) 0 ) break;
+
+            *p_half = (job)
+            {
+                .pfn_range = p_job->pfn_range,
+                .p_context = p_job->p_context,
+                .begin     = mid,
+                .end       = p_job->end,
+                .grain     = p_job->grain,
+                .p_counter = p_counter,
+                .owner     = p_half->owner
+            };
+
+            atomic_fetch_add_explicit(&p_counter->pending, 1, memory_order_relaxed);
+            job_push(p_half);
+
+            p_job->end = mid;
+        }
+
+        p_job->pfn_range(p_job->p_context, p_job->begin, p_job->end);
+    }
+
+    // a job
+    else p_job->pfn_job(p_job->p_context);
+
+    // release the job, then finish it
+    job_free(p_job);
+    job_counter_finish(p_counter);
+}
+
+/** !
+ * Worker thread entry point. Runs jobs, and sleeps when there are none.
+ *
+ * @param p_parameter the index of the thread
+ *
+ * @return null
+ */
+static void *job_worker ( void *p_parameter )
+{
+
+    // initialized data
+    size_t idle = 0;
+
+    // this thread has a queue
+    _index = (s32) (size_t) p_parameter;
+
+    for (;;)
+    {
+
+        // initialized data
+        job *p_job = job_take();
+
+        // work
+        if ( p_job )
+        {
+            job_run(p_job);
+
+            idle = 0;
+
+            continue;
+        }
+
+        // spin a while
+        if ( ++idle < JOB_SPIN )
+        {
+            JOB_PAUSE();
+
+            continue;
+        }
+
+        // sleep until a job is queued
+        pthread_mutex_lock(&_job.lock);
+        atomic_fetch_add_explicit(&_job.sleeping, 1, memory_order_seq_cst);
+        while ( atomic_load_explicit(&_job.queued, memory_order_seq_cst) <= 0 && _job.quit == false ) pthread_cond_wait(&_job.wake, &_job.lock);
+        atomic_fetch_sub_explicit(&_job.sleeping, 1, memory_order_relaxed);
+
+        // done
+        if ( _job.quit )
+        {
+            pthread_mutex_unlock(&_job.lock);
+
+            break;
+        }
+        pthread_mutex_unlock(&_job.lock);
+
+        idle = 0;
+    }
+
+    // done
+    return NULL;
+}
+
+int job_init ( size_t workers )
+{
+
+    // initialized data
+    size_t started = 0;
+
+    // already running
+    if ( atomic_load_explicit(&_job.running, memory_order_acquire) ) return 1;
+
+    // one initializer at a time
+    pthread_mutex_lock(&_job.init);
+
+    // another thread won
+    if ( atomic_load_explicit(&_job.running, memory_order_relaxed) )
+    {
+        pthread_mutex_unlock(&_job.init);
+
+        return 1;
+    }
+
+    // default to one worker per processor, less the calling thread
+    if ( workers == 0 )
+    {
+
+        // initialized data
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+
+        workers = ( online > 1 ) ? (size_t) online - 1 : 0;
+    }
+
+    // clamp
+    if ( workers > JOB_WORKERS_MAX ) workers = JOB_WORKERS_MAX;
+
+    // resolve the linear kernels once, before the workers share the table
+    linear_isa_get();
+
+    // the calling thread has the first queue
+    _index = 0;
+
+    // start the workers
+    _job.quit    = false,
+    _job.workers = workers;
+
+    for (started = 0; started < workers; started++)
+        if ( pthread_create(&_job._threads[started], NULL, job_worker, (void *) ( started + 1 )) ) goto failed_to_create_thread;
+
+    // running
+    atomic_store_explicit(&_job.running, true, memory_order_release);
+
+    pthread_mutex_unlock(&_job.init);
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // pthread errors
+        {
+            failed_to_create_thread:
+                #ifndef NDEBUG
+                    log_error("[g10] [job] Failed to create worker thread in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // stop the workers that started, and run jobs on the calling thread
+                pthread_mutex_lock(&_job.lock);
+                _job.quit = true;
+                pthread_cond_broadcast(&_job.wake);
+                pthread_mutex_unlock(&_job.lock);
+
+                for (size_t i = 0; i < started; i++) pthread_join(_job._threads[i], NULL);
+
+                _job.quit    = false,
+                _job.workers = 0;
+                atomic_store_explicit(&_job.running, true, memory_order_release);
+
+                pthread_mutex_unlock(&_job.init);
+
+                // error
+                return 0;
+        }
+    }
+}
+
+size_t job_worker_count ( void )
+{
+
+    // done
+    return _job.workers;
+}
+
+int job_submit ( fn_job *pfn_job, void *p_context, job_counter *p_counter )
+{
+
+    // argument check
+    if ( pfn_job == (void *) 0 ) goto no_job;
+
+    // initialized data
+    job *p_job = (void *) 0;
+
+    // start the workers
+    job_init(0);
+
+    // nothing to run it on
+    if ( _job.workers == 0 )
+    {
+        pfn_job(p_context);
+
+        // success
+        return 1;
+    }
+
+    // allocate a job
+    p_job = job_alloc();
+
+    // error check
+    if ( p_job == (void *) 0 ) goto no_mem;
+
+    *p_job = (job)
+    {
+        .pfn_job   = pfn_job,
+        .p_context = p_context,
+        .p_counter = p_counter,
+        .owner     = p_job->owner
+    };
+
+    // one more job in the group
+    if ( p_counter ) atomic_fetch_add_explicit(&p_counter->pending, 1, memory_order_relaxed);
+
+    // queue the job
+    job_push(p_job);
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_job:
+                #ifndef NDEBUG
+                    log_error("[g10] [job] Null pointer provided for parameter \"pfn_job\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int job_submit_after ( fn_job *pfn_job, void *p_context, job_counter *p_counter, job_counter *p_dependency )
+{
+
+    // argument check
+    if ( pfn_job      == (void *) 0 ) goto no_job;
+    if ( p_dependency == (void *) 0 ) goto no_dependency;
+
+    // initialized data
+    job *p_job = (void *) 0;
+
+    // start the workers
+    job_init(0);
+
+    // allocate a job
+    p_job = job_alloc();
+
+    // error check
+    if ( p_job == (void *) 0 ) goto no_mem;
+
+    *p_job = (job)
+    {
+        .pfn_job   = pfn_job,
+        .p_context = p_context,
+        .p_counter = p_counter,
+        .owner     = p_job->owner
+    };
+
+    // one more job in the group
+    if ( p_counter ) atomic_fetch_add_explicit(&p_counter->pending, 1, memory_order_relaxed);
+
+    // keep waiters on the dependency from returning while it is in use
+    atomic_fetch_add_explicit(&p_dependency->_releasing, 1, memory_order_seq_cst);
+
+    // wait on the dependency
+    {
+
+        // initialized data
+        job *p_head = atomic_load_explicit(&p_dependency->_p_waiters, memory_order_relaxed);
+
+        do p_job->p_next = p_head;
+        while ( !atomic_compare_exchange_weak_explicit(&p_dependency->_p_waiters, &p_head, p_job, memory_order_seq_cst, memory_order_relaxed) );
+    }
+
+    // the dependency finished before it saw this job, so queue the waiters
+    if ( atomic_load_explicit(&p_dependency->pending, memory_order_seq_cst) == 0 )
+    {
+
+        // initialized data
+        job *p_waiter = atomic_exchange_explicit(&p_dependency->_p_waiters, (void *) 0, memory_order_seq_cst);
+
+        while ( p_waiter )
+        {
+
+            // initialized data
+            job *p_next = p_waiter->p_next;
+
+            job_push(p_waiter);
+
+            p_waiter = p_next;
+        }
+    }
+
+    // done with the dependency
+    atomic_fetch_sub_explicit(&p_dependency->_releasing, 1, memory_order_release);
+
+    // with no workers, run it now
+    if ( _job.workers == 0 )
+        while ( ( p_job = job_take() ) ) job_run(p_job);
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_job:
+                #ifndef NDEBUG
+                    log_error("[g10] [job] Null pointer provided for parameter \"pfn_job\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_dependency:
+                #ifndef NDEBUG
+                    log_error("[g10] [job] Null pointer provided for parameter \"p_dependency\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int job_wait ( job_counter *p_counter )
+{
+
+    // argument check
+    if ( p_counter == (void *) 0 ) goto no_counter;
+
+    // initialized data
+    size_t idle = 0;
+
+    // help until the group is done, and no thread is still finishing it
+    while ( atomic_load_explicit(&p_counter->pending, memory_order_seq_cst) || atomic_load_explicit(&p_counter->_releasing, memory_order_seq_cst) )
+    {
+
+        // initialized data
+        job *p_job = job_take();
+
+        // work
+        if ( p_job )
+        {
+            job_run(p_job);
+
+            idle = 0;
+
+            continue;
+        }
+
+        // the last jobs are running on other threads
+        if ( ++idle < JOB_SPIN ) JOB_PAUSE();
+        else                     sched_yield();
+    }
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_counter:
+                #ifndef NDEBUG
+                    log_error("[g10] [job] Null pointer provided for parameter \"p_counter\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int job_parallel_for_async ( size_t count, size_t grain, fn_job_range *pfn_job, void *p_context, job_counter *p_counter )
+{
+
+    // argument check
+    if ( pfn_job   == (void *) 0 ) goto no_job;
+    if ( p_counter == (void *) 0 ) goto no_counter;
+
+    // initialized data
+    job *p_job = (void *) 0;
+
+    // nothing to do
+    if ( count == 0 ) return 1;
+
+    // default grain
+    if ( grain == 0 ) grain = 1;
+
+    // start the workers
+    job_init(0);
+
+    // allocate the root range
+    p_job = job_alloc();
+
+    // error check
+    if ( p_job == (void *) 0 ) goto no_mem;
+
+    *p_job = (job)
+    {
+        .pfn_range = pfn_job,
+        .p_context = p_context,
+        .begin     = 0,
+        .end       = count,
+        .grain     = grain,
+        .p_counter = p_counter,
+        .owner     = p_job->owner
+    };
+
+    // one more job in the group
+    atomic_fetch_add_explicit(&p_counter->pending, 1, memory_order_relaxed);
+
+    // queue the range
+    job_push(p_job);
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_job:
+                #ifndef NDEBUG
+                    log_error("[g10] [job] Null pointer provided for parameter \"pfn_job\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_counter:
+                #ifndef NDEBUG
+                    log_error("[g10] [job] Null pointer provided for parameter \"p_counter\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int job_parallel_for ( size_t count, size_t grain, fn_job_range *pfn_job, void *p_context )
+{
+
+    // argument check
+    if ( pfn_job == (void *) 0 ) goto no_job;
+
+    // initialized data
+    job_counter _counter = { 0 };
+
+    // nothing to do
+    if ( count == 0 ) return 1;
+
+    // default grain
+    if ( grain == 0 ) grain = 1;
+
+    // start the workers
+    job_init(0);
+
+    // run inline when there is one range, or no workers
+    if ( count <= grain || _job.workers == 0 )
+    {
+        pfn_job(p_context, 0, count);
+
+        // success
+        return 1;
+    }
+
+    // queue the range, and help run it
+    if ( 0 == job_parallel_for_async(count, grain, pfn_job, p_context, &_counter) ) return 0;
+
+    // done
+    return job_wait(&_counter);
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_job:
+                #ifndef NDEBUG
+                    log_error("[g10] [job] Null pointer provided for parameter \"pfn_job\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int job_quit ( void )
+{
+
+    // not running
+    if ( atomic_load_explicit(&_job.running, memory_order_acquire) == false ) return 1;
+
+    // wake the workers
+    pthread_mutex_lock(&_job.lock);
+    _job.quit = true;
+    pthread_cond_broadcast(&_job.wake);
+    pthread_mutex_unlock(&_job.lock);
+
+    // join the workers
+    for (size_t i = 0; i < _job.workers; i++) pthread_join(_job._threads[i], NULL);
+
+    // release the job pools
+    for (size_t i = 0; i <= _job.workers; i++)
+    {
+        while ( _threads[i].p_blocks )
+        {
+
+            // initialized data
+            struct job_block_s *p_next = _threads[i].p_blocks->p_next;
+
+            default_allocator(_threads[i].p_blocks, 0);
+
+            _threads[i].p_blocks = p_next;
+        }
+
+        _threads[i].p_free = (void *) 0;
+        atomic_store_explicit(&_threads[i].p_returned, (void *) 0, memory_order_relaxed);
+        atomic_store_explicit(&_threads[i].top, 0, memory_order_relaxed);
+        atomic_store_explicit(&_threads[i].bottom, 0, memory_order_relaxed);
+    }
+
+    // stopped
+    _job.workers = 0,
+    _index       = -1;
+    atomic_store_explicit(&_job.running, false, memory_order_release);
+
+    // success
+    return 1;
+}
@@ -0,0 +1,869 @@
+/** !
+ * Per frame system scheduler
+ *
+ * @file src/core/schedule.c
+ *
+ * @author Jacob Smith
+ */
+
+// header
+#include <schedule.h>
+
+// standard library
+#include <string.h>
+
+// g10
+#include <g10.h>
+#include <job.h>
+
+// enumeration definitions
+enum schedule_phase_e
+{
+    SCHEDULE_PHASE_BEFORE,
+    SCHEDULE_PHASE_TICK,
+    SCHEDULE_PHASE_AFTER
+};
+
+// data
+static schedule_system _systems[SCHEDULE_SYSTEMS_MAX] = { 0 };
+static size_t          _system_count = 0;
+static u64             _system_generation = 1;
+
+static const char *_resource_names[SCHEDULE_RESOURCE_QTY] =
+{
+    [0] = "input",
+    [1] = "transforms",
+    [2] = "bounds",
+    [3] = "camera",
+    [4] = "draw lists"
+};
+
+// function definitions
+/** !
+ * Parse a json array of resource names into a mask
+ *
+ * @param p_value the json array, or null
+ * @param p_mask  return
+ *
+ * @return 1 on success, 0 on error
+ */
+static int schedule_resources_from_json ( const json_value *p_value, u32 *p_mask )
+{
+
+    // initialized data
+    u32 mask = 0;
+    size_t len = 0;
+
+    // nothing
+    if ( p_value == (void *) 0 )
+    {
+        *p_mask = 0;
+
+        return 1;
+    }
+
+    // type check
+    if ( p_value->type != JSON_VALUE_ARRAY ) goto wrong_type;
+
+    // iterate through each name
+    len = array_size(p_value->list);
+
+    for (size_t i = 0; i < len; i++)
+    {
+
+        // initialized data
+        json_value *p_name = (void *) 0;
+        size_t j = 0;
+
+        // store the i'th element
+        array_index(p_value->list, (signed) i, (void **)&p_name);
+
+        // type check
+        if ( p_name == (void *) 0 || p_name->type != JSON_VALUE_STRING ) goto wrong_type;
+
+        // find the resource
+        for (j = 0; j < SCHEDULE_RESOURCE_QTY; j++)
+            if ( 0 == strcmp(p_name->string, _resource_names[j]) ) break;
+
+        // error check
+        if ( j == SCHEDULE_RESOURCE_QTY ) goto unknown_resource;
+
+        mask |= 1u << j;
+    }
+
+    // return the mask to the caller
+    *p_mask = mask;
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // g10 errors
+        {
+            wrong_type:
+                #ifndef NDEBUG
+                    log_error("[g10] [schedule] \"reads\" and \"writes\" must be of type [ array ] of [ string ] in call to function \"%s\"\n", __FUNCTION__);
+                    log_info("\tRefer to gschema: https://schema.g10.app/instance.json\n");
+                #endif
+
+                // error
+                return 0;
+
+            unknown_resource:
+                #ifndef NDEBUG
+                    log_error("[g10] [schedule] Resources must be one of [ \"input\", \"transforms\", \"bounds\", \"camera\", \"draw lists\" ] in call to function \"%s\"\n", __FUNCTION__);
+                    log_info("\tRefer to gschema: https://schema.g10.app/instance.json\n");
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+/** !
+ * Append a system to a schedule
+ *
+ * @param p_schedule the schedule
+ * @param name       the name of the system
+ *
+ * @return the entry, or null on error
+ */
+static schedule_entry *schedule_append ( schedule *p_schedule, const char *name )
+{
+
+    // initialized data
+    schedule_entry *p_entry = (void *) 0;
+    size_t len = strlen(name);
+
+    // error check
+    if ( p_schedule->count == SCHEDULE_ENTRIES_MAX ) goto too_many_systems;
+    if ( len == 0 || len > SCHEDULE_NAME_MAX       ) goto bad_name;
+
+    // store the name
+    p_entry = &p_schedule->_entries[p_schedule->count++];
+
+    memcpy(p_entry->_name, name, len + 1),
+    p_entry->p_schedule = p_schedule;
+
+    // done
+    return p_entry;
+
+    // error handling
+    {
+
+        // g10 errors
+        {
+            too_many_systems:
+                #ifndef NDEBUG
+                    log_error("[g10] [schedule] More than %d systems in call to function \"%s\"\n", SCHEDULE_ENTRIES_MAX, __FUNCTION__);
+                #endif
+
+                // error
+                return (void *) 0;
+
+            bad_name:
+                #ifndef NDEBUG
+                    log_error("[g10] [schedule] System names must be 1 to %d characters in call to function \"%s\"\n", SCHEDULE_NAME_MAX, __FUNCTION__);
+                #endif
+
+                // error
+                return (void *) 0;
+        }
+    }
+}
+
+/** !
+ * Resolve each system of a schedule by name, and sort the systems into
+ * phases and waves. Frame systems before the first tick system run before
+ * the ticks, and the rest run after. Within a phase, a system runs in the
+ * wave after the last earlier system it conflicts with, so the order of
+ * the instance file holds wherever two systems touch the same data.
+ *
+ * @param p_schedule the schedule
+ *
+ * @return void
+ */
+static void schedule_resolve ( schedule *p_schedule )
+{
+
+    // initialized data
+    size_t waves = 0;
+    bool   ticked = false;
+
+    // find each system
+    for (size_t i = 0; i < p_schedule->count; i++)
+    {
+
+        // initialized data
+        schedule_entry *p_entry = &p_schedule->_entries[i];
+
+        p_entry->p_system = (void *) 0;
+
+        for (size_t j = 0; j < _system_count; j++)
+            if ( 0 == strcmp(p_entry->_name, _systems[j]._name) ) p_entry->p_system = &_systems[j];
+
+        // unregistered
+        if ( p_entry->p_system == (void *) 0 )
+        {
+            #ifndef NDEBUG
+                log_warning("[g10] [schedule] System \"%s\" is not registered, and will not run\n", p_entry->_name);
+            #endif
+
+            continue;
+        }
+
+        // the registered data
+        if ( p_entry->declared == false )
+            p_entry->reads  = p_entry->p_system->reads,
+            p_entry->writes = p_entry->p_system->writes;
+    }
+
+    // sort the systems
+    p_schedule->tick_systems = 0;
+
+    for (size_t i = 0; i < p_schedule->count; i++)
+    {
+
+        // initialized data
+        schedule_entry *p_entry = &p_schedule->_entries[i];
+
+        // skip systems that do not run
+        if ( p_entry->p_system == (void *) 0 ) continue;
+
+        // phase
+        if ( p_entry->p_system->flags & SCHEDULE_TICK )
+            p_entry->phase = SCHEDULE_PHASE_TICK,
+            p_schedule->tick_systems++,
+            ticked = true;
+        else
+            p_entry->phase = ( ticked ) ? SCHEDULE_PHASE_AFTER : SCHEDULE_PHASE_BEFORE;
+
+        // after the last conflicting system of the phase
+        p_entry->wave = 0;
+
+        for (size_t j = 0; j < i; j++)
+        {
+
+            // initialized data
+            const schedule_entry *p_before = &p_schedule->_entries[j];
+
+            // skip systems that do not run, and other phases
+            if ( p_before->p_system == (void *) 0     ) continue;
+            if ( p_before->phase    != p_entry->phase ) continue;
+
+            // write after write, read after write, write after read
+            if ( ( p_before->writes & ( p_entry->reads | p_entry->writes ) ) || ( p_before->reads & p_entry->writes ) )
+                if ( p_entry->wave < p_before->wave + 1 ) p_entry->wave = p_before->wave + 1;
+        }
+
+        if ( waves < p_entry->wave + 1 ) waves = p_entry->wave + 1;
+    }
+
+    // store the waves
+    p_schedule->waves      = waves,
+    p_schedule->generation = _system_generation;
+
+    // done
+    return;
+}
+
+/** !
+ * Run and time one system
+ *
+ * @param p_context the schedule entry of the system
+ *
+ * @return void
+ */
+static void schedule_entry_run ( void *p_context )
+{
+
+    // initialized data
+    schedule_entry *p_entry = p_context;
+    timestamp t0 = timer_high_precision(),
+              t1 = 0;
+    f64 ms = 0;
+
+    // run the system
+    p_entry->p_system->pfn_system(p_entry->p_schedule->p_instance);
+
+    // store the time
+    t1 = timer_high_precision(),
+    ms = (f64)( t1 - t0 ) * 1000.0 / (f64) timer_seconds_divisor();
+
+    p_entry->time.last   = ms,
+    p_entry->time.total += ms,
+    p_entry->time.max    = ( ms > p_entry->time.max ) ? ms : p_entry->time.max;
+
+    // done
+    return;
+}
+
+/** !
+ * Run the systems of one phase, a wave at a time
+ *
+ * @param p_schedule the schedule
+ * @param phase      the phase
+ *
+ * @return void
+ */
+static void schedule_phase_run ( schedule *p_schedule, enum schedule_phase_e phase )
+{
+
+    // run each wave
+    for (size_t wave = 0; wave < p_schedule->waves; wave++)
+    {
+
+        // initialized data
+        job_counter _counter = { 0 };
+
+        // queue the systems that may run anywhere
+        for (size_t i = 0; i < p_schedule->count; i++)
+        {
+
+            // initialized data
+            schedule_entry *p_entry = &p_schedule->_entries[i];
+
+            // skip systems of other phases and waves, and systems for this thread
+            if ( p_entry->p_system == (void *) 0                  ) continue;
+            if ( p_entry->phase    != phase                       ) continue;
+            if ( p_entry->wave     != wave                        ) continue;
+            if ( p_entry->p_system->flags & SCHEDULE_MAIN_THREAD ) continue;
+
+            job_submit(schedule_entry_run, p_entry, &_counter);
+        }
+
+        // run the systems for this thread
+        for (size_t i = 0; i < p_schedule->count; i++)
+        {
+
+            // initialized data
+            schedule_entry *p_entry = &p_schedule->_entries[i];
+
+            // skip systems of other phases and waves, and queued systems
+            if ( p_entry->p_system == (void *) 0                            ) continue;
+            if ( p_entry->phase    != phase                                 ) continue;
+            if ( p_entry->wave     != wave                                  ) continue;
+            if ( 0 == ( p_entry->p_system->flags & SCHEDULE_MAIN_THREAD ) ) continue;
+
+            schedule_entry_run(p_entry);
+        }
+
+        // help run the rest of the wave
+        job_wait(&_counter);
+    }
+
+    // done
+    return;
+}
+
+int schedule_system_register ( const char *name, fn_schedule_system *pfn_system, u32 reads, u32 writes, u32 flags )
+{
+
+    // argument check
+    if ( name       == (void *) 0 ) goto no_name;
+    if ( pfn_system == (void *) 0 ) goto no_system;
+
+    // initialized data
+    schedule_system *p_system = (void *) 0;
+    size_t len = strlen(name);
+
+    // error check
+    if ( len == 0 || len > SCHEDULE_NAME_MAX ) goto bad_name;
+
+    // replace a system of the same name
+    for (size_t i = 0; i < _system_count; i++)
+        if ( 0 == strcmp(name, _systems[i]._name) ) p_system = &_systems[i];
+
+    // or add one
+    if ( p_system == (void *) 0 )
+    {
+
+        // error check
+        if ( _system_count == SCHEDULE_SYSTEMS_MAX ) goto too_many_systems;
+
+        p_system = &_systems[_system_count++];
+
+        memcpy(p_system->_name, name, len + 1);
+    }
+
+    // store the system
+    p_system->pfn_system = pfn_system,
+    p_system->reads      = reads,
+    p_system->writes     = writes,
+    p_system->flags      = flags;
+
+    // schedules resolve again
+    _system_generation++;
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_name:
+                #ifndef NDEBUG
+                    log_error("[g10] [schedule] Null pointer provided for parameter \"name\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_system:
+                #ifndef NDEBUG
+                    log_error("[g10] [schedule] Null pointer provided for parameter \"pfn_system\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            bad_name:
+                #ifndef NDEBUG
+                    log_error("[g10] [schedule] Parameter \"name\" must be 1 to %d characters in call to function \"%s\"\n", SCHEDULE_NAME_MAX, __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // g10 errors
+        {
+            too_many_systems:
+                #ifndef NDEBUG
+                    log_error("[g10] [schedule] More than %d systems registered in call to function \"%s\"\n", SCHEDULE_SYSTEMS_MAX, __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int schedule_from_json ( schedule **pp_schedule, const json_value *p_value )
+{
+
+    // argument check
+    if ( pp_schedule   == (void *) 0       ) goto no_schedule;
+    if ( p_value       == (void *) 0       ) goto no_value;
+    if ( p_value->type != JSON_VALUE_ARRAY ) goto wrong_type;
+
+    // initialized data
+    schedule *p_schedule = default_allocator(0, sizeof(schedule));
+    size_t len = array_size(p_value->list);
+
+    // error check
+    if ( p_schedule == (void *) 0 ) goto no_mem;
+
+    // initialize memory
+    memset(p_schedule, 0, sizeof(schedule));
+
+    // iterate through each system
+    for (size_t i = 0; i < len; i++)
+    {
+
+        // initialized data
+        json_value *p_system = (void *) 0;
+        schedule_entry *p_entry = (void *) 0;
+
+        // store the i'th element
+        array_index(p_value->list, (signed) i, (void **)&p_system);
+
+        // error check
+        if ( p_system == (void *) 0 ) goto wrong_system_type;
+
+        // a name
+        if ( p_system->type == JSON_VALUE_STRING )
+        {
+            p_entry = schedule_append(p_schedule, p_system->string);
+
+            // error check
+            if ( p_entry == (void *) 0 ) goto failed_to_construct_schedule;
+        }
+
+        // a name, and the data it reads and writes
+        else if ( p_system->type == JSON_VALUE_OBJECT )
+        {
+
+            // initialized data
+            json_value *p_name   = (void *) 0,
+                       *p_reads  = (void *) 0,
+                       *p_writes = (void *) 0;
+
+            dict_get(p_system->object, "name"  , (void **)&p_name);
+            dict_get(p_system->object, "reads" , (void **)&p_reads);
+            dict_get(p_system->object, "writes", (void **)&p_writes);
+
+            // error check
+            if ( p_name == (void *) 0 || p_name->type != JSON_VALUE_STRING ) goto missing_name;
+
+            // append the system
+            p_entry = schedule_append(p_schedule, p_name->string);
+
+            // error check
+            if ( p_entry == (void *) 0 ) goto failed_to_construct_schedule;
+
+            // store the declared data
+            if ( p_reads || p_writes )
+            {
+                if ( 0 == schedule_resources_from_json(p_reads , &p_entry->reads ) ) goto failed_to_construct_schedule;
+                if ( 0 == schedule_resources_from_json(p_writes, &p_entry->writes) ) goto failed_to_construct_schedule;
+
+                p_entry->declared = true;
+            }
+        }
+
+        // error
+        else goto wrong_system_type;
+    }
+
+    // return a pointer to the caller
+    *pp_schedule = p_schedule;
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_schedule:
+                #ifndef NDEBUG
+                    log_error("[g10] [schedule] Null pointer provided for parameter \"pp_schedule\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_value:
+                #ifndef NDEBUG
+                    log_error("[g10] [schedule] Null pointer provided for parameter \"p_value\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // g10 errors
+        {
+            wrong_type:
+                #ifndef NDEBUG
+                    log_error("[g10] [schedule] \"schedule\" property of instance object must be of type [ array ] in call to function \"%s\"\n", __FUNCTION__);
+                    log_info("\tRefer to gschema: https://schema.g10.app/instance.json\n");
+                #endif
+
+                // error
+                return 0;
+
+            wrong_system_type:
+                #ifndef NDEBUG
+                    log_error("[g10] [schedule] Systems must be of type [ string | object ] in call to function \"%s\"\n", __FUNCTION__);
+                    log_info("\tRefer to gschema: https://schema.g10.app/instance.json\n");
+                #endif
+
+                // error
+                goto failed_to_construct_schedule;
+
+            missing_name:
+                #ifndef NDEBUG
+                    log_error("[g10] [schedule] System object is missing required property \"name\" in call to function \"%s\"\n", __FUNCTION__);
+                    log_info("\tRefer to gschema: https://schema.g10.app/instance.json\n");
+                #endif
+
+                // error
+                goto failed_to_construct_schedule;
+
+            failed_to_construct_schedule:
+
+                // release the schedule
+                p_schedule = default_allocator(p_schedule, 0);
+
+                // error
+                return 0;
+        }
+
+        // standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int schedule_default ( schedule **pp_schedule )
+{
+
+    // argument check
+    if ( pp_schedule == (void *) 0 ) goto no_schedule;
+
+    // initialized data
+    schedule *p_schedule = default_allocator(0, sizeof(schedule));
+
+    // error check
+    if ( p_schedule == (void *) 0 ) goto no_mem;
+
+    // initialize memory
+    memset(p_schedule, 0, sizeof(schedule));
+
+    // input, then user code, then render
+    schedule_append(p_schedule, "input"),
+    schedule_append(p_schedule, "user code"),
+    schedule_append(p_schedule, "render");
+
+    // return a pointer to the caller
+    *pp_schedule = p_schedule;
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_schedule:
+                #ifndef NDEBUG
+                    log_error("[g10] [schedule] Null pointer provided for parameter \"pp_schedule\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int schedule_run ( schedule *p_schedule, g_instance *p_instance )
+{
+
+    // argument check
+    if ( p_schedule == (void *) 0 ) goto no_schedule;
+    if ( p_instance == (void *) 0 ) goto no_instance;
+
+    // systems were registered since the last run
+    if ( p_schedule->generation != _system_generation ) schedule_resolve(p_schedule);
+
+    // initialized data
+    camera              *p_camera     = ( p_instance->context.p_scene ) ? p_instance->context.p_scene->p_active_camera : (void *) 0;
+    transform_hierarchy *p_transforms = ( p_instance->context.p_scene ) ? p_instance->context.p_scene->p_transforms : (void *) 0;
+    timestamp            now          = timer_high_precision();
+    f32                  frame        = ( p_schedule->frames ) ? (f32) ( (f64) ( now - p_schedule->last ) / (f64) timer_seconds_divisor() ) : 0.f;
+
+    // store the instance, and the start of the frame
+    p_schedule->p_instance = p_instance,
+    p_schedule->last       = now;
+
+    // frame systems see the frame time
+    p_instance->context.delta_time = frame;
+
+    // before the ticks
+    schedule_phase_run(p_schedule, SCHEDULE_PHASE_BEFORE);
+
+    // ticks
+    if ( p_schedule->tick_systems )
+    {
+
+        // at the fixed tick rate
+        if ( p_instance->context.fixed_tick_rate )
+        {
+
+            // initialized data
+            f64 step = 1.0 / (f64) p_instance->context.fixed_tick_rate;
+
+            // accumulate the frame time, and drop what is too far behind
+            p_schedule->accumulator += frame;
+
+            if ( p_schedule->accumulator > step * SCHEDULE_TICKS_MAX ) p_schedule->accumulator = step * SCHEDULE_TICKS_MAX;
+
+            // tick systems see the tick time
+            p_instance->context.delta_time = (f32) step;
+
+            // run each whole tick
+            while ( p_schedule->accumulator >= step )
+            {
+
+                // the state of the last tick becomes the previous state
+                if ( p_camera ) camera_tick(p_camera);
+                if ( p_transforms ) transform_hierarchy_tick(p_transforms);
+
+                schedule_phase_run(p_schedule, SCHEDULE_PHASE_TICK);
+
+                p_schedule->accumulator -= step,
+                p_schedule->ticks++;
+            }
+
+            // the frame is this far from the previous tick to the current tick
+            p_instance->context.interpolation = (f32) ( p_schedule->accumulator / step );
+        }
+
+        // once per frame
+        else
+        {
+            if ( p_camera ) camera_tick(p_camera);
+            if ( p_transforms ) transform_hierarchy_tick(p_transforms);
+
+            schedule_phase_run(p_schedule, SCHEDULE_PHASE_TICK);
+
+            p_schedule->ticks++,
+            p_instance->context.interpolation = 1.f;
+        }
+
+        // frame systems see the frame time
+        p_instance->context.delta_time = frame;
+
+        // render between the last two ticks
+        if ( p_camera ) camera_interpolate(p_camera, p_instance->context.interpolation);
+        if ( p_transforms ) transform_hierarchy_interpolate(p_transforms, p_instance->context.interpolation);
+    }
+
+    // after the ticks
+    schedule_phase_run(p_schedule, SCHEDULE_PHASE_AFTER);
+
+    // count the frame
+    p_schedule->frames++;
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_schedule:
+                #ifndef NDEBUG
+                    log_error("[g10] [schedule] Null pointer provided for parameter \"p_schedule\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_instance:
+                #ifndef NDEBUG
+                    log_error("[g10] [schedule] Null pointer provided for parameter \"p_instance\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int schedule_info ( const schedule *p_schedule )
+{
+
+    // argument check
+    if ( p_schedule == (void *) 0 ) goto no_schedule;
+
+    // initialized data
+    f64 frames = ( p_schedule->frames ) ? (f64) p_schedule->frames : 1.0,
+        ticks  = ( p_schedule->ticks  ) ? (f64) p_schedule->ticks  : 1.0;
+
+    // logs
+    logger_pad(), log_info("Schedule @%p\n", p_schedule),
+    logger_push(),
+    logger_pad(), printf("waves  - %zu\n", p_schedule->waves),
+    logger_pad(), printf("frames - %zu\n", p_schedule->frames),
+    logger_pad(), printf("ticks  - %zu\n", p_schedule->ticks),
+    logger_pad(), printf("%-24s %-6s %4s %10s %10s %10s\n", "system", "phase", "wave", "last ms", "mean ms", "max ms");
+
+    // iterate through each system
+    for (size_t i = 0; i < p_schedule->count; i++)
+    {
+
+        // initialized data
+        const schedule_entry *p_entry = &p_schedule->_entries[i];
+
+        // unregistered
+        if ( p_entry->p_system == (void *) 0 )
+        {
+            logger_pad(), printf("%-24s %-6s %4s\n", p_entry->_name, "-", "-");
+
+            continue;
+        }
+
+        // timings. tick systems are averaged over ticks
+        logger_pad(), printf("%-24s %-6s %4zu %10.3f %10.3f %10.3f\n",
+            p_entry->_name,
+            ( p_entry->phase == SCHEDULE_PHASE_TICK ) ? "tick" : "frame",
+            p_entry->wave,
+            p_entry->time.last,
+            p_entry->time.total / ( ( p_entry->phase == SCHEDULE_PHASE_TICK ) ? ticks : frames ),
+            p_entry->time.max
+        );
+    }
+
+    logger_pop();
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_schedule:
+                #ifndef NDEBUG
+                    log_error("[g10] [schedule] Null pointer provided for parameter \"p_schedule\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int schedule_destroy ( schedule **pp_schedule )
+{
+
+    // argument check
+    if ( pp_schedule == (void *) 0 ) goto no_schedule;
+
+    // initialized data
+    schedule *p_schedule = *pp_schedule;
+
+    // no more pointer for caller
+    *pp_schedule = (void *) 0;
+
+    // release the schedule
+    p_schedule = default_allocator(p_schedule, 0);
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_schedule:
+                #ifndef NDEBUG
+                    log_error("[g10] [schedule] Null pointer provided for parameter \"pp_schedule\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
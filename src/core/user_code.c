@@ -18,6 +18,9 @@ int user_code_set_callback ( fn_user_code *pfn_user_code )
 int user_code ( g_instance *p_instance )
 {
 
+    // no game logic
+    if ( p_instance->context.pfn_user_code == (void *) 0 ) return 1;
+
     // call the game logic
     p_instance->context.pfn_user_code(p_instance);
 
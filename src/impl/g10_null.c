@@ -0,0 +1,203 @@
+/** !
+ * Null backend. Runs the cpu side of every frame, and records the resulting
+ * commands into the instance's command sink instead of submitting them.
+ *
+ * @file src/impl/g10_null.c
+ *
+ * @author Jacob Smith
+ */
+
+// standard library
+#include <stdio.h>
+#include <stdlib.h>
+
+// gsdk
+/// data
+#include <data/array.h>
+#include <data/dict.h>
+
+// g10
+#include <gtypedef.h>
+#include <g10.h>
+#include <renderer.h>
+#include <render_pass.h>
+#include <pipeline.h>
+#include <command.h>
+
+// forward declarations
+/// null
+int g_null_render_early ( g_instance *p_instance );
+int g_null_render_draw ( g_instance *p_instance );
+int g_null_render_late ( g_instance *p_instance );
+int g_null_render_pass_draw ( g_instance *p_instance, render_pass *p_render_pass );
+
+/// pipeline. recording is backend neutral, so the null backend shares it
+int g_sdl3_pipeline_bind ( render_pass *p_render_pass, pipeline *p_pipeline );
+int g_sdl3_pipeline_draw ( render_pass *p_render_pass, pipeline *p_pipeline );
+int g_sdl3_pipeline_upload ( pipeline *p_pipeline );
+
+// function definitions
+int g_null_render_early ( g_instance *p_instance )
+{
+
+    // argument check
+    if ( p_instance == (void *) 0 ) goto no_instance;
+
+    // always a target to draw to
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_instance:
+                #ifndef NDEBUG
+                    log_error("[g10] [null] Null pointer provided for parameter \"p_instance\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int g_null_render_draw ( g_instance *p_instance )
+{
+
+    // argument check
+    if ( p_instance == (void *) 0 ) goto no_instance;
+
+    // initialized data
+    renderer *p_renderer = p_instance->context.p_renderer;
+    array *p_passes = p_renderer->p_passes;
+
+    // pack the instances of each instanced pipeline
+    dict_foreach(p_instance->cache.p_pipeline, (fn_foreach *)g_sdl3_pipeline_upload);
+
+    // draw the same render passes as the sdl3 backend
+    for (size_t i = 0; i < 1; i++)
+    {
+
+        // initialized data
+        render_pass *p_render_pass = NULL;
+
+        // get the i'th render pass
+        array_index(p_passes, i, (void **)&p_render_pass);
+
+        // draw the render pass
+        g_null_render_pass_draw(p_instance, p_render_pass);
+    }
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_instance:
+                #ifndef NDEBUG
+                    log_error("[g10] [null] Null pointer provided for parameter \"p_instance\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int g_null_render_late ( g_instance *p_instance )
+{
+
+    // argument check
+    if ( p_instance == (void *) 0 ) goto no_instance;
+
+    // nothing to submit
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_instance:
+                #ifndef NDEBUG
+                    log_error("[g10] [null] Null pointer provided for parameter \"p_instance\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int g_null_render_pass_draw ( g_instance *p_instance, render_pass *p_render_pass )
+{
+
+    // argument check
+    if ( p_instance    == (void *) 0 ) goto no_instance;
+    if ( p_render_pass == (void *) 0 ) goto no_render_pass;
+
+    // initialized data
+    size_t len = array_size(p_render_pass->p_pipelines);
+
+    // record the render pass
+    p_instance->commands.render_passes++;
+
+    // the render pass has no target
+    p_render_pass->p_handle = G10_NULL_HANDLE;
+
+    // iterate through each pipeline
+    for (size_t i = 0; i < len; i++)
+    {
+
+        // initialized data
+        pipeline *p_pipeline = NULL;
+
+        // store the i'th pipeline
+        array_index(p_render_pass->p_pipelines, i, (void **)&p_pipeline);
+
+        // bind the pipeline
+        g_sdl3_pipeline_bind(p_render_pass, p_pipeline);
+
+        // nothing is bound for the new pipeline yet
+        p_render_pass->bound.p_transform = NULL,
+        p_render_pass->bound.p_material  = NULL,
+        p_render_pass->bound.p_geometry  = NULL;
+
+        // bind once
+        if ( p_pipeline->pfn_bind_once )
+            p_pipeline->pfn_bind_once(p_render_pass, p_pipeline);
+
+        // pipeline draw
+        g_sdl3_pipeline_draw(p_render_pass, p_pipeline);
+    }
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_instance:
+                #ifndef NDEBUG
+                    log_error("[g10] [null] Null pointer provided for parameter \"p_instance\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_render_pass:
+                #ifndef NDEBUG
+                    log_error("[g10] [null] Null pointer provided for parameter \"p_render_pass\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
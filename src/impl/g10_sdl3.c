@@ -33,6 +33,11 @@
 int g_sdl3_init ( g_instance *p_instance );
 int g_sdl3_window_from_json ( g_instance *p_instance, const json_value *p_value );
 
+/// null
+int g_null_render_early ( g_instance *p_instance );
+int g_null_render_draw ( g_instance *p_instance );
+int g_null_render_late ( g_instance *p_instance );
+
 /// renderer
 int g_sdl3_renderer_from_json ( renderer **pp_renderer, const json_value *p_value );
 int g_sdl3_render_early ( g_instance *p_instance );
@@ -50,19 +55,24 @@ int g_sdl3_attachment_from_json ( attachment **pp_attachment, const json_value *
 int g_sdl3_pipeline_from_json ( pipeline **pp_pipeline, const json_value *p_value );
 int g_sdl3_pipeline_bind ( render_pass *p_render_pass, pipeline *p_pipeline );
 int g_sdl3_pipeline_draw ( render_pass *p_render_pass, pipeline *p_pipeline );
+int g_sdl3_pipeline_upload ( pipeline *p_pipeline );
 
 /// framebuffer
 int g_sdl3_framebuffer_from_json ( framebuffer **pp_framebuffer, const json_value *p_value );
 
 /// geometry
 int g_sdl3_geometry_from_json ( geometry **pp_geometry, const json_value *p_value );
+int g_sdl3_geometry_from_binary ( geometry **pp_geometry, const void *p_data, size_t size );
 int g_sdl3_geometry_bind ( render_pass *p_render_pass, geometry *p_geometry );
+int g_sdl3_geometry_destroy ( geometry **pp_geometry );
 
 /// texture
 int g_sdl3_texture_from_data ( texture **pp_texture, u32 width, u32 height, u32 channels, const void *p_data );
 int g_sdl3_texture_construct ( texture **pp_texture, u32 width, u32 height, u32 channels, const void *p_data );
 int g_sdl3_texture_from_color ( texture **pp_texture, f32 r, f32 g, f32 b, f32 a );
 int g_sdl3_texture_load ( texture **pp_texture, const char *p_path );
+int g_sdl3_texture_from_memory ( texture **pp_texture, const void *p_data, size_t size );
+int g_sdl3_texture_destroy ( texture **pp_texture );
 int g_sdl3_texture_load_cubemap ( texture **pp_texture, const json_value *p_value );
 
 /// sampler
@@ -227,8 +237,8 @@ int g_sdl3_init ( g_instance *p_instance )
     // initialized data 
     bool ok = true;
 
-    // initialize sdl3
-    ok = SDL_Init(SDL_INIT_EVENTS | SDL_INIT_VIDEO);
+    // initialize sdl3. the null backend has no window, so only events
+    ok = SDL_Init(( G10_BACKEND_NULL == p_instance->backend ) ? SDL_INIT_EVENTS : SDL_INIT_EVENTS | SDL_INIT_VIDEO);
     if ( !ok ) goto failed_to_initialize_sdl3;
 
     // construct the key lookups
@@ -350,6 +360,9 @@ int g_sdl3_render_draw ( g_instance *p_instance )
     array *p_passes = p_renderer->p_passes;
     size_t len = array_size(p_passes);
 
+    // upload the instances of each instanced pipeline
+    dict_foreach(p_instance->cache.p_pipeline, (fn_foreach *)g_sdl3_pipeline_upload);
+
     // iterate through each render pass
     for (size_t i = 0; i < 1; i++)
     {
@@ -470,6 +483,9 @@ int g_sdl3_render_pass_draw ( g_instance *p_instance, render_pass *p_render_pass
         };
     }
 
+    // record the render pass
+    p_instance->commands.render_passes++;
+
     // begin the render pass
     p_render_pass->p_handle = SDL_BeginGPURenderPass(
         p_instance->graphics.sdl3.command_buffer, 
@@ -520,6 +536,11 @@ int g_sdl3_render_pass_draw ( g_instance *p_instance, render_pass *p_render_pass
 
         // bind the pipeline
         g_sdl3_pipeline_bind(p_render_pass, p_pipeline);
+
+        // nothing is bound for the new pipeline yet
+        p_render_pass->bound.p_transform = NULL,
+        p_render_pass->bound.p_material  = NULL,
+        p_render_pass->bound.p_geometry  = NULL;
         
         // bind once
         if ( p_pipeline->pfn_bind_once )
@@ -612,6 +633,9 @@ int g_sdl3_window_from_json ( g_instance *p_instance, const json_value *p_value
         }
     }
 
+    // the null backend keeps the dimensions, but has no window or device
+    if ( G10_BACKEND_NULL == p_instance->backend ) return 1;
+
     // construct the sdl3 window
     p_instance->window.sdl3.window = SDL_CreateWindow(
         p_instance->window.title,
@@ -850,9 +874,14 @@ int g_sdl3_renderer_from_json ( renderer **pp_renderer, const json_value *p_valu
     }
 
     // function pointers
-    p_renderer->pfn_early = g_sdl3_render_early;
-    p_renderer->pfn_draw  = g_sdl3_render_draw;
-    p_renderer->pfn_late  = g_sdl3_render_late;
+    if ( G10_BACKEND_NULL == g_active_instance()->backend )
+        p_renderer->pfn_early = g_null_render_early,
+        p_renderer->pfn_draw  = g_null_render_draw,
+        p_renderer->pfn_late  = g_null_render_late;
+    else
+        p_renderer->pfn_early = g_sdl3_render_early,
+        p_renderer->pfn_draw  = g_sdl3_render_draw,
+        p_renderer->pfn_late  = g_sdl3_render_late;
     
     // return a pointer to the caller
     *pp_renderer = p_renderer;
@@ -1052,7 +1081,7 @@ int g_sdl3_attachment_from_json ( attachment **pp_attachment, const json_value *
                 .sample_count = 0
             };
 
-            p_attachment->p_handle = SDL_CreateGPUTexture(p_instance->graphics.sdl3.device, &_ci);
+            p_attachment->p_handle = ( G10_BACKEND_NULL == p_instance->backend ) ? G10_NULL_HANDLE : SDL_CreateGPUTexture(p_instance->graphics.sdl3.device, &_ci);
         }
     }
 
@@ -1209,7 +1238,9 @@ int g_sdl3_pipeline_from_json ( pipeline **pp_pipeline, const json_value *p_valu
                    *p_primitive = NULL,
                    *p_uniforms  = NULL,
                    *p_samplers  = NULL,
-                   *p_input     = NULL;
+                   *p_input     = NULL,
+                   *p_sort      = NULL,
+                   *p_instanced = NULL;
 
         dict_get(p_dict, "name"     , (void **)&p_name);
         dict_get(p_dict, "source"   , (void **)&p_source);
@@ -1222,6 +1253,24 @@ int g_sdl3_pipeline_from_json ( pipeline **pp_pipeline, const json_value *p_valu
         dict_get(p_dict, "uniforms" , (void **)&p_uniforms);
         dict_get(p_dict, "samplers" , (void **)&p_samplers);
         dict_get(p_dict, "input"    , (void **)&p_input);
+        dict_get(p_dict, "sort"     , (void **)&p_sort);
+        dict_get(p_dict, "instanced", (void **)&p_instanced);
+
+        // draw order
+        p_pipeline->sort = DRAW_SORT_NONE;
+        if ( p_sort && p_sort->type == JSON_VALUE_STRING )
+        {
+            if      ( 0 == strcmp(p_sort->string, "opaque")      ) p_pipeline->sort = DRAW_SORT_OPAQUE;
+            else if ( 0 == strcmp(p_sort->string, "transparent") ) p_pipeline->sort = DRAW_SORT_TRANSPARENT;
+        }
+
+        // instancing
+        p_pipeline->instancing.p_batches  = NULL,
+        p_pipeline->instancing.p_buffer   = NULL,
+        p_pipeline->instancing.p_transfer = NULL,
+        p_pipeline->instancing.capacity   = 0;
+        if ( p_instanced && p_instanced->type == JSON_VALUE_BOOLEAN && p_instanced->boolean )
+            batch_list_construct(&p_pipeline->instancing.p_batches, 512);
 
         // depth state defaults
         SDL_GPUCompareOp depth_compare_op = SDL_GPU_COMPAREOP_LESS;
@@ -1332,6 +1381,13 @@ int g_sdl3_pipeline_from_json ( pipeline **pp_pipeline, const json_value *p_valu
         }
         no_samplers:;
 
+        // the null backend has nothing to compile
+        if ( G10_BACKEND_NULL == p_instance->backend )
+        {
+            p_pipeline->pipeline = G10_NULL_HANDLE;
+            goto no_shaders;
+        }
+
         // construct pipeline
         {
 
@@ -1368,7 +1424,7 @@ int g_sdl3_pipeline_from_json ( pipeline **pp_pipeline, const json_value *p_valu
                     
                     .num_samplers         = 0,
                     .num_storage_textures = 0,
-                    .num_storage_buffers  = 0,
+                    .num_storage_buffers  = ( p_pipeline->instancing.p_batches ) ? 1 : 0,
                     .num_uniform_buffers  = uniform_count
                 };
 
@@ -1587,14 +1643,20 @@ int g_sdl3_pipeline_from_json ( pipeline **pp_pipeline, const json_value *p_valu
             // store the pipeline handle
             p_pipeline->pipeline = pipeline;
         }
+        no_shaders:;
     }
 
     // construct a static draw list
     array_construct(&p_pipeline->p_static_draw_list, 512);
-    array_construct(&p_pipeline->p_dynamic_draw_list, 512);
+
+    // construct a per frame draw list
+    draw_list_construct(&p_pipeline->p_dynamic_draw_list, 512);
 
     // add the pipeline to the cache
     dict_add(p_instance->cache.p_pipeline, p_pipeline);
+
+    // resolved handles may refer to a pipeline with the same name
+    pipeline_cache_invalidate();
     
     // return a pointer to the caller
     *pp_pipeline = p_pipeline;
@@ -1713,11 +1775,8 @@ int g_sdl3_pipeline_from_json ( pipeline **pp_pipeline, const json_value *p_valu
 int g_sdl3_pipeline_bind ( render_pass *p_render_pass, pipeline *p_pipeline )
 {
     
-    // initialized data
-    g_instance *p_instance = g_active_instance();
-
     // bind the pipeline
-    SDL_BindGPUGraphicsPipeline(p_render_pass->p_handle, p_pipeline->pipeline);
+    command_bind_pipeline(p_render_pass, p_pipeline->pipeline);
 
     // success
     return 1;
@@ -1726,9 +1785,6 @@ int g_sdl3_pipeline_bind ( render_pass *p_render_pass, pipeline *p_pipeline )
 int g_sdl3_pipeline_draw ( render_pass *p_render_pass, pipeline *p_pipeline )
 {
     
-    // initialized data
-    g_instance *p_instance = g_active_instance();
-    
     // iterate static draw list
     if ( p_pipeline->p_static_draw_list )
     {
@@ -1749,14 +1805,48 @@ int g_sdl3_pipeline_draw ( render_pass *p_render_pass, pipeline *p_pipeline )
         }
     }
     
+    // iterate batches
+    if ( p_pipeline->instancing.p_batches )
+    {
+
+        // initialized data
+        batch_list *p_batches = p_pipeline->instancing.p_batches;
+
+        // nothing to draw
+        if ( 0 == p_batches->batch_count ) return 1;
+
+        // bind the instances
+        command_bind_storage_buffer(p_render_pass, 0, p_pipeline->instancing.p_buffer);
+
+        for (size_t i = 0; i < p_batches->batch_count; i++)
+        {
+            batch *p_batch = &p_batches->p_batches[i];
+
+            if ( p_pipeline->pfn_bind_each )
+                p_pipeline->pfn_bind_each(p_render_pass, p_pipeline, p_batch);
+
+            if ( p_pipeline->pfn_draw )
+                p_pipeline->pfn_draw(p_render_pass, p_pipeline, p_batch);
+        }
+
+        // success
+        return 1;
+    }
+
     // iterate dynamic draw list
     if ( p_pipeline->p_dynamic_draw_list )
     {
-        size_t len = array_size(p_pipeline->p_dynamic_draw_list);
+
+        // order the draws
+        if ( p_pipeline->sort != DRAW_SORT_NONE )
+            draw_list_sort(p_pipeline->p_dynamic_draw_list);
+
+        size_t len = draw_list_size(p_pipeline->p_dynamic_draw_list);
+        draw_packet *p_packets = p_pipeline->p_dynamic_draw_list->p_packets;
+
         for (size_t i = 0; i < len; i++)
         {
-            entity *p_drawable = NULL;
-            array_index(p_pipeline->p_dynamic_draw_list, i, (void **)&p_drawable);
+            void *p_drawable = p_packets[i].p_drawable;
 
             if ( p_pipeline->pfn_cull && p_pipeline->pfn_cull(p_render_pass, p_pipeline, p_drawable) )
                 continue;
@@ -1773,6 +1863,159 @@ int g_sdl3_pipeline_draw ( render_pass *p_render_pass, pipeline *p_pipeline )
     return 1;
 }
 
+int g_sdl3_pipeline_upload ( pipeline *p_pipeline )
+{
+
+    // argument check
+    if ( p_pipeline == (void *) 0 ) goto no_pipeline;
+
+    // not instanced
+    if ( p_pipeline->instancing.p_batches == (void *) 0 ) return 1;
+
+    // initialized data
+    g_instance *p_instance = g_active_instance();
+    batch_list *p_batches = p_pipeline->instancing.p_batches;
+    SDL_GPUDevice *p_device = p_instance->graphics.sdl3.device;
+    SDL_GPUCopyPass *p_copy_pass = NULL;
+    size_t size = 0;
+    void *p_mmap = NULL;
+
+    // order the draws, so equal state is adjacent
+    if ( p_pipeline->sort != DRAW_SORT_NONE )
+        draw_list_sort(p_pipeline->p_dynamic_draw_list);
+
+    // group the draws
+    batch_list_build(p_batches, p_pipeline->p_dynamic_draw_list);
+
+    // nothing to upload
+    if ( 0 == p_batches->instance_count ) return 1;
+
+    // initialized data
+    size = p_batches->instance_count * sizeof(batch_instance);
+
+    // record the upload
+    p_instance->commands.uploads++,
+    p_instance->commands.upload_bytes += size;
+
+    // the null backend stops after the pack
+    if ( G10_BACKEND_NULL == p_instance->backend )
+    {
+        p_pipeline->instancing.p_buffer = G10_NULL_HANDLE;
+
+        // success
+        return 1;
+    }
+
+    // grow the buffers
+    if ( size > p_pipeline->instancing.capacity )
+    {
+
+        // initialized data
+        size_t capacity = size + size / 2;
+
+        // release the old buffers
+        if ( p_pipeline->instancing.p_buffer   ) SDL_ReleaseGPUBuffer(p_device, p_pipeline->instancing.p_buffer);
+        if ( p_pipeline->instancing.p_transfer ) SDL_ReleaseGPUTransferBuffer(p_device, p_pipeline->instancing.p_transfer);
+
+        // construct a storage buffer
+        p_pipeline->instancing.p_buffer = SDL_CreateGPUBuffer
+        (
+            p_device,
+
+            &(SDL_GPUBufferCreateInfo)
+            {
+                .usage = SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ,
+                .size  = (u32) capacity
+            }
+        );
+
+        // construct a transfer buffer
+        p_pipeline->instancing.p_transfer = SDL_CreateGPUTransferBuffer
+        (
+            p_device,
+
+            &(SDL_GPUTransferBufferCreateInfo)
+            {
+                .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+                .size  = (u32) capacity
+            }
+        );
+
+        // error check
+        if ( NULL == p_pipeline->instancing.p_buffer   ) goto failed_to_create_buffer;
+        if ( NULL == p_pipeline->instancing.p_transfer ) goto failed_to_create_buffer;
+
+        // store the capacity
+        p_pipeline->instancing.capacity = capacity;
+    }
+
+    // map the transfer buffer into address space, cycling if the last frame is still in flight
+    p_mmap = SDL_MapGPUTransferBuffer(p_device, p_pipeline->instancing.p_transfer, true);
+
+    // copy the instances to the transfer buffer
+    SDL_memcpy(p_mmap, p_batches->p_instances, size);
+
+    // unmap the transfer buffer from address space
+    SDL_UnmapGPUTransferBuffer(p_device, p_pipeline->instancing.p_transfer);
+
+    // upload from the transfer buffer to the gpu, before any render pass of the frame
+    p_copy_pass = SDL_BeginGPUCopyPass(p_instance->graphics.sdl3.command_buffer);
+
+    SDL_UploadToGPUBuffer
+    (
+        p_copy_pass,
+
+        &(SDL_GPUTransferBufferLocation)
+        {
+            .transfer_buffer = p_pipeline->instancing.p_transfer,
+            .offset = 0
+        },
+
+        &(SDL_GPUBufferRegion)
+        {
+            .buffer = p_pipeline->instancing.p_buffer,
+            .offset = 0,
+            .size   = (u32) size
+        },
+
+        true
+    );
+
+    SDL_EndGPUCopyPass(p_copy_pass);
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_pipeline:
+                #ifndef NDEBUG
+                    log_error("[sdl3] Null pointer provided for parameter \"p_pipeline\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // sdl3 errors
+        {
+            failed_to_create_buffer:
+                #ifndef NDEBUG
+                    log_error("[sdl3] Failed to create instance buffers in call to function \"%s\"\n[sdl3] %s\n", __FUNCTION__, SDL_GetError());
+                #endif
+
+                // no instances
+                p_pipeline->instancing.capacity = 0;
+
+                // error
+                return 0;
+        }
+    }
+}
+
 int g_sdl3_render_pass_from_json ( render_pass **pp_render_pass, const json_value *p_value )
 {
     
@@ -2280,6 +2523,22 @@ int g_sdl3_geometry_from_json ( geometry **pp_geometry, const json_value *p_valu
         parts_done:
     }
 
+    // the null backend keeps the counts, and stands in for each buffer
+    if ( G10_BACKEND_NULL == p_instance->backend )
+    {
+        p_geometry->_p_handles[GEOMETRY_XYZ]  = ( xyz  ) ? G10_NULL_HANDLE : NULL,
+        p_geometry->_p_handles[GEOMETRY_UV]   = ( uv   ) ? G10_NULL_HANDLE : NULL,
+        p_geometry->_p_handles[GEOMETRY_NXYZ] = ( nxyz ) ? G10_NULL_HANDLE : NULL,
+        p_geometry->_p_handles[GEOMETRY_TXYZ] = ( txyz ) ? G10_NULL_HANDLE : NULL,
+        p_geometry->_p_handles[GEOMETRY_BXYZ] = ( bxyz ) ? G10_NULL_HANDLE : NULL,
+        p_geometry->p_index_handle            = ( p_idx ) ? G10_NULL_HANDLE : NULL;
+
+        for (size_t i = 0; i < parts_len; i++)
+            p_geometry->_parts[i].p_handle = G10_NULL_HANDLE;
+
+        goto uploaded;
+    }
+
     // upload vertex data
     {
 
@@ -2546,6 +2805,7 @@ int g_sdl3_geometry_from_json ( geometry **pp_geometry, const json_value *p_valu
         SDL_EndGPUCopyPass(copy_pass),
         SDL_SubmitGPUCommandBuffer(cmd);
     }
+    uploaded:
 
     // return a pointer to the caller
     *pp_geometry = p_geometry;
@@ -2904,6 +3164,233 @@ int g_sdl3_geometry_from_json ( geometry **pp_geometry, const json_value *p_valu
     }
 }
 
+int g_sdl3_geometry_from_binary ( geometry **pp_geometry, const void *p_data, size_t size )
+{
+
+    // argument check
+    if ( pp_geometry == (void *) 0 ) goto no_geometry;
+    if ( p_data      == (void *) 0 ) goto no_data;
+
+    // initialized data
+    g_instance *p_instance = g_active_instance();
+    const geometry_binary_header *p_header = NULL;
+    geometry *p_geometry = NULL;
+    aabb *p_aabb = NULL;
+    SDL_GPUTransferBuffer *p_transfer_buffer = NULL;
+    SDL_GPUCommandBuffer *p_cmd = NULL;
+    SDL_GPUCopyPass *p_copy_pass = NULL;
+    u8 *p_map = NULL;
+    size_t stream_count = 0, transfer_size = 0;
+    struct
+    {
+        geometry_binary_range _range;
+        void **pp_handle;
+        SDL_GPUBufferUsageFlags usage;
+    } _streams[GEOMETRY_QTY + 1 + GEOMETRY_PARTS_MAX] = { 0 };
+
+    // validate the contents
+    if ( 0 == geometry_binary_validate(p_data, size, &p_header) ) goto malformed;
+
+    // allocate memory for the geometry
+    p_geometry = default_allocator(0, sizeof(geometry));
+
+    // error check
+    if ( p_geometry == (void *) 0 ) goto no_mem;
+
+    // zero set
+    memset(p_geometry, 0, sizeof(geometry));
+
+    // store the name and counts
+    strncpy(p_geometry->_name, p_header->_name, sizeof(p_geometry->_name) - 1);
+    p_geometry->vertex_count = p_header->vertex_count,
+    p_geometry->index_count  = p_header->index_count;
+
+    // construct the bounds from the precomputed extents
+    p_aabb = default_allocator(NULL, sizeof(aabb));
+    aabb_from_bounds(p_aabb, (vec3){ p_header->min[0], p_header->min[1], p_header->min[2] }, (vec3){ p_header->max[0], p_header->max[1], p_header->max[2] });
+    bv_from_aabb(&p_geometry->p_bounds, p_aabb);
+    transform_construct(&p_geometry->p_local_transform, (vec3){0.0,0.0,0.0}, (vec3){0.0,0.0,0.0}, (vec3){1.0,1.0,1.0}, NULL);
+
+    // gather the streams
+    for (size_t i = 0; i < GEOMETRY_QTY; i++)
+        if ( p_header->_attributes[i].size )
+            _streams[stream_count++] = (typeof(_streams[0])) { p_header->_attributes[i], &p_geometry->_p_handles[i], SDL_GPU_BUFFERUSAGE_VERTEX };
+
+    if ( p_header->idx.size )
+        _streams[stream_count++] = (typeof(_streams[0])) { p_header->idx, &p_geometry->p_index_handle, SDL_GPU_BUFFERUSAGE_INDEX };
+
+    for (size_t i = 0; i < p_header->part_count; i++)
+    {
+
+        // store the part
+        strncpy((char *)p_geometry->_parts[i]._material_name, p_header->_parts[i]._material_name, sizeof(p_geometry->_parts[i]._material_name) - 1);
+        p_geometry->_parts[i].index_count = p_header->_parts[i].index_count;
+
+        if ( p_header->_parts[i].idx.size )
+            _streams[stream_count++] = (typeof(_streams[0])) { p_header->_parts[i].idx, &p_geometry->_parts[i].p_handle, SDL_GPU_BUFFERUSAGE_INDEX };
+    }
+
+    // every stream shares one transfer buffer, at the same offsets as the file
+    for (size_t i = 0; i < stream_count; i++)
+        if ( _streams[i]._range.offset + _streams[i]._range.size > transfer_size )
+            transfer_size = _streams[i]._range.offset + _streams[i]._range.size;
+
+    // fast exit
+    if ( 0 == transfer_size ) goto done;
+
+    // the null backend stands in for each buffer
+    if ( G10_BACKEND_NULL == p_instance->backend )
+    {
+        for (size_t i = 0; i < stream_count; i++)
+            *_streams[i].pp_handle = G10_NULL_HANDLE;
+
+        goto done;
+    }
+
+    // construct a transfer buffer
+    p_transfer_buffer = SDL_CreateGPUTransferBuffer
+    (
+        p_instance->graphics.sdl3.device, 
+
+        &(SDL_GPUTransferBufferCreateInfo)
+        {
+            .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+            .size  = (u32) transfer_size
+        }
+    );
+
+    // error check
+    if ( p_transfer_buffer == (void *) 0 ) goto failed_to_create_buffer;
+
+    // map the transfer buffer into address space
+    p_map = SDL_MapGPUTransferBuffer(p_instance->graphics.sdl3.device, p_transfer_buffer, false);
+
+    // copy each stream from the file mapping to the transfer mapping
+    for (size_t i = 0; i < stream_count; i++)
+        SDL_memcpy(p_map + _streams[i]._range.offset, (const u8 *)p_data + _streams[i]._range.offset, _streams[i]._range.size);
+
+    // unmap the transfer buffer from address space
+    SDL_UnmapGPUTransferBuffer(p_instance->graphics.sdl3.device, p_transfer_buffer);
+
+    // one copy pass for every stream
+    p_cmd       = SDL_AcquireGPUCommandBuffer(p_instance->graphics.sdl3.device),
+    p_copy_pass = SDL_BeginGPUCopyPass(p_cmd);
+
+    for (size_t i = 0; i < stream_count; i++)
+    {
+
+        // construct a gpu buffer
+        *_streams[i].pp_handle = SDL_CreateGPUBuffer
+        (
+            p_instance->graphics.sdl3.device,
+
+            &(SDL_GPUBufferCreateInfo)
+            { 
+                .usage = _streams[i].usage,
+                .size  = (u32) _streams[i]._range.size
+            }
+        );
+
+        // upload from the transfer buffer to the gpu
+        SDL_UploadToGPUBuffer
+        (
+            p_copy_pass,
+
+            &(SDL_GPUTransferBufferLocation)
+            {
+                .transfer_buffer = p_transfer_buffer,
+                .offset          = (u32) _streams[i]._range.offset
+            },
+
+            &(SDL_GPUBufferRegion)
+            {
+                .buffer = *_streams[i].pp_handle,
+                .offset = 0, 
+                .size   = (u32) _streams[i]._range.size
+            },
+
+            false
+        );
+    }
+
+    // end the copy pass
+    SDL_EndGPUCopyPass(p_copy_pass),
+    SDL_SubmitGPUCommandBuffer(p_cmd);
+
+    // release the transfer buffer once the upload completes
+    SDL_ReleaseGPUTransferBuffer(p_instance->graphics.sdl3.device, p_transfer_buffer);
+
+    done:
+
+    // return a pointer to the caller
+    *pp_geometry = p_geometry;
+
+    // add the geometry to the cache
+    dict_add(p_instance->cache.p_geometry, p_geometry);
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_geometry:
+                #ifndef NDEBUG
+                    log_error("[g10] [sdl3] Null pointer provided for parameter \"pp_geometry\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_data:
+                #ifndef NDEBUG
+                    log_error("[g10] [sdl3] Null pointer provided for parameter \"p_data\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // format errors
+        {
+            malformed:
+                #ifndef NDEBUG
+                    log_error("[g10] [sdl3] Failed to load binary geometry in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // sdl errors
+        {
+            failed_to_create_buffer:
+                #ifndef NDEBUG
+                    log_error("[g10] [sdl3] Failed to create transfer buffer in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // release the geometry
+                g_sdl3_geometry_destroy(&p_geometry);
+
+                // error
+                return 0;
+        }
+
+        // standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
 int g_sdl3_geometry_bind ( render_pass *p_render_pass, geometry *p_geometry )
 {
 
@@ -2911,8 +3398,7 @@ int g_sdl3_geometry_bind ( render_pass *p_render_pass, geometry *p_geometry )
     if ( p_geometry == (void *) 0 ) goto no_geometry;
 
     // initialized data
-    SDL_GPUBufferBinding _bindings[GEOMETRY_QTY] = { 0 };
-    SDL_GPUBufferBinding _idx_bind = { 0 };
+    void *_p_bindings[GEOMETRY_QTY] = { 0 };
     size_t len = 0;
 
     // iterate through each vertex attribute
@@ -2926,36 +3412,18 @@ int g_sdl3_geometry_bind ( render_pass *p_render_pass, geometry *p_geometry )
         if ( NULL == p_geometry->_p_handles[_type] ) continue;
 
         // populate the binding
-        _bindings[len] = (SDL_GPUBufferBinding)
-        {
-            .buffer = p_geometry->_p_handles[_type],
-            .offset = 0,
-        };
+        _p_bindings[len] = p_geometry->_p_handles[_type];
 
         // increment the quantity of bindings
         len++;
     }
     
     // bind the drawable geometry
-    SDL_BindGPUVertexBuffers(
-        p_render_pass->p_handle,
-        0,
-        (const SDL_GPUBufferBinding *)&_bindings,
-        len
-    );
+    command_bind_vertex_buffers(p_render_pass, _p_bindings, len);
 
     // bind the index buffer
     if ( p_geometry->p_index_handle )
-        _idx_bind = (SDL_GPUBufferBinding)
-        {
-            .buffer = p_geometry->p_index_handle,
-            .offset = 0
-        },
-        SDL_BindGPUIndexBuffer(
-            p_render_pass->p_handle,
-            &_idx_bind,
-            SDL_GPU_INDEXELEMENTSIZE_32BIT
-        );
+        command_bind_index_buffer(p_render_pass, p_geometry->p_index_handle);
 
     // success
     return 1;
@@ -2976,6 +3444,74 @@ int g_sdl3_geometry_bind ( render_pass *p_render_pass, geometry *p_geometry )
     }
 }
 
+int g_sdl3_geometry_destroy ( geometry **pp_geometry )
+{
+
+    // argument check
+    if ( pp_geometry == (void *) 0 ) goto no_geometry;
+
+    // initialized data
+    g_instance *p_instance = g_active_instance();
+    geometry *p_geometry = *pp_geometry;
+
+    // fast exit
+    if ( p_geometry == (void *) 0 ) return 1;
+
+    // no more pointer for caller
+    *pp_geometry = (void *) 0;
+
+    // the null backend has no buffers to release
+    if ( G10_BACKEND_NULL == p_instance->backend )
+    {
+        memset(p_geometry->_p_handles, 0, sizeof(p_geometry->_p_handles));
+        p_geometry->p_index_handle = NULL;
+
+        for (size_t i = 0; i < 4; i++)
+            p_geometry->_parts[i].p_handle = NULL;
+    }
+
+    // release vertex buffers
+    for (size_t i = 0; i < GEOMETRY_QTY; i++)
+        if ( p_geometry->_p_handles[i] )
+            SDL_ReleaseGPUBuffer(p_instance->graphics.sdl3.device, p_geometry->_p_handles[i]);
+
+    // release the index buffer
+    if ( p_geometry->p_index_handle )
+        SDL_ReleaseGPUBuffer(p_instance->graphics.sdl3.device, p_geometry->p_index_handle);
+
+    // release parts
+    for (size_t i = 0; i < 4; i++)
+    {
+        if ( p_geometry->_parts[i].p_handle ) SDL_ReleaseGPUBuffer(p_instance->graphics.sdl3.device, p_geometry->_parts[i].p_handle);
+        if ( p_geometry->_parts[i].p_data   ) default_allocator(p_geometry->_parts[i].p_data, 0);
+    }
+
+    // release the bounds and local transform
+    if ( p_geometry->p_bounds          ) bv_destroy(&p_geometry->p_bounds);
+    if ( p_geometry->p_local_transform ) transform_destroy(&p_geometry->p_local_transform);
+
+    // release the geometry
+    p_geometry = default_allocator(p_geometry, 0);
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_geometry:
+                #ifndef NDEBUG
+                    log_error("[g10] [sdl3] Null pointer provided for parameter \"pp_geometry\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
 int g_sdl3_texture_construct ( texture **pp_texture, u32 width, u32 height, u32 channels, const void *p_data )
 {
 
@@ -3003,7 +3539,7 @@ int g_sdl3_texture_construct ( texture **pp_texture, u32 width, u32 height, u32
             .sample_count = 0
         };
 
-        p_texture->p_handle = SDL_CreateGPUTexture(p_instance->graphics.sdl3.device, &_ci);
+        p_texture->p_handle = ( G10_BACKEND_NULL == p_instance->backend ) ? G10_NULL_HANDLE : SDL_CreateGPUTexture(p_instance->graphics.sdl3.device, &_ci);
     }
 
     // return a pointer to the caller
@@ -3109,6 +3645,13 @@ int g_sdl3_texture_from_color ( texture **pp_texture, f32 r, f32 g, f32 b, f32 a
         .sample_count = 0
     };
 
+    // the null backend stands in for the texture
+    if ( G10_BACKEND_NULL == p_instance->backend )
+    {
+        p_texture->p_handle = G10_NULL_HANDLE;
+        goto cache_color;
+    }
+
     // create the texture
     p_texture->p_handle = SDL_CreateGPUTexture(p_instance->graphics.sdl3.device, &_ci);
 
@@ -3170,6 +3713,8 @@ int g_sdl3_texture_from_color ( texture **pp_texture, f32 r, f32 g, f32 b, f32 a
     // release transfer buffer
     SDL_ReleaseGPUTransferBuffer(p_instance->graphics.sdl3.device, p_transfer_buffer);
 
+    cache_color:
+
     // cache the color
     dict_add(p_instance->cache.p_texture, p_texture),
     printf("[g10] [texture] cached: %s\n", p_texture->_name);
@@ -3256,6 +3801,15 @@ int g_sdl3_texture_load_cubemap ( texture **pp_texture, const json_value *p_valu
         }
     }
 
+    // the null backend keeps the decode, and stands in for the texture
+    if ( G10_BACKEND_NULL == p_instance->backend )
+    {
+        for ( int i = 0; i < 6; i++ ) SDL_DestroySurface(faces[i]);
+        p_texture->p_handle = G10_NULL_HANDLE;
+        *pp_texture = p_texture;
+        return 1;
+    }
+
     // Create cubemap texture
     SDL_GPUTextureCreateInfo _ci = {
         .type = SDL_GPU_TEXTURETYPE_CUBE,
@@ -3321,11 +3875,12 @@ failed:
     return 0;
 }
 
-int g_sdl3_texture_load ( texture **pp_texture, const char *p_path )
+static int g_sdl3_texture_from_surface ( texture **pp_texture, SDL_Surface *p_surface )
 {
 
     // argument check
     if ( pp_texture == (void *) 0 ) goto no_texture;
+    if ( p_surface  == (void *) 0 ) goto no_surface;
 
     // initialized data
     g_instance *p_instance = g_active_instance();
@@ -3334,7 +3889,6 @@ int g_sdl3_texture_load ( texture **pp_texture, const char *p_path )
     if ( p_texture == (void *) 0 ) goto no_mem;
 
     // initialized data
-    SDL_Surface *p_surface = NULL;
     SDL_Surface *p_converted = NULL;
     SDL_GPUTextureCreateInfo _ci = { 0 };
     SDL_GPUTransferBufferCreateInfo _tci = { 0 };
@@ -3345,12 +3899,6 @@ int g_sdl3_texture_load ( texture **pp_texture, const char *p_path )
     SDL_GPUTextureTransferInfo _src = { 0 };
     SDL_GPUTextureRegion _dst = { 0 };
 
-    // load the image
-    p_surface = IMG_Load(p_path);
-
-    // error check
-    if ( p_surface == (void *) 0 ) goto failed_to_load_image;
-
     // convert to ABGR8888
     p_converted = SDL_ConvertSurface(p_surface, SDL_PIXELFORMAT_ABGR8888);
 
@@ -3373,6 +3921,13 @@ int g_sdl3_texture_load ( texture **pp_texture, const char *p_path )
         .sample_count = 0
     };
 
+    // the null backend keeps the decode, and stands in for the texture
+    if ( G10_BACKEND_NULL == p_instance->backend )
+    {
+        p_texture->p_handle = G10_NULL_HANDLE;
+        goto uploaded;
+    }
+
     // create the texture
     p_texture->p_handle = SDL_CreateGPUTexture(p_instance->graphics.sdl3.device, &_ci);
 
@@ -3434,6 +3989,8 @@ int g_sdl3_texture_load ( texture **pp_texture, const char *p_path )
     // release transfer buffer
     SDL_ReleaseGPUTransferBuffer(p_instance->graphics.sdl3.device, p_transfer_buffer);
 
+    uploaded:
+
     // destroy the surface
     SDL_DestroySurface(p_converted);
 
@@ -3455,18 +4012,18 @@ int g_sdl3_texture_load ( texture **pp_texture, const char *p_path )
 
                 // error
                 return 0;
-        }
 
-        // image errors
-        {
-            failed_to_load_image:
+            no_surface:
                 #ifndef NDEBUG
-                    log_error("[g10] [sdl3] Failed to load image from path \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
+                    log_error("[g10] [sdl3] Null pointer provided for parameter \"p_surface\" in call to function \"%s\"\n", __FUNCTION__);
                 #endif
 
                 // error
                 return 0;
+        }
 
+        // image errors
+        {
             failed_to_convert_surface:
                 #ifndef NDEBUG
                     log_error("[g10] [sdl3] Failed to convert surface in call to function \"%s\"\n", __FUNCTION__);
@@ -3497,6 +4054,149 @@ int g_sdl3_texture_load ( texture **pp_texture, const char *p_path )
     }
 }
 
+int g_sdl3_texture_load ( texture **pp_texture, const char *p_path )
+{
+
+    // argument check
+    if ( pp_texture == (void *) 0 ) goto no_texture;
+    if ( p_path     == (void *) 0 ) goto no_path;
+
+    // initialized data
+    SDL_Surface *p_surface = IMG_Load(p_path);
+
+    // error check
+    if ( p_surface == (void *) 0 ) goto failed_to_load_image;
+
+    // done
+    return g_sdl3_texture_from_surface(pp_texture, p_surface);
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_texture:
+                #ifndef NDEBUG
+                    log_error("[g10] [sdl3] Null pointer provided for parameter \"pp_texture\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_path:
+                #ifndef NDEBUG
+                    log_error("[g10] [sdl3] Null pointer provided for parameter \"p_path\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // image errors
+        {
+            failed_to_load_image:
+                #ifndef NDEBUG
+                    log_error("[g10] [sdl3] Failed to load image from path \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int g_sdl3_texture_from_memory ( texture **pp_texture, const void *p_data, size_t size )
+{
+
+    // argument check
+    if ( pp_texture == (void *) 0 ) goto no_texture;
+    if ( p_data     == (void *) 0 ) goto no_data;
+
+    // initialized data
+    SDL_Surface *p_surface = IMG_Load_IO(SDL_IOFromConstMem(p_data, size), true);
+
+    // error check
+    if ( p_surface == (void *) 0 ) goto failed_to_decode_image;
+
+    // done
+    return g_sdl3_texture_from_surface(pp_texture, p_surface);
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_texture:
+                #ifndef NDEBUG
+                    log_error("[g10] [sdl3] Null pointer provided for parameter \"pp_texture\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_data:
+                #ifndef NDEBUG
+                    log_error("[g10] [sdl3] Null pointer provided for parameter \"p_data\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // image errors
+        {
+            failed_to_decode_image:
+                #ifndef NDEBUG
+                    log_error("[g10] [sdl3] Failed to decode image in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int g_sdl3_texture_destroy ( texture **pp_texture )
+{
+
+    // argument check
+    if ( pp_texture == (void *) 0 ) goto no_texture;
+
+    // initialized data
+    g_instance *p_instance = g_active_instance();
+    texture *p_texture = *pp_texture;
+
+    // fast exit
+    if ( p_texture == (void *) 0 ) return 1;
+
+    // no more pointer for caller
+    *pp_texture = (void *) 0;
+
+    // release the gpu texture
+    if ( p_texture->p_handle && G10_BACKEND_NULL != p_instance->backend ) SDL_ReleaseGPUTexture(p_instance->graphics.sdl3.device, p_texture->p_handle);
+
+    // release the texture
+    p_texture = default_allocator(p_texture, 0);
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_texture:
+                #ifndef NDEBUG
+                    log_error("[g10] [sdl3] Null pointer provided for parameter \"pp_texture\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
 int g_sdl3_sampler_from_json ( sampler **pp_sampler, const json_value *p_value )
 {
     
@@ -3568,7 +4268,7 @@ int g_sdl3_sampler_from_json ( sampler **pp_sampler, const json_value *p_value )
     }
 
     // construct the sampler
-    p_sampler->p_handle = SDL_CreateGPUSampler(p_instance->graphics.sdl3.device, &_ci);
+    p_sampler->p_handle = ( G10_BACKEND_NULL == p_instance->backend ) ? G10_NULL_HANDLE : SDL_CreateGPUSampler(p_instance->graphics.sdl3.device, &_ci);
 
     // return a pointer to the caller
     *pp_sampler = p_sampler;
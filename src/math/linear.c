@@ -3,6 +3,81 @@
 
 #define DEG_TO_RAD ((double)M_PI/(double)180.0)
 
+// simd kernels
+#ifndef G10_LINEAR_SCALAR
+
+    // x86. sse2 is the x86-64 baseline, avx2 is detected at run time
+    #if defined(__SSE2__)
+        #include <immintrin.h>
+        #define LINEAR_HAS_SSE
+        #define LINEAR_HAS_AVX2
+    #endif
+
+    // aarch64
+    #if defined(__ARM_NEON) && defined(__aarch64__)
+        #include <arm_neon.h>
+        #define LINEAR_HAS_NEON
+    #endif
+#endif
+
+// aligned storage
+#ifdef LINEAR_HAS_SSE
+    #ifdef G10_LINEAR_ALIGNED
+        #define LINEAR_LOAD(p)     _mm_load_ps(p)
+        #define LINEAR_STORE(p, v) _mm_store_ps(p, v)
+    #else
+        #define LINEAR_LOAD(p)     _mm_loadu_ps(p)
+        #define LINEAR_STORE(p, v) _mm_storeu_ps(p, v)
+    #endif
+
+    #define LINEAR_SHUFFLE(a, b, x, y, z, w) _mm_shuffle_ps(a, b, _MM_SHUFFLE(w, z, y, x))
+    #define LINEAR_SWIZZLE(v, x, y, z, w)    LINEAR_SHUFFLE(v, v, x, y, z, w)
+#endif
+
+// forward declarations
+/// kernels
+static u0 mat4_mul_vec4_resolve ( vec4 *p_result, const mat4 *p_m, const vec4 *p_v );
+static u0 mat4_mul_mat4_resolve ( mat4 *p_result, const mat4 *p_m, const mat4 *p_n );
+static u0 mat4_mul_mat4_affine_resolve ( mat4 *p_result, const mat4 *p_m, const mat4 *p_n );
+static u0 mat4_inverse_resolve  ( mat4 *p_result, const mat4 *p_m );
+static u0 mat4_model_resolve    ( mat4 *p_result, const mat4 *p_rotation, vec3 location, vec3 scale );
+static u0 mat4_mul_vec4_array_resolve ( vec4 *p_result, const mat4 *p_m, const vec4 *p_v, size_t count );
+static u0 mat4_mul_vec4_soa_resolve   ( vec4_soa *p_result, const mat4 *p_m, const vec4_soa *p_v, size_t count );
+
+// data
+/// the kernels in use. each entry resolves the kernels on first call
+static struct
+{
+    enum linear_isa_e isa;
+    u0 (*pfn_mat4_mul_vec4) ( vec4 *p_result, const mat4 *p_m, const vec4 *p_v );
+    u0 (*pfn_mat4_mul_mat4) ( mat4 *p_result, const mat4 *p_m, const mat4 *p_n );
+    u0 (*pfn_mat4_mul_mat4_affine) ( mat4 *p_result, const mat4 *p_m, const mat4 *p_n );
+    u0 (*pfn_mat4_inverse)  ( mat4 *p_result, const mat4 *p_m );
+    u0 (*pfn_mat4_model)    ( mat4 *p_result, const mat4 *p_rotation, vec3 location, vec3 scale );
+
+    // batches
+    u0 (*pfn_mat4_mul_vec4_array) ( vec4 *p_result, const mat4 *p_m, const vec4 *p_v, size_t count );
+    u0 (*pfn_mat4_mul_vec4_soa)   ( vec4_soa *p_result, const mat4 *p_m, const vec4_soa *p_v, size_t count );
+} _linear = 
+{
+    .isa                      = LINEAR_ISA_QTY,
+    .pfn_mat4_mul_vec4        = mat4_mul_vec4_resolve,
+    .pfn_mat4_mul_mat4        = mat4_mul_mat4_resolve,
+    .pfn_mat4_mul_mat4_affine = mat4_mul_mat4_affine_resolve,
+    .pfn_mat4_inverse         = mat4_inverse_resolve,
+    .pfn_mat4_model           = mat4_model_resolve,
+    .pfn_mat4_mul_vec4_array  = mat4_mul_vec4_array_resolve,
+    .pfn_mat4_mul_vec4_soa    = mat4_mul_vec4_soa_resolve
+};
+
+static const char *_linear_isa_names[LINEAR_ISA_QTY] = 
+{
+    [LINEAR_ISA_SCALAR] = "scalar",
+    [LINEAR_ISA_SSE]    = "sse",
+    [LINEAR_ISA_AVX2]   = "avx2",
+    [LINEAR_ISA_NEON]   = "neon"
+};
+
 // function definitions
 u0 vec2_add_vec2 ( vec2 *p_result, vec2 a, vec2 b )
 {
@@ -311,45 +386,12 @@ int mat3_pack ( void *p_buffer, mat3 *p_m )
 
 u0 mat4_mul_vec4 ( vec4 *p_result, mat4 m, vec4 v )
 {
-    // x' = Row0 . v = (a, e, i, m) . v
-    *p_result = (vec4){
-        .x = m.a * v.x + m.e * v.y + m.i * v.z + m.m * v.w,
-        .y = m.b * v.x + m.f * v.y + m.j * v.z + m.n * v.w,
-        .z = m.c * v.x + m.g * v.y + m.k * v.z + m.o * v.w,
-        .w = m.d * v.x + m.h * v.y + m.l * v.z + m.p * v.w
-    };
+    _linear.pfn_mat4_mul_vec4(p_result, &m, &v);
 }
 
 u0 mat4_mul_mat4 ( mat4 *p_result, mat4 m, mat4 n )
 {
-    // result = M * N
-    // res_Col0 = M * N_Col0
-    
-    *p_result = (mat4){
-        // col 0
-        .a = m.a * n.a + m.e * n.b + m.i * n.c + m.m * n.d,
-        .b = m.b * n.a + m.f * n.b + m.j * n.c + m.n * n.d,
-        .c = m.c * n.a + m.g * n.b + m.k * n.c + m.o * n.d,
-        .d = m.d * n.a + m.h * n.b + m.l * n.c + m.p * n.d,
-
-        // col 1
-        .e = m.a * n.e + m.e * n.f + m.i * n.g + m.m * n.h,
-        .f = m.b * n.e + m.f * n.f + m.j * n.g + m.n * n.h,
-        .g = m.c * n.e + m.g * n.f + m.k * n.g + m.o * n.h,
-        .h = m.d * n.e + m.h * n.f + m.l * n.g + m.p * n.h,
-
-        // col 2
-        .i = m.a * n.i + m.e * n.j + m.i * n.k + m.m * n.l,
-        .j = m.b * n.i + m.f * n.j + m.j * n.k + m.n * n.l,
-        .k = m.c * n.i + m.g * n.j + m.k * n.k + m.o * n.l,
-        .l = m.d * n.i + m.h * n.j + m.l * n.k + m.p * n.l,
-
-        // col 3
-        .m = m.a * n.m + m.e * n.n + m.i * n.o + m.m * n.p,
-        .n = m.b * n.m + m.f * n.n + m.j * n.o + m.n * n.p,
-        .o = m.c * n.m + m.g * n.n + m.k * n.o + m.o * n.p,
-        .p = m.d * n.m + m.h * n.n + m.l * n.o + m.p * n.p
-    };
+    _linear.pfn_mat4_mul_mat4(p_result, &m, &n);
 }
 
 u0 mat4_transpose ( mat4 *p_result, mat4 m )
@@ -364,62 +406,7 @@ u0 mat4_transpose ( mat4 *p_result, mat4 m )
 
 u0 mat4_inverse ( mat4 *p_result, mat4 m )
 {
-    // mapping for Col-Major
-    // m00=a, m10=b, m20=c, m30=d (Col 0)
-    // m01=e, m11=f, m21=g, m31=h (Col 1)
-    // m02=i, m12=j, m22=k, m32=l (Col 2)
-    // m03=m, m13=n, m23=o, m33=p (Col 3)
-
-    float m00 = m.a, m10 = m.b, m20 = m.c, m30 = m.d;
-    float m01 = m.e, m11 = m.f, m21 = m.g, m31 = m.h;
-    float m02 = m.i, m12 = m.j, m22 = m.k, m32 = m.l;
-    float m03 = m.m, m13 = m.n, m23 = m.o, m33 = m.p;
-
-    float a00 = m00 * m11 - m01 * m10;
-    float a01 = m00 * m12 - m02 * m10;
-    float a02 = m00 * m13 - m03 * m10;
-    float a03 = m01 * m12 - m02 * m11;
-    float a04 = m01 * m13 - m03 * m11;
-    float a05 = m02 * m13 - m03 * m12;
-    float a06 = m20 * m31 - m21 * m30;
-    float a07 = m20 * m32 - m22 * m30;
-    float a08 = m20 * m33 - m23 * m30;
-    float a09 = m21 * m32 - m22 * m31;
-    float a10 = m21 * m33 - m23 * m31;
-    float a11 = m22 * m33 - m23 * m32;
-
-    float det = a00 * a11 - a01 * a10 + a02 * a09 + a03 * a08 - a04 * a07 + a05 * a06;
-
-    if (det == 0.0f)
-    {
-        mat4_identity(p_result);
-        return;
-    }
-
-    float invDet = 1.0f / det;
-
-    *p_result = (mat4)
-    {
-        .a = ( m11 * a11 - m12 * a10 + m13 * a09) * invDet,
-        .b = (-m10 * a11 + m12 * a08 - m13 * a07) * invDet,
-        .c = ( m10 * a10 - m11 * a08 + m13 * a06) * invDet,
-        .d = (-m10 * a09 + m11 * a07 - m12 * a06) * invDet,
-        
-        .e = (-m01 * a11 + m02 * a10 - m03 * a09) * invDet,
-        .f = ( m00 * a11 - m02 * a08 + m03 * a07) * invDet,
-        .g = (-m00 * a10 + m01 * a08 - m03 * a06) * invDet,
-        .h = ( m00 * a09 - m01 * a07 + m02 * a06) * invDet,
-        
-        .i = ( m31 * a05 - m32 * a04 + m33 * a03) * invDet,
-        .j = (-m30 * a05 + m32 * a02 - m33 * a01) * invDet,
-        .k = ( m30 * a04 - m31 * a02 + m33 * a00) * invDet,
-        .l = (-m30 * a03 + m31 * a01 - m32 * a00) * invDet,
-        
-        .m = (-m21 * a05 + m22 * a04 - m23 * a03) * invDet,
-        .n = ( m20 * a05 - m22 * a02 + m23 * a01) * invDet,
-        .o = (-m20 * a04 + m21 * a02 - m23 * a00) * invDet,
-        .p = ( m20 * a03 - m21 * a01 + m22 * a00) * invDet
-    };
+    _linear.pfn_mat4_inverse(p_result, &m);
 }
 
 u0 mat4_identity ( mat4 *p_result )
@@ -513,16 +500,22 @@ u0 mat4_rotation_from_vec3 ( mat4 *p_result, vec3 rotation )
 
 u0 mat4_model_from_vec3 ( mat4 *p_result, vec3 location, vec3 rotation, vec3 scale )
 {
-    mat4 _location = { 0 }, _rotation = { 0 }, _scale = { 0 };
-    mat4 _rs = { 0 };
 
-    mat4_translation(&_location, location);
+    // initialized data
+    mat4 _rotation = { 0 };
+
+    // the rotation is scalar; the kernel scales it and adds the translation
     mat4_rotation_from_vec3(&_rotation, rotation);
-    mat4_scale(&_scale, scale);
 
     // m = T * R * S
-    mat4_mul_mat4(&_rs, _rotation, _scale);
-    mat4_mul_mat4(p_result, _location, _rs);
+    _linear.pfn_mat4_model(p_result, &_rotation, location, scale);
+}
+
+u0 mat4_model_from_rotation ( mat4 *p_result, vec3 location, mat4 rotation, vec3 scale )
+{
+
+    // m = T * R * S
+    _linear.pfn_mat4_model(p_result, &rotation, location, scale);
 }
 
 u0 mat4_model_from_bounds ( mat4 *p_result, vec3 min, vec3 max )
@@ -551,3 +544,1149 @@ int mat4_pack ( void *p_buffer, mat4 *p_m )
         p_m->m, p_m->n, p_m->o, p_m->p
     );
 }
+
+u0 mat4_mul_mat4_affine ( mat4 *p_result, mat4 m, mat4 n )
+{
+    _linear.pfn_mat4_mul_mat4_affine(p_result, &m, &n);
+}
+
+u0 mat4_inverse_affine ( mat4 *p_result, mat4 m )
+{
+
+    // the rows of the inverse 3x3 are the cross products of its columns
+    vec3 r0 = { m.f * m.k - m.g * m.j, m.g * m.i - m.e * m.k, m.e * m.j - m.f * m.i },
+         r1 = { m.j * m.c - m.k * m.b, m.k * m.a - m.i * m.c, m.i * m.b - m.j * m.a },
+         r2 = { m.b * m.g - m.c * m.f, m.c * m.e - m.a * m.g, m.a * m.f - m.b * m.e };
+    float det = m.a * r0.x + m.b * r0.y + m.c * r0.z;
+
+    // singular -> no inverse
+    if ( det == 0.f ) { mat4_identity(p_result); return; }
+
+    // scale the rows
+    det = 1.f / det;
+    r0 = (vec3) { r0.x * det, r0.y * det, r0.z * det },
+    r1 = (vec3) { r1.x * det, r1.y * det, r1.z * det },
+    r2 = (vec3) { r2.x * det, r2.y * det, r2.z * det };
+
+    // t' = -inv(L) * t
+    *p_result = (mat4){
+        .a = r0.x, .b = r1.x, .c = r2.x, .d = 0.f,
+        .e = r0.y, .f = r1.y, .g = r2.y, .h = 0.f,
+        .i = r0.z, .j = r1.z, .k = r2.z, .l = 0.f,
+        .m = -( r0.x * m.m + r0.y * m.n + r0.z * m.o ),
+        .n = -( r1.x * m.m + r1.y * m.n + r1.z * m.o ),
+        .o = -( r2.x * m.m + r2.y * m.n + r2.z * m.o ),
+        .p = 1.f
+    };
+}
+
+u0 mat4_inverse_rigid ( mat4 *p_result, mat4 m )
+{
+
+    // t' = -transpose(R) * t
+    *p_result = (mat4){
+        .a = m.a, .b = m.e, .c = m.i, .d = 0.f,
+        .e = m.b, .f = m.f, .g = m.j, .h = 0.f,
+        .i = m.c, .j = m.g, .k = m.k, .l = 0.f,
+        .m = -( m.a * m.m + m.b * m.n + m.c * m.o ),
+        .n = -( m.e * m.m + m.f * m.n + m.g * m.o ),
+        .o = -( m.i * m.m + m.j * m.n + m.k * m.o ),
+        .p = 1.f
+    };
+}
+
+u0 mat4_mul_point ( vec3 *p_result, mat4 m, vec3 p )
+{
+    *p_result = (vec3){
+        .x = m.a * p.x + m.e * p.y + m.i * p.z + m.m,
+        .y = m.b * p.x + m.f * p.y + m.j * p.z + m.n,
+        .z = m.c * p.x + m.g * p.y + m.k * p.z + m.o
+    };
+}
+
+u0 mat4_mul_direction ( vec3 *p_result, mat4 m, vec3 d )
+{
+    *p_result = (vec3){
+        .x = m.a * d.x + m.e * d.y + m.i * d.z,
+        .y = m.b * d.x + m.f * d.y + m.j * d.z,
+        .z = m.c * d.x + m.g * d.y + m.k * d.z
+    };
+}
+
+u0 mat4_normal_matrix ( mat3 *p_result, mat4 m )
+{
+
+    // the columns of the cofactor matrix are the cross products of the columns
+    vec3 c0 = { m.f * m.k - m.g * m.j, m.g * m.i - m.e * m.k, m.e * m.j - m.f * m.i },
+         c1 = { m.j * m.c - m.k * m.b, m.k * m.a - m.i * m.c, m.i * m.b - m.j * m.a },
+         c2 = { m.b * m.g - m.c * m.f, m.c * m.e - m.a * m.g, m.a * m.f - m.b * m.e };
+    float det = m.a * c0.x + m.b * c0.y + m.c * c0.z;
+
+    // singular -> no inverse
+    if ( det == 0.f ) { mat3_identity(p_result); return; }
+
+    // inverse transpose = cofactor / det
+    det = 1.f / det;
+
+    *p_result = (mat3){
+        .a = c0.x * det, .b = c0.y * det, .c = c0.z * det,
+        .d = c1.x * det, .e = c1.y * det, .f = c1.z * det,
+        .g = c2.x * det, .h = c2.y * det, .i = c2.z * det
+    };
+}
+
+u0 mat4_mul_vec4_array ( vec4 *p_result, mat4 m, const vec4 *p_v, size_t count )
+{
+    _linear.pfn_mat4_mul_vec4_array(p_result, &m, p_v, count);
+}
+
+u0 mat4_mul_vec4_soa ( vec4_soa *p_result, mat4 m, vec4_soa v, size_t count )
+{
+    _linear.pfn_mat4_mul_vec4_soa(p_result, &m, &v, count);
+}
+
+u0 mat4_mul_mat4_array ( mat4 *p_result, const mat4 *p_m, const mat4 *p_n, size_t count )
+{
+
+    // each product, without copying the operands
+    for (size_t i = 0; i < count; i++)
+        _linear.pfn_mat4_mul_mat4(&p_result[i], &p_m[i], &p_n[i]);
+}
+
+u0 mat4_model_from_vec3_array ( mat4 *p_result, const vec3 *p_location, const vec3 *p_rotation, const vec3 *p_scale, size_t count )
+{
+
+    // each model matrix
+    for (size_t i = 0; i < count; i++)
+    {
+
+        // initialized data
+        mat4 _rotation = { 0 };
+
+        // the rotation is scalar; the kernel scales it and adds the translation
+        mat4_rotation_from_vec3(&_rotation, p_rotation[i]);
+
+        // m = T * R * S
+        _linear.pfn_mat4_model(&p_result[i], &_rotation, p_location[i], p_scale[i]);
+    }
+}
+
+// kernels
+/// scalar
+static u0 mat4_mul_vec4_scalar ( vec4 *p_result, const mat4 *p_m, const vec4 *p_v )
+{
+
+    // initialized data
+    mat4 m = *p_m;
+    vec4 v = *p_v;
+
+    // x' = Row0 . v = (a, e, i, m) . v
+    *p_result = (vec4){
+        .x = m.a * v.x + m.e * v.y + m.i * v.z + m.m * v.w,
+        .y = m.b * v.x + m.f * v.y + m.j * v.z + m.n * v.w,
+        .z = m.c * v.x + m.g * v.y + m.k * v.z + m.o * v.w,
+        .w = m.d * v.x + m.h * v.y + m.l * v.z + m.p * v.w
+    };
+}
+
+static u0 mat4_mul_mat4_scalar ( mat4 *p_result, const mat4 *p_m, const mat4 *p_n )
+{
+
+    // initialized data
+    mat4 m = *p_m,
+         n = *p_n;
+
+    // result = M * N
+    // res_Col0 = M * N_Col0
+    
+    *p_result = (mat4){
+        // col 0
+        .a = m.a * n.a + m.e * n.b + m.i * n.c + m.m * n.d,
+        .b = m.b * n.a + m.f * n.b + m.j * n.c + m.n * n.d,
+        .c = m.c * n.a + m.g * n.b + m.k * n.c + m.o * n.d,
+        .d = m.d * n.a + m.h * n.b + m.l * n.c + m.p * n.d,
+
+        // col 1
+        .e = m.a * n.e + m.e * n.f + m.i * n.g + m.m * n.h,
+        .f = m.b * n.e + m.f * n.f + m.j * n.g + m.n * n.h,
+        .g = m.c * n.e + m.g * n.f + m.k * n.g + m.o * n.h,
+        .h = m.d * n.e + m.h * n.f + m.l * n.g + m.p * n.h,
+
+        // col 2
+        .i = m.a * n.i + m.e * n.j + m.i * n.k + m.m * n.l,
+        .j = m.b * n.i + m.f * n.j + m.j * n.k + m.n * n.l,
+        .k = m.c * n.i + m.g * n.j + m.k * n.k + m.o * n.l,
+        .l = m.d * n.i + m.h * n.j + m.l * n.k + m.p * n.l,
+
+        // col 3
+        .m = m.a * n.m + m.e * n.n + m.i * n.o + m.m * n.p,
+        .n = m.b * n.m + m.f * n.n + m.j * n.o + m.n * n.p,
+        .o = m.c * n.m + m.g * n.n + m.k * n.o + m.o * n.p,
+        .p = m.d * n.m + m.h * n.n + m.l * n.o + m.p * n.p
+    };
+}
+
+static u0 mat4_mul_mat4_affine_scalar ( mat4 *p_result, const mat4 *p_m, const mat4 *p_n )
+{
+
+    // initialized data
+    mat4 m = *p_m,
+         n = *p_n;
+
+    // the bottom row of n is [ 0 0 0 1 ], so the last column of m only 
+    // reaches the last column of the result. the bottom row of the result 
+    // follows from the bottom row of m, and stays in the same shape as 
+    // mat4_mul_mat4 so the compiler vectorizes both the same way
+    *p_result = (mat4){
+        // col 0
+        .a = m.a * n.a + m.e * n.b + m.i * n.c,
+        .b = m.b * n.a + m.f * n.b + m.j * n.c,
+        .c = m.c * n.a + m.g * n.b + m.k * n.c,
+        .d = m.d * n.a + m.h * n.b + m.l * n.c,
+
+        // col 1
+        .e = m.a * n.e + m.e * n.f + m.i * n.g,
+        .f = m.b * n.e + m.f * n.f + m.j * n.g,
+        .g = m.c * n.e + m.g * n.f + m.k * n.g,
+        .h = m.d * n.e + m.h * n.f + m.l * n.g,
+
+        // col 2
+        .i = m.a * n.i + m.e * n.j + m.i * n.k,
+        .j = m.b * n.i + m.f * n.j + m.j * n.k,
+        .k = m.c * n.i + m.g * n.j + m.k * n.k,
+        .l = m.d * n.i + m.h * n.j + m.l * n.k,
+
+        // col 3
+        .m = m.a * n.m + m.e * n.n + m.i * n.o + m.m,
+        .n = m.b * n.m + m.f * n.n + m.j * n.o + m.n,
+        .o = m.c * n.m + m.g * n.n + m.k * n.o + m.o,
+        .p = m.d * n.m + m.h * n.n + m.l * n.o + m.p
+    };
+}
+
+static u0 mat4_inverse_scalar ( mat4 *p_result, const mat4 *p_m )
+{
+
+    // initialized data
+    mat4 m = *p_m;
+
+    // mapping for Col-Major
+    // m00=a, m10=b, m20=c, m30=d (Col 0)
+    // m01=e, m11=f, m21=g, m31=h (Col 1)
+    // m02=i, m12=j, m22=k, m32=l (Col 2)
+    // m03=m, m13=n, m23=o, m33=p (Col 3)
+
+    float m00 = m.a, m10 = m.b, m20 = m.c, m30 = m.d;
+    float m01 = m.e, m11 = m.f, m21 = m.g, m31 = m.h;
+    float m02 = m.i, m12 = m.j, m22 = m.k, m32 = m.l;
+    float m03 = m.m, m13 = m.n, m23 = m.o, m33 = m.p;
+
+    float a00 = m00 * m11 - m01 * m10;
+    float a01 = m00 * m12 - m02 * m10;
+    float a02 = m00 * m13 - m03 * m10;
+    float a03 = m01 * m12 - m02 * m11;
+    float a04 = m01 * m13 - m03 * m11;
+    float a05 = m02 * m13 - m03 * m12;
+    float a06 = m20 * m31 - m21 * m30;
+    float a07 = m20 * m32 - m22 * m30;
+    float a08 = m20 * m33 - m23 * m30;
+    float a09 = m21 * m32 - m22 * m31;
+    float a10 = m21 * m33 - m23 * m31;
+    float a11 = m22 * m33 - m23 * m32;
+
+    float det = a00 * a11 - a01 * a10 + a02 * a09 + a03 * a08 - a04 * a07 + a05 * a06;
+
+    if (det == 0.0f)
+    {
+        mat4_identity(p_result);
+        return;
+    }
+
+    float invDet = 1.0f / det;
+
+    *p_result = (mat4)
+    {
+        .a = ( m11 * a11 - m12 * a10 + m13 * a09) * invDet,
+        .b = (-m10 * a11 + m12 * a08 - m13 * a07) * invDet,
+        .c = ( m10 * a10 - m11 * a08 + m13 * a06) * invDet,
+        .d = (-m10 * a09 + m11 * a07 - m12 * a06) * invDet,
+        
+        .e = (-m01 * a11 + m02 * a10 - m03 * a09) * invDet,
+        .f = ( m00 * a11 - m02 * a08 + m03 * a07) * invDet,
+        .g = (-m00 * a10 + m01 * a08 - m03 * a06) * invDet,
+        .h = ( m00 * a09 - m01 * a07 + m02 * a06) * invDet,
+        
+        .i = ( m31 * a05 - m32 * a04 + m33 * a03) * invDet,
+        .j = (-m30 * a05 + m32 * a02 - m33 * a01) * invDet,
+        .k = ( m30 * a04 - m31 * a02 + m33 * a00) * invDet,
+        .l = (-m30 * a03 + m31 * a01 - m32 * a00) * invDet,
+        
+        .m = (-m21 * a05 + m22 * a04 - m23 * a03) * invDet,
+        .n = ( m20 * a05 - m22 * a02 + m23 * a01) * invDet,
+        .o = (-m20 * a04 + m21 * a02 - m23 * a00) * invDet,
+        .p = ( m20 * a03 - m21 * a01 + m22 * a00) * invDet
+    };
+}
+
+static u0 mat4_model_scalar ( mat4 *p_result, const mat4 *p_rotation, vec3 location, vec3 scale )
+{
+
+    // initialized data
+    mat4 _location = { 0 }, _scale = { 0 };
+    mat4 _rs = { 0 };
+
+    mat4_translation(&_location, location);
+    mat4_scale(&_scale, scale);
+
+    // m = T * R * S
+    mat4_mul_mat4_scalar(&_rs, p_rotation, &_scale);
+    mat4_mul_mat4_scalar(p_result, &_location, &_rs);
+}
+
+static u0 mat4_mul_vec4_array_scalar ( vec4 *p_result, const mat4 *p_m, const vec4 *p_v, size_t count )
+{
+
+    // each vector
+    for (size_t i = 0; i < count; i++)
+        mat4_mul_vec4_scalar(&p_result[i], p_m, &p_v[i]);
+}
+
+// the vectors of a soa batch from i to count. the simd kernels finish with this
+static u0 mat4_mul_vec4_soa_range ( vec4_soa *p_result, const mat4 *p_m, const vec4_soa *p_v, size_t i, size_t count )
+{
+
+    // each vector
+    for (; i < count; i++)
+    {
+
+        // initialized data
+        vec4 v = { p_v->p_x[i], p_v->p_y[i], p_v->p_z[i], ( p_v->p_w ) ? p_v->p_w[i] : 1.f },
+             r = { 0 };
+
+        // m * v
+        mat4_mul_vec4_scalar(&r, p_m, &v);
+
+        // store the result
+        p_result->p_x[i] = r.x,
+        p_result->p_y[i] = r.y,
+        p_result->p_z[i] = r.z;
+        if ( p_result->p_w ) p_result->p_w[i] = r.w;
+    }
+}
+
+static u0 mat4_mul_vec4_soa_scalar ( vec4_soa *p_result, const mat4 *p_m, const vec4_soa *p_v, size_t count )
+{
+    mat4_mul_vec4_soa_range(p_result, p_m, p_v, 0, count);
+}
+
+/// sse
+#ifdef LINEAR_HAS_SSE
+
+// m * v, for one column v
+static inline __m128 linear_sse_column ( __m128 c0, __m128 c1, __m128 c2, __m128 c3, __m128 v )
+{
+
+    // initialized data
+    __m128 r = _mm_mul_ps(c0, LINEAR_SWIZZLE(v, 0, 0, 0, 0));
+
+    // accumulate the rest of the columns
+    r = _mm_add_ps(r, _mm_mul_ps(c1, LINEAR_SWIZZLE(v, 1, 1, 1, 1)));
+    r = _mm_add_ps(r, _mm_mul_ps(c2, LINEAR_SWIZZLE(v, 2, 2, 2, 2)));
+    r = _mm_add_ps(r, _mm_mul_ps(c3, LINEAR_SWIZZLE(v, 3, 3, 3, 3)));
+
+    // done
+    return r;
+}
+
+// m * v, for one column v with w = 0. the last column of m drops out
+static inline __m128 linear_sse_affine_column ( __m128 c0, __m128 c1, __m128 c2, __m128 v )
+{
+
+    // initialized data
+    __m128 r = _mm_mul_ps(c0, LINEAR_SWIZZLE(v, 0, 0, 0, 0));
+
+    // accumulate the rest of the columns
+    r = _mm_add_ps(r, _mm_mul_ps(c1, LINEAR_SWIZZLE(v, 1, 1, 1, 1)));
+    r = _mm_add_ps(r, _mm_mul_ps(c2, LINEAR_SWIZZLE(v, 2, 2, 2, 2)));
+
+    // done
+    return r;
+}
+
+// 2x2 matrices, stored [ m00 m01 m10 m11 ]. a * b
+static inline __m128 linear_sse_mat2_mul ( __m128 a, __m128 b )
+{
+    return _mm_add_ps
+    (
+        _mm_mul_ps(a, LINEAR_SWIZZLE(b, 0, 3, 0, 3)),
+        _mm_mul_ps(LINEAR_SWIZZLE(a, 1, 0, 3, 2), LINEAR_SWIZZLE(b, 2, 1, 2, 1))
+    );
+}
+
+// adj(a) * b
+static inline __m128 linear_sse_mat2_adj_mul ( __m128 a, __m128 b )
+{
+    return _mm_sub_ps
+    (
+        _mm_mul_ps(LINEAR_SWIZZLE(a, 3, 3, 0, 0), b),
+        _mm_mul_ps(LINEAR_SWIZZLE(a, 1, 1, 2, 2), LINEAR_SWIZZLE(b, 2, 3, 0, 1))
+    );
+}
+
+// a * adj(b)
+static inline __m128 linear_sse_mat2_mul_adj ( __m128 a, __m128 b )
+{
+    return _mm_sub_ps
+    (
+        _mm_mul_ps(a, LINEAR_SWIZZLE(b, 3, 0, 3, 0)),
+        _mm_mul_ps(LINEAR_SWIZZLE(a, 1, 0, 3, 2), LINEAR_SWIZZLE(b, 2, 1, 2, 1))
+    );
+}
+
+static u0 mat4_mul_vec4_sse ( vec4 *p_result, const mat4 *p_m, const vec4 *p_v )
+{
+
+    // initialized data
+    const float *p_a = &p_m->a;
+
+    // m * v
+    LINEAR_STORE(&p_result->x, linear_sse_column(LINEAR_LOAD(p_a), LINEAR_LOAD(p_a + 4), LINEAR_LOAD(p_a + 8), LINEAR_LOAD(p_a + 12), LINEAR_LOAD(&p_v->x)));
+}
+
+static u0 mat4_mul_mat4_sse ( mat4 *p_result, const mat4 *p_m, const mat4 *p_n )
+{
+
+    // initialized data
+    const float *p_a = &p_m->a,
+                *p_b = &p_n->a;
+    float       *p_r = &p_result->a;
+    __m128 c0 = LINEAR_LOAD(p_a), c1 = LINEAR_LOAD(p_a + 4), c2 = LINEAR_LOAD(p_a + 8), c3 = LINEAR_LOAD(p_a + 12),
+           n0 = LINEAR_LOAD(p_b), n1 = LINEAR_LOAD(p_b + 4), n2 = LINEAR_LOAD(p_b + 8), n3 = LINEAR_LOAD(p_b + 12);
+
+    // each column of the result is m times a column of n
+    LINEAR_STORE(p_r     , linear_sse_column(c0, c1, c2, c3, n0));
+    LINEAR_STORE(p_r +  4, linear_sse_column(c0, c1, c2, c3, n1));
+    LINEAR_STORE(p_r +  8, linear_sse_column(c0, c1, c2, c3, n2));
+    LINEAR_STORE(p_r + 12, linear_sse_column(c0, c1, c2, c3, n3));
+}
+
+static u0 mat4_mul_mat4_affine_sse ( mat4 *p_result, const mat4 *p_m, const mat4 *p_n )
+{
+
+    // initialized data
+    const float *p_a = &p_m->a,
+                *p_b = &p_n->a;
+    float       *p_r = &p_result->a;
+    __m128 c0 = LINEAR_LOAD(p_a), c1 = LINEAR_LOAD(p_a + 4), c2 = LINEAR_LOAD(p_a + 8), c3 = LINEAR_LOAD(p_a + 12),
+           n0 = LINEAR_LOAD(p_b), n1 = LINEAR_LOAD(p_b + 4), n2 = LINEAR_LOAD(p_b + 8), n3 = LINEAR_LOAD(p_b + 12);
+
+    // the first three columns of n have w = 0, and the last has w = 1
+    LINEAR_STORE(p_r     , linear_sse_affine_column(c0, c1, c2, n0));
+    LINEAR_STORE(p_r +  4, linear_sse_affine_column(c0, c1, c2, n1));
+    LINEAR_STORE(p_r +  8, linear_sse_affine_column(c0, c1, c2, n2));
+    LINEAR_STORE(p_r + 12, _mm_add_ps(linear_sse_affine_column(c0, c1, c2, n3), c3));
+}
+
+static u0 mat4_inverse_sse ( mat4 *p_result, const mat4 *p_m )
+{
+
+    // initialized data
+    const float *p_a = &p_m->a;
+    float       *p_r = &p_result->a;
+    __m128 c0 = LINEAR_LOAD(p_a), c1 = LINEAR_LOAD(p_a + 4), c2 = LINEAR_LOAD(p_a + 8), c3 = LINEAR_LOAD(p_a + 12);
+
+    // partition the matrix into 2x2 blocks. the inverse of the transpose is 
+    // the transpose of the inverse, so the columns can be treated as rows
+    __m128 a = _mm_movelh_ps(c0, c1), b = _mm_movehl_ps(c1, c0),
+           c = _mm_movelh_ps(c2, c3), d = _mm_movehl_ps(c3, c2);
+
+    // determinants of the blocks [ |A| |B| |C| |D| ]
+    __m128 det_sub = _mm_sub_ps
+    (
+        _mm_mul_ps(LINEAR_SHUFFLE(c0, c2, 0, 2, 0, 2), LINEAR_SHUFFLE(c1, c3, 1, 3, 1, 3)),
+        _mm_mul_ps(LINEAR_SHUFFLE(c0, c2, 1, 3, 1, 3), LINEAR_SHUFFLE(c1, c3, 0, 2, 0, 2))
+    );
+    __m128 det_a = LINEAR_SWIZZLE(det_sub, 0, 0, 0, 0), det_b = LINEAR_SWIZZLE(det_sub, 1, 1, 1, 1),
+           det_c = LINEAR_SWIZZLE(det_sub, 2, 2, 2, 2), det_d = LINEAR_SWIZZLE(det_sub, 3, 3, 3, 3);
+
+    // adj(D) * C, adj(A) * B
+    __m128 d_c = linear_sse_mat2_adj_mul(d, c),
+           a_b = linear_sse_mat2_adj_mul(a, b);
+
+    // the blocks of the adjugate
+    __m128 x = _mm_sub_ps(_mm_mul_ps(det_d, a), linear_sse_mat2_mul(b, d_c)),
+           w = _mm_sub_ps(_mm_mul_ps(det_a, d), linear_sse_mat2_mul(c, a_b)),
+           y = _mm_sub_ps(_mm_mul_ps(det_b, c), linear_sse_mat2_mul_adj(d, a_b)),
+           z = _mm_sub_ps(_mm_mul_ps(det_c, b), linear_sse_mat2_mul_adj(a, d_c));
+
+    // |M| = |A||D| + |B||C| - tr(adj(A) * B * adj(D) * C)
+    __m128 det = _mm_add_ps(_mm_mul_ps(det_a, det_d), _mm_mul_ps(det_b, det_c)),
+           tr  = _mm_mul_ps(a_b, LINEAR_SWIZZLE(d_c, 0, 2, 1, 3));
+
+    // horizontal sum of the trace
+    tr  = _mm_add_ps(tr, LINEAR_SWIZZLE(tr, 2, 3, 0, 1));
+    tr  = _mm_add_ps(tr, LINEAR_SWIZZLE(tr, 1, 0, 3, 2));
+    det = _mm_sub_ps(det, tr);
+
+    // singular matrix -> identity, same as the scalar kernel
+    if ( _mm_cvtss_f32(det) == 0.0f ) { mat4_identity(p_result); return; }
+
+    // scale the adjugate by the reciprocal of the determinant
+    det = _mm_div_ps(_mm_setr_ps(1.f, -1.f, -1.f, 1.f), det);
+    x   = _mm_mul_ps(x, det),
+    y   = _mm_mul_ps(y, det),
+    z   = _mm_mul_ps(z, det),
+    w   = _mm_mul_ps(w, det);
+
+    // reassemble the columns
+    LINEAR_STORE(p_r     , LINEAR_SHUFFLE(x, y, 3, 1, 3, 1));
+    LINEAR_STORE(p_r +  4, LINEAR_SHUFFLE(x, y, 2, 0, 2, 0));
+    LINEAR_STORE(p_r +  8, LINEAR_SHUFFLE(z, w, 3, 1, 3, 1));
+    LINEAR_STORE(p_r + 12, LINEAR_SHUFFLE(z, w, 2, 0, 2, 0));
+}
+
+static u0 mat4_model_sse ( mat4 *p_result, const mat4 *p_rotation, vec3 location, vec3 scale )
+{
+
+    // initialized data
+    const float *p_a = &p_rotation->a;
+    float       *p_r = &p_result->a;
+
+    // scale the columns of the rotation
+    LINEAR_STORE(p_r    , _mm_mul_ps(LINEAR_LOAD(p_a    ), _mm_set1_ps(scale.x)));
+    LINEAR_STORE(p_r + 4, _mm_mul_ps(LINEAR_LOAD(p_a + 4), _mm_set1_ps(scale.y)));
+    LINEAR_STORE(p_r + 8, _mm_mul_ps(LINEAR_LOAD(p_a + 8), _mm_set1_ps(scale.z)));
+
+    // translation
+    LINEAR_STORE(p_r + 12, _mm_setr_ps(location.x, location.y, location.z, 1.f));
+}
+
+static u0 mat4_mul_vec4_array_sse ( vec4 *p_result, const mat4 *p_m, const vec4 *p_v, size_t count )
+{
+
+    // initialized data
+    const float *p_a = &p_m->a;
+    __m128 c0 = LINEAR_LOAD(p_a), c1 = LINEAR_LOAD(p_a + 4), c2 = LINEAR_LOAD(p_a + 8), c3 = LINEAR_LOAD(p_a + 12);
+
+    // each vector, with the columns in registers
+    for (size_t i = 0; i < count; i++)
+        LINEAR_STORE(&p_result[i].x, linear_sse_column(c0, c1, c2, c3, LINEAR_LOAD(&p_v[i].x)));
+}
+
+static u0 mat4_mul_vec4_soa_sse ( vec4_soa *p_result, const mat4 *p_m, const vec4_soa *p_v, size_t count )
+{
+
+    // initialized data
+    const float *p_a = &p_m->a;
+    __m128 _m[16];
+    size_t i = 0;
+
+    // broadcast each element of the matrix
+    for (size_t j = 0; j < 16; j++) _m[j] = _mm_set1_ps(p_a[j]);
+
+    // four vectors at a time
+    for (; i + 4 <= count; i += 4)
+    {
+
+        // initialized data
+        __m128 x = _mm_loadu_ps(p_v->p_x + i),
+               y = _mm_loadu_ps(p_v->p_y + i),
+               z = _mm_loadu_ps(p_v->p_z + i),
+               w = ( p_v->p_w ) ? _mm_loadu_ps(p_v->p_w + i) : _mm_set1_ps(1.f);
+
+        // each row of m, against four vectors
+        for (size_t r = 0; r < 4; r++)
+        {
+
+            // initialized data
+            float  *p_out = ( r == 0 ) ? p_result->p_x : ( r == 1 ) ? p_result->p_y : ( r == 2 ) ? p_result->p_z : p_result->p_w;
+            __m128  o     = _mm_add_ps
+            (
+                _mm_add_ps(_mm_mul_ps(_m[r], x), _mm_mul_ps(_m[4 + r], y)),
+                _mm_add_ps(_mm_mul_ps(_m[8 + r], z), _mm_mul_ps(_m[12 + r], w))
+            );
+
+            // the w component is optional
+            if ( p_out ) _mm_storeu_ps(p_out + i, o);
+        }
+    }
+
+    // the rest
+    mat4_mul_vec4_soa_range(p_result, p_m, p_v, i, count);
+}
+#endif
+
+/// avx2
+#ifdef LINEAR_HAS_AVX2
+
+__attribute__((target("avx2,fma")))
+static u0 mat4_mul_vec4_avx2 ( vec4 *p_result, const mat4 *p_m, const vec4 *p_v )
+{
+
+    // initialized data
+    const float *p_a = &p_m->a;
+    __m128 v = LINEAR_LOAD(&p_v->x),
+           r = _mm_mul_ps(LINEAR_LOAD(p_a), _mm_permute_ps(v, 0x00));
+
+    // accumulate the rest of the columns
+    r = _mm_fmadd_ps(LINEAR_LOAD(p_a +  4), _mm_permute_ps(v, 0x55), r);
+    r = _mm_fmadd_ps(LINEAR_LOAD(p_a +  8), _mm_permute_ps(v, 0xaa), r);
+    r = _mm_fmadd_ps(LINEAR_LOAD(p_a + 12), _mm_permute_ps(v, 0xff), r);
+
+    // store the result
+    LINEAR_STORE(&p_result->x, r);
+}
+
+__attribute__((target("avx2,fma")))
+static u0 mat4_mul_mat4_avx2 ( mat4 *p_result, const mat4 *p_m, const mat4 *p_n )
+{
+
+    // initialized data
+    const float *p_a = &p_m->a,
+                *p_b = &p_n->a;
+    float       *p_r = &p_result->a;
+
+    // each column of m, in both lanes
+    __m256 c0 = _mm256_broadcast_ps((const __m128 *) p_a      ),
+           c1 = _mm256_broadcast_ps((const __m128 *)(p_a +  4)),
+           c2 = _mm256_broadcast_ps((const __m128 *)(p_a +  8)),
+           c3 = _mm256_broadcast_ps((const __m128 *)(p_a + 12));
+
+    // two columns of the result at a time
+    for (size_t i = 0; i < 16; i += 8)
+    {
+
+        // initialized data. two narrow loads, so a copy made by the caller 
+        // forwards to them
+        __m256 n = _mm256_insertf128_ps(_mm256_castps128_ps256(LINEAR_LOAD(p_b + i)), LINEAR_LOAD(p_b + i + 4), 1),
+               r = _mm256_mul_ps(c0, _mm256_permute_ps(n, 0x00));
+
+        // accumulate the rest of the columns
+        r = _mm256_fmadd_ps(c1, _mm256_permute_ps(n, 0x55), r);
+        r = _mm256_fmadd_ps(c2, _mm256_permute_ps(n, 0xaa), r);
+        r = _mm256_fmadd_ps(c3, _mm256_permute_ps(n, 0xff), r);
+
+        // store the columns
+        _mm256_storeu_ps(p_r + i, r);
+    }
+}
+
+__attribute__((target("avx2,fma")))
+static u0 mat4_mul_mat4_affine_avx2 ( mat4 *p_result, const mat4 *p_m, const mat4 *p_n )
+{
+
+    // initialized data
+    const float *p_a = &p_m->a,
+                *p_b = &p_n->a;
+    float       *p_r = &p_result->a;
+
+    // the first three columns of m, in both lanes. the last column of m only 
+    // reaches the last column of the result
+    __m256 c0 = _mm256_broadcast_ps((const __m128 *) p_a      ),
+           c1 = _mm256_broadcast_ps((const __m128 *)(p_a +  4)),
+           c2 = _mm256_broadcast_ps((const __m128 *)(p_a +  8)),
+           t  = _mm256_insertf128_ps(_mm256_setzero_ps(), LINEAR_LOAD(p_a + 12), 1);
+
+    // two columns of n at a time
+    __m256 n01 = _mm256_insertf128_ps(_mm256_castps128_ps256(LINEAR_LOAD(p_b    )), LINEAR_LOAD(p_b +  4), 1),
+           n23 = _mm256_insertf128_ps(_mm256_castps128_ps256(LINEAR_LOAD(p_b + 8)), LINEAR_LOAD(p_b + 12), 1),
+           r01 = _mm256_mul_ps(c0, _mm256_permute_ps(n01, 0x00)),
+           r23 = _mm256_fmadd_ps(c0, _mm256_permute_ps(n23, 0x00), t);
+
+    // accumulate the rest of the columns
+    r01 = _mm256_fmadd_ps(c1, _mm256_permute_ps(n01, 0x55), r01);
+    r23 = _mm256_fmadd_ps(c1, _mm256_permute_ps(n23, 0x55), r23);
+    r01 = _mm256_fmadd_ps(c2, _mm256_permute_ps(n01, 0xaa), r01);
+    r23 = _mm256_fmadd_ps(c2, _mm256_permute_ps(n23, 0xaa), r23);
+
+    // store the columns
+    _mm256_storeu_ps(p_r    , r01);
+    _mm256_storeu_ps(p_r + 8, r23);
+}
+
+__attribute__((target("avx2,fma")))
+static u0 mat4_mul_vec4_array_avx2 ( vec4 *p_result, const mat4 *p_m, const vec4 *p_v, size_t count )
+{
+
+    // initialized data
+    const float *p_a = &p_m->a;
+    const float *p_b = &p_v->x;
+    float       *p_r = &p_result->x;
+    __m256 c0 = _mm256_broadcast_ps((const __m128 *) p_a      ),
+           c1 = _mm256_broadcast_ps((const __m128 *)(p_a +  4)),
+           c2 = _mm256_broadcast_ps((const __m128 *)(p_a +  8)),
+           c3 = _mm256_broadcast_ps((const __m128 *)(p_a + 12));
+    size_t i = 0;
+
+    // two vectors at a time
+    for (; i + 2 <= count; i += 2)
+    {
+
+        // initialized data
+        __m256 v = _mm256_loadu_ps(p_b + 4 * i),
+               r = _mm256_mul_ps(c0, _mm256_permute_ps(v, 0x00));
+
+        // accumulate the rest of the columns
+        r = _mm256_fmadd_ps(c1, _mm256_permute_ps(v, 0x55), r);
+        r = _mm256_fmadd_ps(c2, _mm256_permute_ps(v, 0xaa), r);
+        r = _mm256_fmadd_ps(c3, _mm256_permute_ps(v, 0xff), r);
+
+        // store the vectors
+        _mm256_storeu_ps(p_r + 4 * i, r);
+    }
+
+    // the last vector
+    if ( i < count ) mat4_mul_vec4_avx2(&p_result[i], p_m, &p_v[i]);
+}
+
+__attribute__((target("avx2,fma")))
+static u0 mat4_mul_vec4_soa_avx2 ( vec4_soa *p_result, const mat4 *p_m, const vec4_soa *p_v, size_t count )
+{
+
+    // initialized data
+    const float *p_a = &p_m->a;
+    __m256 _m[16];
+    size_t i = 0;
+
+    // broadcast each element of the matrix
+    for (size_t j = 0; j < 16; j++) _m[j] = _mm256_set1_ps(p_a[j]);
+
+    // eight vectors at a time
+    for (; i + 8 <= count; i += 8)
+    {
+
+        // initialized data
+        __m256 x = _mm256_loadu_ps(p_v->p_x + i),
+               y = _mm256_loadu_ps(p_v->p_y + i),
+               z = _mm256_loadu_ps(p_v->p_z + i),
+               w = ( p_v->p_w ) ? _mm256_loadu_ps(p_v->p_w + i) : _mm256_set1_ps(1.f);
+
+        // each row of m, against eight vectors
+        for (size_t r = 0; r < 4; r++)
+        {
+
+            // initialized data
+            float  *p_out = ( r == 0 ) ? p_result->p_x : ( r == 1 ) ? p_result->p_y : ( r == 2 ) ? p_result->p_z : p_result->p_w;
+            __m256  o     = _mm256_mul_ps(_m[r], x);
+
+            // accumulate the rest of the columns
+            o = _mm256_fmadd_ps(_m[4  + r], y, o);
+            o = _mm256_fmadd_ps(_m[8  + r], z, o);
+            o = _mm256_fmadd_ps(_m[12 + r], w, o);
+
+            // the w component is optional
+            if ( p_out ) _mm256_storeu_ps(p_out + i, o);
+        }
+    }
+
+    // the rest
+    mat4_mul_vec4_soa_range(p_result, p_m, p_v, i, count);
+}
+#endif
+
+/// neon
+#ifdef LINEAR_HAS_NEON
+
+#ifdef G10_LINEAR_ALIGNED
+    #define LINEAR_NEON_LOAD(p) vld1q_f32(__builtin_assume_aligned(p, 16))
+#else
+    #define LINEAR_NEON_LOAD(p) vld1q_f32(p)
+#endif
+
+#define LINEAR_NEON_SHUFFLE(a, b, x, y, z, w) __builtin_shufflevector(a, b, x, y, (z) + 4, (w) + 4)
+#define LINEAR_NEON_SWIZZLE(v, x, y, z, w)    __builtin_shufflevector(v, v, x, y, z, w)
+
+// m * v, for one column v
+static inline float32x4_t linear_neon_column ( float32x4_t c0, float32x4_t c1, float32x4_t c2, float32x4_t c3, float32x4_t v )
+{
+
+    // initialized data
+    float32x4_t r = vmulq_laneq_f32(c0, v, 0);
+
+    // accumulate the rest of the columns
+    r = vfmaq_laneq_f32(r, c1, v, 1);
+    r = vfmaq_laneq_f32(r, c2, v, 2);
+    r = vfmaq_laneq_f32(r, c3, v, 3);
+
+    // done
+    return r;
+}
+
+// m * v, for one column v with w = 0. the last column of m drops out
+static inline float32x4_t linear_neon_affine_column ( float32x4_t c0, float32x4_t c1, float32x4_t c2, float32x4_t v )
+{
+
+    // initialized data
+    float32x4_t r = vmulq_laneq_f32(c0, v, 0);
+
+    // accumulate the rest of the columns
+    r = vfmaq_laneq_f32(r, c1, v, 1);
+    r = vfmaq_laneq_f32(r, c2, v, 2);
+
+    // done
+    return r;
+}
+
+// 2x2 matrices, stored [ m00 m01 m10 m11 ]. a * b
+static inline float32x4_t linear_neon_mat2_mul ( float32x4_t a, float32x4_t b )
+{
+    return vaddq_f32
+    (
+        vmulq_f32(a, LINEAR_NEON_SWIZZLE(b, 0, 3, 0, 3)),
+        vmulq_f32(LINEAR_NEON_SWIZZLE(a, 1, 0, 3, 2), LINEAR_NEON_SWIZZLE(b, 2, 1, 2, 1))
+    );
+}
+
+// adj(a) * b
+static inline float32x4_t linear_neon_mat2_adj_mul ( float32x4_t a, float32x4_t b )
+{
+    return vsubq_f32
+    (
+        vmulq_f32(LINEAR_NEON_SWIZZLE(a, 3, 3, 0, 0), b),
+        vmulq_f32(LINEAR_NEON_SWIZZLE(a, 1, 1, 2, 2), LINEAR_NEON_SWIZZLE(b, 2, 3, 0, 1))
+    );
+}
+
+// a * adj(b)
+static inline float32x4_t linear_neon_mat2_mul_adj ( float32x4_t a, float32x4_t b )
+{
+    return vsubq_f32
+    (
+        vmulq_f32(a, LINEAR_NEON_SWIZZLE(b, 3, 0, 3, 0)),
+        vmulq_f32(LINEAR_NEON_SWIZZLE(a, 1, 0, 3, 2), LINEAR_NEON_SWIZZLE(b, 2, 1, 2, 1))
+    );
+}
+
+static u0 mat4_mul_vec4_neon ( vec4 *p_result, const mat4 *p_m, const vec4 *p_v )
+{
+
+    // initialized data
+    const float *p_a = &p_m->a;
+
+    // m * v
+    vst1q_f32(&p_result->x, linear_neon_column(LINEAR_NEON_LOAD(p_a), LINEAR_NEON_LOAD(p_a + 4), LINEAR_NEON_LOAD(p_a + 8), LINEAR_NEON_LOAD(p_a + 12), LINEAR_NEON_LOAD(&p_v->x)));
+}
+
+static u0 mat4_mul_mat4_neon ( mat4 *p_result, const mat4 *p_m, const mat4 *p_n )
+{
+
+    // initialized data
+    const float *p_a = &p_m->a,
+                *p_b = &p_n->a;
+    float       *p_r = &p_result->a;
+    float32x4_t c0 = LINEAR_NEON_LOAD(p_a), c1 = LINEAR_NEON_LOAD(p_a + 4), c2 = LINEAR_NEON_LOAD(p_a + 8), c3 = LINEAR_NEON_LOAD(p_a + 12),
+                n0 = LINEAR_NEON_LOAD(p_b), n1 = LINEAR_NEON_LOAD(p_b + 4), n2 = LINEAR_NEON_LOAD(p_b + 8), n3 = LINEAR_NEON_LOAD(p_b + 12);
+
+    // each column of the result is m times a column of n
+    vst1q_f32(p_r     , linear_neon_column(c0, c1, c2, c3, n0));
+    vst1q_f32(p_r +  4, linear_neon_column(c0, c1, c2, c3, n1));
+    vst1q_f32(p_r +  8, linear_neon_column(c0, c1, c2, c3, n2));
+    vst1q_f32(p_r + 12, linear_neon_column(c0, c1, c2, c3, n3));
+}
+
+static u0 mat4_mul_mat4_affine_neon ( mat4 *p_result, const mat4 *p_m, const mat4 *p_n )
+{
+
+    // initialized data
+    const float *p_a = &p_m->a,
+                *p_b = &p_n->a;
+    float       *p_r = &p_result->a;
+    float32x4_t c0 = LINEAR_NEON_LOAD(p_a), c1 = LINEAR_NEON_LOAD(p_a + 4), c2 = LINEAR_NEON_LOAD(p_a + 8), c3 = LINEAR_NEON_LOAD(p_a + 12),
+                n0 = LINEAR_NEON_LOAD(p_b), n1 = LINEAR_NEON_LOAD(p_b + 4), n2 = LINEAR_NEON_LOAD(p_b + 8), n3 = LINEAR_NEON_LOAD(p_b + 12);
+
+    // the first three columns of n have w = 0, and the last has w = 1
+    vst1q_f32(p_r     , linear_neon_affine_column(c0, c1, c2, n0));
+    vst1q_f32(p_r +  4, linear_neon_affine_column(c0, c1, c2, n1));
+    vst1q_f32(p_r +  8, linear_neon_affine_column(c0, c1, c2, n2));
+    vst1q_f32(p_r + 12, vaddq_f32(linear_neon_affine_column(c0, c1, c2, n3), c3));
+}
+
+static u0 mat4_inverse_neon ( mat4 *p_result, const mat4 *p_m )
+{
+
+    // initialized data
+    const float *p_a = &p_m->a;
+    float       *p_r = &p_result->a;
+    float32x4_t c0 = LINEAR_NEON_LOAD(p_a), c1 = LINEAR_NEON_LOAD(p_a + 4), c2 = LINEAR_NEON_LOAD(p_a + 8), c3 = LINEAR_NEON_LOAD(p_a + 12);
+
+    // partition the matrix into 2x2 blocks, as the sse kernel does
+    float32x4_t a = LINEAR_NEON_SHUFFLE(c0, c1, 0, 1, 0, 1), b = LINEAR_NEON_SHUFFLE(c0, c1, 2, 3, 2, 3),
+                c = LINEAR_NEON_SHUFFLE(c2, c3, 0, 1, 0, 1), d = LINEAR_NEON_SHUFFLE(c2, c3, 2, 3, 2, 3);
+
+    // determinants of the blocks [ |A| |B| |C| |D| ]
+    float32x4_t det_sub = vsubq_f32
+    (
+        vmulq_f32(LINEAR_NEON_SHUFFLE(c0, c2, 0, 2, 0, 2), LINEAR_NEON_SHUFFLE(c1, c3, 1, 3, 1, 3)),
+        vmulq_f32(LINEAR_NEON_SHUFFLE(c0, c2, 1, 3, 1, 3), LINEAR_NEON_SHUFFLE(c1, c3, 0, 2, 0, 2))
+    );
+    float32x4_t det_a = vdupq_laneq_f32(det_sub, 0), det_b = vdupq_laneq_f32(det_sub, 1),
+                det_c = vdupq_laneq_f32(det_sub, 2), det_d = vdupq_laneq_f32(det_sub, 3);
+
+    // adj(D) * C, adj(A) * B
+    float32x4_t d_c = linear_neon_mat2_adj_mul(d, c),
+                a_b = linear_neon_mat2_adj_mul(a, b);
+
+    // the blocks of the adjugate
+    float32x4_t x = vsubq_f32(vmulq_f32(det_d, a), linear_neon_mat2_mul(b, d_c)),
+                w = vsubq_f32(vmulq_f32(det_a, d), linear_neon_mat2_mul(c, a_b)),
+                y = vsubq_f32(vmulq_f32(det_b, c), linear_neon_mat2_mul_adj(d, a_b)),
+                z = vsubq_f32(vmulq_f32(det_c, b), linear_neon_mat2_mul_adj(a, d_c));
+
+    // |M| = |A||D| + |B||C| - tr(adj(A) * B * adj(D) * C)
+    float det = vgetq_lane_f32(det_sub, 0) * vgetq_lane_f32(det_sub, 3)
+              + vgetq_lane_f32(det_sub, 1) * vgetq_lane_f32(det_sub, 2)
+              - vaddvq_f32(vmulq_f32(a_b, LINEAR_NEON_SWIZZLE(d_c, 0, 2, 1, 3)));
+
+    // singular matrix -> identity, same as the scalar kernel
+    if ( det == 0.0f ) { mat4_identity(p_result); return; }
+
+    // scale the adjugate by the reciprocal of the determinant
+    float32x4_t r_det = vdivq_f32((float32x4_t) { 1.f, -1.f, -1.f, 1.f }, vdupq_n_f32(det));
+    x = vmulq_f32(x, r_det),
+    y = vmulq_f32(y, r_det),
+    z = vmulq_f32(z, r_det),
+    w = vmulq_f32(w, r_det);
+
+    // reassemble the columns
+    vst1q_f32(p_r     , LINEAR_NEON_SHUFFLE(x, y, 3, 1, 3, 1));
+    vst1q_f32(p_r +  4, LINEAR_NEON_SHUFFLE(x, y, 2, 0, 2, 0));
+    vst1q_f32(p_r +  8, LINEAR_NEON_SHUFFLE(z, w, 3, 1, 3, 1));
+    vst1q_f32(p_r + 12, LINEAR_NEON_SHUFFLE(z, w, 2, 0, 2, 0));
+}
+
+static u0 mat4_model_neon ( mat4 *p_result, const mat4 *p_rotation, vec3 location, vec3 scale )
+{
+
+    // initialized data
+    const float *p_a = &p_rotation->a;
+    float       *p_r = &p_result->a;
+
+    // scale the columns of the rotation
+    vst1q_f32(p_r    , vmulq_n_f32(LINEAR_NEON_LOAD(p_a    ), scale.x));
+    vst1q_f32(p_r + 4, vmulq_n_f32(LINEAR_NEON_LOAD(p_a + 4), scale.y));
+    vst1q_f32(p_r + 8, vmulq_n_f32(LINEAR_NEON_LOAD(p_a + 8), scale.z));
+
+    // translation
+    vst1q_f32(p_r + 12, (float32x4_t) { location.x, location.y, location.z, 1.f });
+}
+
+static u0 mat4_mul_vec4_array_neon ( vec4 *p_result, const mat4 *p_m, const vec4 *p_v, size_t count )
+{
+
+    // initialized data
+    const float *p_a = &p_m->a;
+    float32x4_t c0 = LINEAR_NEON_LOAD(p_a), c1 = LINEAR_NEON_LOAD(p_a + 4), c2 = LINEAR_NEON_LOAD(p_a + 8), c3 = LINEAR_NEON_LOAD(p_a + 12);
+
+    // each vector, with the columns in registers
+    for (size_t i = 0; i < count; i++)
+        vst1q_f32(&p_result[i].x, linear_neon_column(c0, c1, c2, c3, LINEAR_NEON_LOAD(&p_v[i].x)));
+}
+
+static u0 mat4_mul_vec4_soa_neon ( vec4_soa *p_result, const mat4 *p_m, const vec4_soa *p_v, size_t count )
+{
+
+    // initialized data
+    const float *p_a = &p_m->a;
+    size_t i = 0;
+
+    // four vectors at a time
+    for (; i + 4 <= count; i += 4)
+    {
+
+        // initialized data
+        float32x4_t x = vld1q_f32(p_v->p_x + i),
+                    y = vld1q_f32(p_v->p_y + i),
+                    z = vld1q_f32(p_v->p_z + i),
+                    w = ( p_v->p_w ) ? vld1q_f32(p_v->p_w + i) : vdupq_n_f32(1.f);
+
+        // each row of m, against four vectors
+        for (size_t r = 0; r < 4; r++)
+        {
+
+            // initialized data
+            float       *p_out = ( r == 0 ) ? p_result->p_x : ( r == 1 ) ? p_result->p_y : ( r == 2 ) ? p_result->p_z : p_result->p_w;
+            float32x4_t  o     = vmulq_n_f32(x, p_a[r]);
+
+            // accumulate the rest of the columns
+            o = vfmaq_n_f32(o, y, p_a[4  + r]);
+            o = vfmaq_n_f32(o, z, p_a[8  + r]);
+            o = vfmaq_n_f32(o, w, p_a[12 + r]);
+
+            // the w component is optional
+            if ( p_out ) vst1q_f32(p_out + i, o);
+        }
+    }
+
+    // the rest
+    mat4_mul_vec4_soa_range(p_result, p_m, p_v, i, count);
+}
+#endif
+
+/// dispatch
+static u0 linear_isa_resolve ( void )
+{
+
+    // initialized data
+    const char        *p_name = getenv("G10_LINEAR_ISA");
+    enum linear_isa_e  isa    = linear_isa_best();
+
+    // the environment names an instruction set
+    if ( p_name )
+        for (size_t i = 0; i < LINEAR_ISA_QTY; i++)
+            if ( 0 == strcmp(_linear_isa_names[i], p_name) ) isa = (enum linear_isa_e) i;
+
+    // use the kernels, or fall back to the best kernels
+    if ( 0 == linear_isa_set(isa) ) linear_isa_set(linear_isa_best());
+}
+
+static u0 mat4_mul_vec4_resolve ( vec4 *p_result, const mat4 *p_m, const vec4 *p_v )
+{
+    linear_isa_resolve();
+    _linear.pfn_mat4_mul_vec4(p_result, p_m, p_v);
+}
+
+static u0 mat4_mul_mat4_resolve ( mat4 *p_result, const mat4 *p_m, const mat4 *p_n )
+{
+    linear_isa_resolve();
+    _linear.pfn_mat4_mul_mat4(p_result, p_m, p_n);
+}
+
+static u0 mat4_mul_mat4_affine_resolve ( mat4 *p_result, const mat4 *p_m, const mat4 *p_n )
+{
+    linear_isa_resolve();
+    _linear.pfn_mat4_mul_mat4_affine(p_result, p_m, p_n);
+}
+
+static u0 mat4_inverse_resolve ( mat4 *p_result, const mat4 *p_m )
+{
+    linear_isa_resolve();
+    _linear.pfn_mat4_inverse(p_result, p_m);
+}
+
+static u0 mat4_model_resolve ( mat4 *p_result, const mat4 *p_rotation, vec3 location, vec3 scale )
+{
+    linear_isa_resolve();
+    _linear.pfn_mat4_model(p_result, p_rotation, location, scale);
+}
+
+static u0 mat4_mul_vec4_array_resolve ( vec4 *p_result, const mat4 *p_m, const vec4 *p_v, size_t count )
+{
+    linear_isa_resolve();
+    _linear.pfn_mat4_mul_vec4_array(p_result, p_m, p_v, count);
+}
+
+static u0 mat4_mul_vec4_soa_resolve ( vec4_soa *p_result, const mat4 *p_m, const vec4_soa *p_v, size_t count )
+{
+    linear_isa_resolve();
+    _linear.pfn_mat4_mul_vec4_soa(p_result, p_m, p_v, count);
+}
+
+int linear_isa_set ( enum linear_isa_e isa )
+{
+
+    // use the kernels
+    switch ( isa )
+    {
+        case LINEAR_ISA_SCALAR:
+            _linear.pfn_mat4_mul_vec4        = mat4_mul_vec4_scalar,
+            _linear.pfn_mat4_mul_mat4        = mat4_mul_mat4_scalar,
+            _linear.pfn_mat4_mul_mat4_affine = mat4_mul_mat4_affine_scalar,
+            _linear.pfn_mat4_inverse         = mat4_inverse_scalar,
+            _linear.pfn_mat4_model           = mat4_model_scalar,
+            _linear.pfn_mat4_mul_vec4_array  = mat4_mul_vec4_array_scalar,
+            _linear.pfn_mat4_mul_vec4_soa    = mat4_mul_vec4_soa_scalar;
+            break;
+
+        #ifdef LINEAR_HAS_SSE
+        case LINEAR_ISA_SSE:
+            _linear.pfn_mat4_mul_vec4        = mat4_mul_vec4_sse,
+            _linear.pfn_mat4_mul_mat4        = mat4_mul_mat4_sse,
+            _linear.pfn_mat4_mul_mat4_affine = mat4_mul_mat4_affine_sse,
+            _linear.pfn_mat4_inverse         = mat4_inverse_sse,
+            _linear.pfn_mat4_model           = mat4_model_sse,
+            _linear.pfn_mat4_mul_vec4_array  = mat4_mul_vec4_array_sse,
+            _linear.pfn_mat4_mul_vec4_soa    = mat4_mul_vec4_soa_sse;
+            break;
+        #endif
+
+        #ifdef LINEAR_HAS_AVX2
+        case LINEAR_ISA_AVX2:
+
+            // the processor must support avx2 and fma
+            if ( LINEAR_ISA_AVX2 != linear_isa_best() ) return 0;
+
+            // the inverse and model kernels don't benefit from wider lanes
+            _linear.pfn_mat4_mul_vec4        = mat4_mul_vec4_avx2,
+            _linear.pfn_mat4_mul_mat4        = mat4_mul_mat4_avx2,
+            _linear.pfn_mat4_mul_mat4_affine = mat4_mul_mat4_affine_avx2,
+            _linear.pfn_mat4_inverse         = mat4_inverse_sse,
+            _linear.pfn_mat4_model           = mat4_model_sse,
+            _linear.pfn_mat4_mul_vec4_array  = mat4_mul_vec4_array_avx2,
+            _linear.pfn_mat4_mul_vec4_soa    = mat4_mul_vec4_soa_avx2;
+            break;
+        #endif
+
+        #ifdef LINEAR_HAS_NEON
+        case LINEAR_ISA_NEON:
+            _linear.pfn_mat4_mul_vec4        = mat4_mul_vec4_neon,
+            _linear.pfn_mat4_mul_mat4        = mat4_mul_mat4_neon,
+            _linear.pfn_mat4_mul_mat4_affine = mat4_mul_mat4_affine_neon,
+            _linear.pfn_mat4_inverse         = mat4_inverse_neon,
+            _linear.pfn_mat4_model           = mat4_model_neon,
+            _linear.pfn_mat4_mul_vec4_array  = mat4_mul_vec4_array_neon,
+            _linear.pfn_mat4_mul_vec4_soa    = mat4_mul_vec4_soa_neon;
+            break;
+        #endif
+
+        // not supported by this build
+        default:
+            return 0;
+    }
+
+    // store the instruction set
+    _linear.isa = isa;
+
+    // success
+    return 1;
+}
+
+enum linear_isa_e linear_isa_get ( void )
+{
+
+    // resolve the kernels
+    if ( LINEAR_ISA_QTY == _linear.isa ) linear_isa_resolve();
+
+    // done
+    return _linear.isa;
+}
+
+enum linear_isa_e linear_isa_best ( void )
+{
+
+    // avx2, if the build or the processor supports it
+    #if defined(LINEAR_HAS_AVX2) && defined(__AVX2__) && defined(__FMA__)
+        return LINEAR_ISA_AVX2;
+    #elif defined(LINEAR_HAS_AVX2)
+        if ( __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") ) return LINEAR_ISA_AVX2;
+    #endif
+
+    // sse
+    #if defined(LINEAR_HAS_SSE)
+        return LINEAR_ISA_SSE;
+    #endif
+
+    // neon
+    #if defined(LINEAR_HAS_NEON)
+        return LINEAR_ISA_NEON;
+    #endif
+
+    // scalar
+    return LINEAR_ISA_SCALAR;
+}
+
+const char *linear_isa_name ( enum linear_isa_e isa )
+{
+
+    // done
+    return ( isa < LINEAR_ISA_QTY ) ? _linear_isa_names[isa] : "unknown";
+}
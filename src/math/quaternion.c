@@ -0,0 +1,202 @@
+/** !
+ * Quaternion rotations
+ *
+ * @file src/math/quaternion.c
+ *
+ * @author Jacob Smith
+ */
+
+// header
+#include <quaternion.h>
+
+// preprocessor definitions
+#define DEG_TO_RAD ((double)M_PI/(double)180.0)
+#define RAD_TO_DEG ((double)180.0/(double)M_PI)
+
+// function definitions
+u0 quaternion_identity ( quaternion *p_result )
+{
+    *p_result = (quaternion){ .u = 1.f, .i = 0.f, .j = 0.f, .k = 0.f };
+}
+
+u0 quaternion_from_euler ( quaternion *p_result, vec3 rotation )
+{
+
+    // half angles
+    float cx = cosf(rotation.x * DEG_TO_RAD * 0.5), sx = sinf(rotation.x * DEG_TO_RAD * 0.5);
+    float cy = cosf(rotation.y * DEG_TO_RAD * 0.5), sy = sinf(rotation.y * DEG_TO_RAD * 0.5);
+    float cz = cosf(rotation.z * DEG_TO_RAD * 0.5), sz = sinf(rotation.z * DEG_TO_RAD * 0.5);
+
+    // q = qx * qy * qz, which matches mat4_rotation_from_vec3
+    *p_result = (quaternion){
+        .u = cx * cy * cz - sx * sy * sz,
+        .i = sx * cy * cz + cx * sy * sz,
+        .j = cx * sy * cz - sx * cy * sz,
+        .k = cx * cy * sz + sx * sy * cz
+    };
+}
+
+u0 quaternion_from_axis_angle ( quaternion *p_result, vec3 axis, float angle )
+{
+
+    // initialized data
+    float len = sqrtf(axis.x * axis.x + axis.y * axis.y + axis.z * axis.z);
+    float c   = cosf(angle * DEG_TO_RAD * 0.5),
+          s   = sinf(angle * DEG_TO_RAD * 0.5);
+
+    // no axis -> no rotation
+    if ( len == 0.f ) { quaternion_identity(p_result); return; }
+
+    // scale the axis by the sine of the half angle
+    s /= len;
+
+    *p_result = (quaternion){ .u = c, .i = axis.x * s, .j = axis.y * s, .k = axis.z * s };
+}
+
+u0 quaternion_mul_quaternion ( quaternion *p_result, quaternion q, quaternion r )
+{
+    *p_result = (quaternion){
+        .u = q.u * r.u - q.i * r.i - q.j * r.j - q.k * r.k,
+        .i = q.u * r.i + q.i * r.u + q.j * r.k - q.k * r.j,
+        .j = q.u * r.j - q.i * r.k + q.j * r.u + q.k * r.i,
+        .k = q.u * r.k + q.i * r.j - q.j * r.i + q.k * r.u
+    };
+}
+
+u0 quaternion_conjugate ( quaternion *p_result, quaternion q )
+{
+    *p_result = (quaternion){ .u = q.u, .i = -q.i, .j = -q.j, .k = -q.k };
+}
+
+u0 quaternion_normalize ( quaternion *p_result, quaternion q )
+{
+
+    // initialized data
+    float len = sqrtf(q.u * q.u + q.i * q.i + q.j * q.j + q.k * q.k);
+
+    // degenerate -> no rotation
+    if ( len == 0.f ) { quaternion_identity(p_result); return; }
+
+    // scale to unit length
+    len = 1.f / len;
+
+    *p_result = (quaternion){ .u = q.u * len, .i = q.i * len, .j = q.j * len, .k = q.k * len };
+}
+
+u0 quaternion_nlerp ( quaternion *p_result, quaternion q, quaternion r, float t )
+{
+
+    // initialized data
+    float dot = q.u * r.u + q.i * r.i + q.j * r.j + q.k * r.k;
+    float s   = ( dot < 0.f ) ? -t : t;
+
+    // lerp toward r, or toward -r if that is the shorter arc
+    quaternion_normalize(p_result, (quaternion){
+        .u = q.u * ( 1.f - t ) + r.u * s,
+        .i = q.i * ( 1.f - t ) + r.i * s,
+        .j = q.j * ( 1.f - t ) + r.j * s,
+        .k = q.k * ( 1.f - t ) + r.k * s
+    });
+}
+
+u0 quaternion_slerp ( quaternion *p_result, quaternion q, quaternion r, float t )
+{
+
+    // initialized data
+    float dot = q.u * r.u + q.i * r.i + q.j * r.j + q.k * r.k;
+    float a = 0, b = 0, theta = 0, sin_theta = 0;
+
+    // take the shorter arc
+    if ( dot < 0.f ) r = (quaternion){ -r.u, -r.i, -r.j, -r.k }, dot = -dot;
+
+    // nearly parallel -> nlerp, which is accurate here and avoids dividing by ~0
+    if ( dot > 0.9995f ) { quaternion_nlerp(p_result, q, r, t); return; }
+
+    // weights
+    theta     = acosf(dot),
+    sin_theta = sinf(theta),
+    a         = sinf(( 1.f - t ) * theta) / sin_theta,
+    b         = sinf(t * theta) / sin_theta;
+
+    *p_result = (quaternion){
+        .u = q.u * a + r.u * b,
+        .i = q.i * a + r.i * b,
+        .j = q.j * a + r.j * b,
+        .k = q.k * a + r.k * b
+    };
+}
+
+u0 quaternion_rotate_vec3 ( vec3 *p_result, quaternion q, vec3 v )
+{
+
+    // t = 2 * ( q.ijk x v )
+    vec3 t = {
+        .x = 2.f * ( q.j * v.z - q.k * v.y ),
+        .y = 2.f * ( q.k * v.x - q.i * v.z ),
+        .z = 2.f * ( q.i * v.y - q.j * v.x )
+    };
+
+    // v' = v + q.u * t + q.ijk x t
+    *p_result = (vec3){
+        .x = v.x + q.u * t.x + ( q.j * t.z - q.k * t.y ),
+        .y = v.y + q.u * t.y + ( q.k * t.x - q.i * t.z ),
+        .z = v.z + q.u * t.z + ( q.i * t.y - q.j * t.x )
+    };
+}
+
+u0 quaternion_to_mat4 ( mat4 *p_result, quaternion q )
+{
+
+    // initialized data
+    float ii = q.i * q.i, jj = q.j * q.j, kk = q.k * q.k;
+    float ij = q.i * q.j, ik = q.i * q.k, jk = q.j * q.k;
+    float ui = q.u * q.i, uj = q.u * q.j, uk = q.u * q.k;
+
+    // column major
+    *p_result = (mat4){
+        .a = 1.f - 2.f * ( jj + kk ), .b =       2.f * ( ij + uk ), .c =       2.f * ( ik - uj ), .d = 0.f,
+        .e =       2.f * ( ij - uk ), .f = 1.f - 2.f * ( ii + kk ), .g =       2.f * ( jk + ui ), .h = 0.f,
+        .i =       2.f * ( ik + uj ), .j =       2.f * ( jk - ui ), .k = 1.f - 2.f * ( ii + jj ), .l = 0.f,
+        .m = 0.f,                     .n = 0.f,                     .o = 0.f,                     .p = 1.f
+    };
+}
+
+u0 quaternion_to_euler ( vec3 *p_result, quaternion q )
+{
+
+    // the elements of the rotation matrix that determine the angles
+    float m00 = 1.f - 2.f * ( q.j * q.j + q.k * q.k ),
+          m01 =       2.f * ( q.i * q.j - q.u * q.k ),
+          m02 =       2.f * ( q.i * q.k + q.u * q.j ),
+          m12 =       2.f * ( q.j * q.k - q.u * q.i ),
+          m22 = 1.f - 2.f * ( q.i * q.i + q.j * q.j );
+
+    // clamp against rounding
+    if ( m02 >  1.f ) m02 =  1.f;
+    if ( m02 < -1.f ) m02 = -1.f;
+
+    // R = Rx * Ry * Rz -> m02 = sy, m12 = -sx cy, m22 = cx cy, m01 = -cy sz, m00 = cy cz
+    *p_result = (vec3){
+        .x = (float)( atan2f(-m12, m22) * RAD_TO_DEG ),
+        .y = (float)( asinf(m02)        * RAD_TO_DEG ),
+        .z = (float)( atan2f(-m01, m00) * RAD_TO_DEG )
+    };
+}
+
+u0 mat4_model_from_quaternion ( mat4 *p_result, vec3 location, quaternion rotation, vec3 scale )
+{
+
+    // initialized data
+    mat4 _rotation = { 0 };
+
+    // the rotation costs no trig
+    quaternion_to_mat4(&_rotation, rotation);
+
+    // m = T * R * S
+    mat4_model_from_rotation(p_result, location, _rotation, scale);
+}
+
+int quaternion_pack ( void *p_buffer, quaternion *p_q )
+{
+    return pack_pack(p_buffer, "%4f32", p_q->u, p_q->i, p_q->j, p_q->k);
+}
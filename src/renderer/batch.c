@@ -0,0 +1,247 @@
+/** !
+ * Instanced draw batches
+ *
+ * @file src/renderer/batch.c
+ *
+ * @author Jacob Smith
+ */
+
+// header
+#include <batch.h>
+
+// g10
+#include <entity.h>
+#include <transform.h>
+
+// static function declarations
+static int batch_list_reserve ( batch_list *p_batch_list, size_t max );
+
+// function definitions
+int batch_list_construct ( batch_list **pp_batch_list, size_t max )
+{
+
+    // argument check
+    if ( pp_batch_list == (void *) 0 ) goto no_batch_list;
+
+    // initialized data
+    batch_list *p_batch_list = default_allocator(0, sizeof(batch_list));
+
+    // error check
+    if ( p_batch_list == (void *) 0 ) goto no_mem;
+
+    // populate the batch list
+    *p_batch_list = (batch_list)
+    {
+        .p_batches      = (void *) 0,
+        .p_instances    = (void *) 0,
+        .batch_count    = 0,
+        .batch_max      = 0,
+        .instance_count = 0,
+        .instance_max   = 0
+    };
+
+    // allocate the batches and instances
+    if ( 0 == batch_list_reserve(p_batch_list, max) ) goto no_mem;
+
+    // return a pointer to the caller
+    *pp_batch_list = p_batch_list;
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_batch_list:
+                #ifndef NDEBUG
+                    log_error("[g10] [batch] Null pointer provided for parameter \"pp_batch_list\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // release the batch list
+                if ( p_batch_list ) batch_list_destroy(&p_batch_list);
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int batch_list_build ( batch_list *p_batch_list, draw_list *p_draw_list )
+{
+
+    // argument check
+    if ( p_batch_list == (void *) 0 ) goto no_batch_list;
+    if ( p_draw_list  == (void *) 0 ) goto no_draw_list;
+
+    // initialized data
+    size_t count = draw_list_size(p_draw_list);
+    batch *p_batch = (void *) 0;
+
+    // empty the batch list
+    p_batch_list->batch_count    = 0,
+    p_batch_list->instance_count = 0;
+
+    // worst case, every entity is its own batch
+    if ( 0 == batch_list_reserve(p_batch_list, count) ) goto no_mem;
+
+    // group the entities
+    for ( size_t i = 0; i < count; i++ )
+    {
+
+        // initialized data
+        entity *p_entity = p_draw_list->p_packets[i].p_drawable;
+        batch_instance *p_instance = &p_batch_list->p_instances[p_batch_list->instance_count];
+
+        // only geometry can be instanced
+        if ( p_entity == (void *) 0 || p_entity->p_geometry == (void *) 0 ) continue;
+
+        // start a new batch
+        if ( p_batch == (void *) 0 ||
+             p_batch->p_entity->p_geometry != p_entity->p_geometry ||
+             p_batch->p_entity->p_material != p_entity->p_material )
+        {
+            p_batch = &p_batch_list->p_batches[p_batch_list->batch_count++];
+
+            *p_batch = (batch)
+            {
+                .p_entity = p_entity,
+                .first    = (u32) p_batch_list->instance_count,
+                .count    = 0
+            };
+        }
+
+        // world matrix
+        transform_get_matrix_world(p_entity->p_transform, &p_instance->model);
+
+        // normal matrix. the world matrix is affine, so this is the 3x3
+        // inverse transpose, not the 4x4 inverse. rebuilt only after the
+        // transform changes
+        if ( p_entity->_version.inv_normal != transform_version(p_entity->p_transform) )
+            mat4_normal_matrix(&p_entity->_inv_normal, p_instance->model),
+            p_entity->_version.inv_normal = transform_version(p_entity->p_transform);
+
+        mat3_to_mat4(&p_instance->inv_normal, p_entity->_inv_normal);
+
+        // add the instance to the batch
+        p_batch->count++;
+        p_batch_list->instance_count++;
+    }
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_batch_list:
+                #ifndef NDEBUG
+                    log_error("[g10] [batch] Null pointer provided for parameter \"p_batch_list\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_draw_list:
+                #ifndef NDEBUG
+                    log_error("[g10] [batch] Null pointer provided for parameter \"p_draw_list\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int batch_list_destroy ( batch_list **pp_batch_list )
+{
+
+    // argument check
+    if ( pp_batch_list == (void *) 0 ) goto no_batch_list;
+
+    // initialized data
+    batch_list *p_batch_list = *pp_batch_list;
+
+    // no more pointer for caller
+    *pp_batch_list = (void *) 0;
+
+    // release the memory
+    if ( p_batch_list )
+        default_allocator(p_batch_list->p_batches, 0),
+        default_allocator(p_batch_list->p_instances, 0),
+        default_allocator(p_batch_list, 0);
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_batch_list:
+                #ifndef NDEBUG
+                    log_error("[g10] [batch] Null pointer provided for parameter \"pp_batch_list\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+static int batch_list_reserve ( batch_list *p_batch_list, size_t max )
+{
+
+    // already large enough
+    if ( max <= p_batch_list->instance_max ) return 1;
+
+    // initialized data
+    batch          *p_batches   = default_allocator(p_batch_list->p_batches, max * sizeof(batch));
+    batch_instance *p_instances = (void *) 0;
+
+    // error check
+    if ( p_batches == (void *) 0 ) return 0;
+
+    // store the batches
+    p_batch_list->p_batches = p_batches,
+    p_batch_list->batch_max = max;
+
+    // grow the instances
+    p_instances = default_allocator(p_batch_list->p_instances, max * sizeof(batch_instance));
+
+    // error check
+    if ( p_instances == (void *) 0 ) return 0;
+
+    // store the instances
+    p_batch_list->p_instances  = p_instances,
+    p_batch_list->instance_max = max;
+
+    // success
+    return 1;
+}
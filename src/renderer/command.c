@@ -0,0 +1,311 @@
+/** !
+ * Backend neutral draw commands
+ *
+ * @file src/renderer/command.c
+ *
+ * @author Jacob Smith
+ */
+
+// header
+#include <command.h>
+#include <g10.h>
+#include <render_pass.h>
+
+// data
+u8 g_null_handle = 0;
+
+static const char *_backend_names[G10_BACKEND_QTY] =
+{
+    [G10_BACKEND_SDL3] = "sdl3",
+    [G10_BACKEND_NULL] = "null"
+};
+
+// function definitions
+enum g_backend_e command_backend_from_string ( const char *p_name )
+{
+
+    // argument check
+    if ( NULL == p_name ) return G10_BACKEND_QTY;
+
+    // search
+    for (size_t i = 0; i < G10_BACKEND_QTY; i++)
+        if ( 0 == strcmp(_backend_names[i], p_name) ) return (enum g_backend_e) i;
+
+    // not found
+    return G10_BACKEND_QTY;
+}
+
+const char *command_backend_name ( enum g_backend_e backend )
+{
+
+    // done
+    return ( backend < G10_BACKEND_QTY ) ? _backend_names[backend] : "unknown";
+}
+
+int command_push_uniform ( u32 slot, const void *p_data, size_t size )
+{
+
+    // initialized data
+    g_instance *p_instance = g_active_instance();
+
+    // record
+    p_instance->commands.uniform_pushes++,
+    p_instance->commands.uniform_bytes += size;
+
+    // null backend
+    if ( G10_BACKEND_NULL == p_instance->backend ) return 1;
+
+    #ifdef G10_BUILD_WITH_SDL3
+        SDL_PushGPUVertexUniformData(p_instance->graphics.sdl3.command_buffer, slot, p_data, (u32) size);
+        SDL_PushGPUFragmentUniformData(p_instance->graphics.sdl3.command_buffer, slot, p_data, (u32) size);
+    #endif
+
+    // success
+    return 1;
+}
+
+int command_bind_pipeline ( render_pass *p_render_pass, void *p_handle )
+{
+
+    // initialized data
+    g_instance *p_instance = g_active_instance();
+
+    // record
+    p_instance->commands.pipeline_binds++;
+
+    // null backend
+    if ( G10_BACKEND_NULL == p_instance->backend ) return 1;
+
+    #ifdef G10_BUILD_WITH_SDL3
+        SDL_BindGPUGraphicsPipeline(p_render_pass->p_handle, p_handle);
+    #endif
+
+    // success
+    return 1;
+}
+
+int command_bind_vertex_buffers ( render_pass *p_render_pass, void *const *pp_handles, size_t count )
+{
+
+    // initialized data
+    g_instance *p_instance = g_active_instance();
+
+    // record
+    p_instance->commands.vertex_buffer_binds += count;
+
+    // null backend
+    if ( G10_BACKEND_NULL == p_instance->backend ) return 1;
+
+    #ifdef G10_BUILD_WITH_SDL3
+    {
+
+        // initialized data
+        SDL_GPUBufferBinding _bindings[8] = { 0 };
+
+        // error check
+        if ( count > 8 ) count = 8;
+
+        // populate the bindings
+        for (size_t i = 0; i < count; i++)
+            _bindings[i] = (SDL_GPUBufferBinding) { .buffer = pp_handles[i], .offset = 0 };
+
+        // bind the vertex buffers
+        SDL_BindGPUVertexBuffers(p_render_pass->p_handle, 0, _bindings, (u32) count);
+    }
+    #endif
+
+    // success
+    return 1;
+}
+
+int command_bind_index_buffer ( render_pass *p_render_pass, void *p_handle )
+{
+
+    // initialized data
+    g_instance *p_instance = g_active_instance();
+
+    // record
+    p_instance->commands.index_buffer_binds++;
+
+    // null backend
+    if ( G10_BACKEND_NULL == p_instance->backend ) return 1;
+
+    #ifdef G10_BUILD_WITH_SDL3
+        SDL_BindGPUIndexBuffer
+        (
+            p_render_pass->p_handle,
+            &(SDL_GPUBufferBinding) { .buffer = p_handle, .offset = 0 },
+            SDL_GPU_INDEXELEMENTSIZE_32BIT
+        );
+    #endif
+
+    // success
+    return 1;
+}
+
+int command_bind_storage_buffer ( render_pass *p_render_pass, u32 slot, void *p_handle )
+{
+
+    // initialized data
+    g_instance *p_instance = g_active_instance();
+
+    // record
+    p_instance->commands.storage_buffer_binds++;
+
+    // null backend
+    if ( G10_BACKEND_NULL == p_instance->backend ) return 1;
+
+    #ifdef G10_BUILD_WITH_SDL3
+        SDL_BindGPUVertexStorageBuffers(p_render_pass->p_handle, slot, (SDL_GPUBuffer **) &p_handle, 1);
+    #endif
+
+    // success
+    return 1;
+}
+
+int command_bind_sampler ( render_pass *p_render_pass, u32 slot, void *p_texture, void *p_sampler )
+{
+
+    // initialized data
+    g_instance *p_instance = g_active_instance();
+
+    // record
+    p_instance->commands.sampler_binds++;
+
+    // null backend
+    if ( G10_BACKEND_NULL == p_instance->backend ) return 1;
+
+    #ifdef G10_BUILD_WITH_SDL3
+        SDL_BindGPUFragmentSamplers
+        (
+            p_render_pass->p_handle,
+            slot,
+            &(SDL_GPUTextureSamplerBinding) { .sampler = p_sampler, .texture = p_texture },
+            1
+        );
+    #endif
+
+    // success
+    return 1;
+}
+
+int command_draw ( render_pass *p_render_pass, u32 vertex_count, u32 instance_count )
+{
+
+    // initialized data
+    g_instance *p_instance = g_active_instance();
+
+    // record
+    p_instance->commands.draws++,
+    p_instance->commands.instances  += instance_count,
+    p_instance->commands.primitives += (size_t) vertex_count / 3 * instance_count;
+
+    // null backend
+    if ( G10_BACKEND_NULL == p_instance->backend ) return 1;
+
+    #ifdef G10_BUILD_WITH_SDL3
+        SDL_DrawGPUPrimitives(p_render_pass->p_handle, vertex_count, instance_count, 0, 0);
+    #endif
+
+    // success
+    return 1;
+}
+
+int command_draw_indexed ( render_pass *p_render_pass, u32 index_count, u32 instance_count )
+{
+
+    // initialized data
+    g_instance *p_instance = g_active_instance();
+
+    // record
+    p_instance->commands.draws++,
+    p_instance->commands.indexed_draws++,
+    p_instance->commands.instances  += instance_count,
+    p_instance->commands.primitives += (size_t) index_count / 3 * instance_count;
+
+    // null backend
+    if ( G10_BACKEND_NULL == p_instance->backend ) return 1;
+
+    #ifdef G10_BUILD_WITH_SDL3
+        SDL_DrawGPUIndexedPrimitives(p_render_pass->p_handle, index_count, instance_count, 0, 0, 0);
+    #endif
+
+    // success
+    return 1;
+}
+
+int command_sink_reset ( command_sink *p_command_sink )
+{
+
+    // argument check
+    if ( NULL == p_command_sink ) goto no_command_sink;
+
+    // zero set
+    *p_command_sink = (command_sink) { 0 };
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_command_sink:
+                #ifndef NDEBUG
+                    log_error("[g10] [command] Null pointer provided for parameter \"p_command_sink\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int command_sink_info ( command_sink *p_command_sink )
+{
+
+    // argument check
+    if ( NULL == p_command_sink ) goto no_command_sink;
+
+    // initialized data
+    double frames = ( p_command_sink->frames ) ? (double) p_command_sink->frames : 1.0;
+
+    // print the sink, as totals and per frame averages
+    logger_pad(), log_info("Command sink @%p\n", p_command_sink),
+    logger_push(),
+    logger_pad(), printf("frames          - %zu\n", p_command_sink->frames),
+    logger_pad(), printf("render passes   - %zu (%.1f / frame)\n", p_command_sink->render_passes       , p_command_sink->render_passes        / frames),
+    logger_pad(), printf("pipeline binds  - %zu (%.1f / frame)\n", p_command_sink->pipeline_binds      , p_command_sink->pipeline_binds       / frames),
+    logger_pad(), printf("uniform pushes  - %zu (%.1f / frame)\n", p_command_sink->uniform_pushes      , p_command_sink->uniform_pushes       / frames),
+    logger_pad(), printf("uniform bytes   - %zu (%.1f / frame)\n", p_command_sink->uniform_bytes       , p_command_sink->uniform_bytes        / frames),
+    logger_pad(), printf("vertex buffers  - %zu (%.1f / frame)\n", p_command_sink->vertex_buffer_binds , p_command_sink->vertex_buffer_binds  / frames),
+    logger_pad(), printf("index buffers   - %zu (%.1f / frame)\n", p_command_sink->index_buffer_binds  , p_command_sink->index_buffer_binds   / frames),
+    logger_pad(), printf("storage buffers - %zu (%.1f / frame)\n", p_command_sink->storage_buffer_binds, p_command_sink->storage_buffer_binds / frames),
+    logger_pad(), printf("samplers        - %zu (%.1f / frame)\n", p_command_sink->sampler_binds       , p_command_sink->sampler_binds        / frames),
+    logger_pad(), printf("draws           - %zu (%.1f / frame)\n", p_command_sink->draws               , p_command_sink->draws                / frames),
+    logger_pad(), printf("indexed draws   - %zu (%.1f / frame)\n", p_command_sink->indexed_draws       , p_command_sink->indexed_draws        / frames),
+    logger_pad(), printf("instances       - %zu (%.1f / frame)\n", p_command_sink->instances           , p_command_sink->instances            / frames),
+    logger_pad(), printf("primitives      - %zu (%.1f / frame)\n", p_command_sink->primitives          , p_command_sink->primitives           / frames),
+    logger_pad(), printf("uploads         - %zu (%.1f / frame)\n", p_command_sink->uploads             , p_command_sink->uploads              / frames),
+    logger_pad(), printf("upload bytes    - %zu (%.1f / frame)\n", p_command_sink->upload_bytes        , p_command_sink->upload_bytes         / frames),
+    logger_pop();
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_command_sink:
+                #ifndef NDEBUG
+                    log_error("[g10] [command] Null pointer provided for parameter \"p_command_sink\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
@@ -0,0 +1,313 @@
+/** !
+ * Frame linear draw lists
+ *
+ * @file src/renderer/draw_list.c
+ *
+ * @author Jacob Smith
+ */
+
+// header
+#include <draw_list.h>
+
+// standard library
+#include <stdint.h>
+
+// function definitions
+int draw_list_construct ( draw_list **pp_draw_list, size_t max )
+{
+
+    // argument check
+    if ( pp_draw_list == (void *) 0 ) goto no_draw_list;
+
+    // initialized data
+    draw_list *p_draw_list = default_allocator(0, sizeof(draw_list));
+
+    // error check
+    if ( p_draw_list == (void *) 0 ) goto no_mem;
+
+    // populate the draw list
+    p_draw_list->p_packets = (void *) 0,
+    p_draw_list->p_scratch = (void *) 0,
+    p_draw_list->count     = 0,
+    p_draw_list->max       = 0;
+
+    // allocate the packets
+    if ( 0 == draw_list_reserve(p_draw_list, max) ) goto no_mem;
+
+    // return a pointer to the caller
+    *pp_draw_list = p_draw_list;
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_draw_list:
+                #ifndef NDEBUG
+                    log_error("[g10] [draw list] Null pointer provided for parameter \"pp_draw_list\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // release the draw list
+                default_allocator(p_draw_list, 0);
+
+                // error
+                return 0;
+        }
+    }
+}
+
+static u64 draw_key_fold ( const void *p, u32 bits )
+{
+
+    // initialized data
+    u64 v = (u64) (uintptr_t) p;
+
+    // fold the address down
+    v ^= v >> 4, v ^= v >> 17, v ^= v >> 35;
+
+    // done
+    return v & ( ( 1ull << bits ) - 1 );
+}
+
+u64 draw_key ( enum draw_sort_e sort, const void *p_pipeline, const void *p_material, const void *p_geometry, float depth )
+{
+
+    // initialized data
+    u64 state = ( draw_key_fold(p_pipeline, 8) << 32 ) | ( draw_key_fold(p_material, 16) << 16 ) | draw_key_fold(p_geometry, 16),
+        d     = 0;
+
+    // quantize the depth
+    if ( depth > 0.0f ) d = ( depth >= 1.0f ) ? ( 1ull << DRAW_KEY_DEPTH_BITS ) - 1 : (u64) ( depth * (float) ( ( 1ull << DRAW_KEY_DEPTH_BITS ) - 1 ) );
+
+    // pack the key
+    switch ( sort )
+    {
+        case DRAW_SORT_OPAQUE:
+            return ( state << DRAW_KEY_DEPTH_BITS ) | d;
+
+        case DRAW_SORT_TRANSPARENT:
+            return ( ( ~d & ( ( 1ull << DRAW_KEY_DEPTH_BITS ) - 1 ) ) << 40 ) | state;
+
+        default:
+            return 0;
+    }
+}
+
+int draw_list_add ( draw_list *p_draw_list, void *p_drawable, u64 key )
+{
+
+    // argument check
+    if ( p_draw_list == (void *) 0 ) return 0;
+
+    // full, so double the list
+    if ( p_draw_list->count == p_draw_list->max )
+        if ( 0 == draw_list_reserve(p_draw_list, ( p_draw_list->max ) ? p_draw_list->max * 2 : 64) ) goto failed_to_grow;
+
+    // store the packet
+    p_draw_list->p_packets[p_draw_list->count++] = (draw_packet)
+    {
+        .key        = key,
+        .p_drawable = p_drawable
+    };
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // g10 errors
+        {
+            failed_to_grow:
+                #ifndef NDEBUG
+                    log_error("[g10] [draw list] Failed to grow draw list past %zu packets in call to function \"%s\"\n", p_draw_list->max, __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int draw_list_reserve ( draw_list *p_draw_list, size_t max )
+{
+
+    // argument check
+    if ( p_draw_list == (void *) 0 ) return 0;
+
+    // already large enough
+    if ( max <= p_draw_list->max ) return 1;
+
+    // initialized data
+    draw_packet *p_packets = default_allocator(p_draw_list->p_packets, max * sizeof(draw_packet)),
+                *p_scratch = (void *) 0;
+
+    // error check
+    if ( p_packets == (void *) 0 ) goto no_mem;
+
+    // store the packets
+    p_draw_list->p_packets = p_packets;
+
+    // grow the sort buffer
+    p_scratch = default_allocator(p_draw_list->p_scratch, max * sizeof(draw_packet));
+
+    // error check
+    if ( p_scratch == (void *) 0 ) goto no_mem;
+
+    // store the sort buffer
+    p_draw_list->p_scratch = p_scratch,
+    p_draw_list->max       = max;
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int draw_list_reset ( draw_list *p_draw_list )
+{
+
+    // argument check
+    if ( p_draw_list == (void *) 0 ) return 0;
+
+    // empty the list
+    p_draw_list->count = 0;
+
+    // success
+    return 1;
+}
+
+int draw_list_sort ( draw_list *p_draw_list )
+{
+
+    // argument check
+    if ( p_draw_list == (void *) 0 ) return 0;
+
+    // initialized data
+    size_t count = draw_list_size(p_draw_list),
+           histogram[8][256] = { 0 };
+    draw_packet *p_src = p_draw_list->p_packets,
+                *p_dst = p_draw_list->p_scratch;
+
+    // nothing to sort
+    if ( count < 2 ) return 1;
+
+    // count every digit in one pass
+    for ( size_t i = 0; i < count; i++ )
+        for ( size_t d = 0; d < 8; d++ )
+            histogram[d][( p_src[i].key >> ( d * 8 ) ) & 0xFF]++;
+
+    // one pass per digit
+    for ( size_t d = 0; d < 8; d++ )
+    {
+
+        // initialized data
+        size_t *p_counts = histogram[d],
+               offset = 0;
+
+        // every key shares this digit
+        if ( p_counts[( p_src[0].key >> ( d * 8 ) ) & 0xFF] == count ) continue;
+
+        // exclusive prefix sum
+        for ( size_t b = 0; b < 256; b++ )
+        {
+            size_t c = p_counts[b];
+
+            p_counts[b] = offset,
+            offset += c;
+        }
+
+        // scatter
+        for ( size_t i = 0; i < count; i++ )
+            p_dst[p_counts[( p_src[i].key >> ( d * 8 ) ) & 0xFF]++] = p_src[i];
+
+        // swap
+        {
+            draw_packet *p_tmp = p_src;
+
+            p_src = p_dst,
+            p_dst = p_tmp;
+        }
+    }
+
+    // the sorted packets are the list
+    p_draw_list->p_packets = p_src,
+    p_draw_list->p_scratch = p_dst;
+
+    // success
+    return 1;
+}
+
+size_t draw_list_size ( draw_list *p_draw_list )
+{
+
+    // argument check
+    if ( p_draw_list == (void *) 0 ) return 0;
+
+    // done
+    return p_draw_list->count;
+}
+
+int draw_list_destroy ( draw_list **pp_draw_list )
+{
+
+    // argument check
+    if ( pp_draw_list == (void *) 0 ) goto no_draw_list;
+
+    // initialized data
+    draw_list *p_draw_list = *pp_draw_list;
+
+    // no more pointer for caller
+    *pp_draw_list = (void *) 0;
+
+    // release the memory
+    if ( p_draw_list )
+        default_allocator(p_draw_list->p_packets, 0),
+        default_allocator(p_draw_list->p_scratch, 0),
+        default_allocator(p_draw_list, 0);
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_draw_list:
+                #ifndef NDEBUG
+                    log_error("[g10] [draw list] Null pointer provided for parameter \"pp_draw_list\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
@@ -1,5 +1,8 @@
 #include <geometry.h>
 
+// standard library
+#include <math.h>
+
 // function definitions
 int geometry_bind ( render_pass *p_render_pass, geometry *p_geometry )
 {
@@ -8,6 +11,514 @@ int geometry_bind ( render_pass *p_render_pass, geometry *p_geometry )
     return g_sdl3_geometry_bind(p_render_pass, p_geometry);
 }
 
+int geometry_load ( geometry **pp_geometry, const char *p_path, const void *p_data, size_t size )
+{
+
+    // argument check
+    if ( NULL == pp_geometry ) goto no_geometry;
+    if ( NULL ==      p_data ) goto no_data;
+
+    // external functions
+    extern int g_sdl3_geometry_from_json ( geometry **pp_geometry, const json_value *p_value );
+    extern int g_sdl3_geometry_from_binary ( geometry **pp_geometry, const void *p_data, size_t size );
+
+    // initialized data
+    json_value *p_value = NULL;
+    char *p_text = NULL;
+    int result = 0;
+
+    // binary geometry -> upload straight from the contents
+    if ( size >= sizeof(u32) && GEOMETRY_BINARY_MAGIC == *(const u32 *)p_data )
+        return g_sdl3_geometry_from_binary(pp_geometry, p_data, size);
+
+    // allocate memory for the text
+    p_text = default_allocator(0, size + 1);
+
+    // error check
+    if ( NULL == p_text ) goto no_mem;
+
+    // copy the contents, and null terminate
+    memcpy(p_text, p_data, size);
+    p_text[size] = '\0';
+
+    // parse the text
+    if ( 0 == json_value_parse(p_text, NULL, &p_value) ) goto failed_to_parse_json;
+
+    // construct the geometry
+    result = g_sdl3_geometry_from_json(pp_geometry, p_value);
+
+    // release the json value
+    json_value_free(p_value, 0);
+
+    // release the text
+    p_text = default_allocator(p_text, 0);
+
+    // done
+    return result;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_geometry:
+                #ifndef NDEBUG
+                    log_error("[g10] [geometry] Null pointer provided for parameter \"pp_geometry\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_data:
+                #ifndef NDEBUG
+                    log_error("[g10] [geometry] Null pointer provided for parameter \"p_data\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // json errors
+        {
+            failed_to_parse_json:
+                #ifndef NDEBUG
+                    log_error("[g10] [geometry] Failed to parse \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // release the text
+                p_text = default_allocator(p_text, 0);
+
+                // error
+                return 0;
+        }
+
+        // standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+static bool geometry_binary_range_valid ( geometry_binary_range _range, size_t size )
+{
+
+    // absent
+    if ( 0 == _range.size ) return true;
+
+    // aligned, and inside the file
+    return ( 0 == _range.offset % GEOMETRY_BINARY_ALIGN ) &&
+           ( _range.offset <= size                      ) &&
+           ( _range.size   <= size - _range.offset      );
+}
+
+int geometry_binary_validate ( const void *p_data, size_t size, const geometry_binary_header **pp_header )
+{
+
+    // argument check
+    if ( NULL ==    p_data ) goto no_data;
+    if ( NULL == pp_header ) goto no_header;
+
+    // initialized data
+    static const size_t _components[GEOMETRY_QTY] = 
+    {
+        [GEOMETRY_XYZ]  = 3,
+        [GEOMETRY_UV]   = 2,
+        [GEOMETRY_NXYZ] = 3,
+        [GEOMETRY_TXYZ] = 4,
+        [GEOMETRY_BXYZ] = 3
+    };
+    const geometry_binary_header *p_header = p_data;
+
+    // header
+    if ( size < sizeof(geometry_binary_header)                ) goto malformed;
+    if ( GEOMETRY_BINARY_MAGIC   != p_header->magic           ) goto malformed;
+    if ( GEOMETRY_BINARY_VERSION != p_header->version         ) goto wrong_version;
+    if ( sizeof(geometry_binary_header) != p_header->header_size ) goto malformed;
+    if ( GEOMETRY_PARTS_MAX < p_header->part_count            ) goto malformed;
+
+    // the position stream defines the vertex count
+    if ( p_header->_attributes[GEOMETRY_XYZ].size != (u64) p_header->vertex_count * 3 * sizeof(f32) ) goto malformed;
+
+    // vertex attributes. a present stream has one element per vertex
+    for (size_t i = 0; i < GEOMETRY_QTY; i++)
+    {
+        if ( false == geometry_binary_range_valid(p_header->_attributes[i], size) ) goto malformed;
+        if ( 0 == p_header->_attributes[i].size ) continue;
+        if ( p_header->_attributes[i].size != (u64) p_header->vertex_count * _components[i] * sizeof(f32) ) goto malformed;
+    }
+
+    // indices
+    if ( false == geometry_binary_range_valid(p_header->idx, size) ) goto malformed;
+    if ( p_header->idx.size != (u64) p_header->index_count * 3 * sizeof(u32) ) goto malformed;
+
+    // parts
+    for (size_t i = 0; i < p_header->part_count; i++)
+    {
+        if ( false == geometry_binary_range_valid(p_header->_parts[i].idx, size) ) goto malformed;
+        if ( p_header->_parts[i].idx.size != (u64) p_header->_parts[i].index_count * sizeof(u32) ) goto malformed;
+    }
+
+    // return a pointer to the caller
+    *pp_header = p_header;
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_data:
+                #ifndef NDEBUG
+                    log_error("[g10] [geometry] Null pointer provided for parameter \"p_data\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_header:
+                #ifndef NDEBUG
+                    log_error("[g10] [geometry] Null pointer provided for parameter \"pp_header\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // format errors
+        {
+            malformed:
+                #ifndef NDEBUG
+                    log_error("[g10] [geometry] Malformed binary geometry in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            wrong_version:
+                #ifndef NDEBUG
+                    log_error("[g10] [geometry] Binary geometry version %u is not supported, expected %u, in call to function \"%s\"\n", p_header->version, GEOMETRY_BINARY_VERSION, __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+static size_t geometry_binary_align ( size_t offset )
+{
+
+    // done
+    return ( offset + GEOMETRY_BINARY_ALIGN - 1 ) & ~(size_t)( GEOMETRY_BINARY_ALIGN - 1 );
+}
+
+int geometry_binary_from_json ( const json_value *p_value, void **pp_data, size_t *p_size )
+{
+
+    // argument check
+    if ( NULL == p_value ) goto no_value;
+    if ( NULL == pp_data ) goto no_data;
+    if ( NULL ==  p_size ) goto no_size;
+
+    // type check
+    if ( JSON_VALUE_OBJECT != p_value->type ) goto wrong_type;
+
+    // initialized data
+    static const char *_attribute_names[GEOMETRY_QTY] = 
+    {
+        [GEOMETRY_XYZ]  = "xyz",
+        [GEOMETRY_UV]   = "uv",
+        [GEOMETRY_NXYZ] = "nxyz",
+        [GEOMETRY_TXYZ] = "txyz",
+        [GEOMETRY_BXYZ] = "bxyz"
+    };
+    dict *p_dict = p_value->object;
+    json_value *p_name  = NULL,
+               *p_idx   = NULL,
+               *p_parts = NULL,
+               *_p_attributes[GEOMETRY_QTY] = { 0 },
+               *_p_part_idx[GEOMETRY_PARTS_MAX] = { 0 };
+    geometry_binary_header _header = 
+    {
+        .magic       = GEOMETRY_BINARY_MAGIC,
+        .version     = GEOMETRY_BINARY_VERSION,
+        .header_size = sizeof(geometry_binary_header),
+        .min         = {  INFINITY,  INFINITY,  INFINITY, 0 },
+        .max         = { -INFINITY, -INFINITY, -INFINITY, 0 }
+    };
+    size_t size = sizeof(geometry_binary_header);
+    u8 *p_data = NULL;
+
+    dict_get(p_dict, "name" , (void **)&p_name);
+    dict_get(p_dict, "idx"  , (void **)&p_idx);
+    dict_get(p_dict, "parts", (void **)&p_parts);
+
+    for (size_t i = 0; i < GEOMETRY_QTY; i++)
+        dict_get(p_dict, _attribute_names[i], (void **)&_p_attributes[i]);
+
+    // error check
+    if ( NULL == _p_attributes[GEOMETRY_XYZ] ) goto no_xyz;
+
+    // store the name
+    if ( p_name && JSON_VALUE_STRING == p_name->type )
+        strncpy(_header._name, p_name->string, sizeof(_header._name) - 1);
+
+    // lay out the vertex attributes
+    for (size_t i = 0; i < GEOMETRY_QTY; i++)
+    {
+
+        // absent
+        if ( NULL == _p_attributes[i] ) continue;
+
+        // store the range
+        _header._attributes[i] = (geometry_binary_range)
+        {
+            .offset = size,
+            .size   = array_size(_p_attributes[i]->list) * sizeof(f32)
+        };
+
+        // next stream
+        size = geometry_binary_align(size + _header._attributes[i].size);
+    }
+
+    // store the vertex count
+    _header.vertex_count = (u32) ( _header._attributes[GEOMETRY_XYZ].size / ( 3 * sizeof(f32) ) );
+
+    // lay out the indices
+    if ( p_idx )
+    {
+
+        // store the triangle count
+        _header.index_count = (u32) ( array_size(p_idx->list) / 3 );
+
+        // store the range
+        _header.idx = (geometry_binary_range)
+        {
+            .offset = size,
+            .size   = (u64) _header.index_count * 3 * sizeof(u32)
+        };
+
+        // next stream
+        size = geometry_binary_align(size + _header.idx.size);
+    }
+
+    // lay out the parts
+    if ( p_parts )
+    {
+
+        // store the quantity of parts
+        _header.part_count = (u32) array_size(p_parts->list);
+
+        // clamp
+        if ( _header.part_count > GEOMETRY_PARTS_MAX ) _header.part_count = GEOMETRY_PARTS_MAX;
+
+        for (size_t i = 0; i < _header.part_count; i++)
+        {
+
+            // initialized data
+            json_value *p_part     = NULL,
+                       *p_material = NULL;
+
+            // store the i'th part
+            array_index(p_parts->list, i, (void **)&p_part);
+            dict_get(p_part->object, "material", (void **)&p_material);
+            dict_get(p_part->object, "idx"     , (void **)&_p_part_idx[i]);
+
+            // store the material name
+            if ( p_material && JSON_VALUE_STRING == p_material->type )
+                strncpy(_header._parts[i]._material_name, p_material->string, sizeof(_header._parts[i]._material_name) - 1);
+
+            // absent
+            if ( NULL == _p_part_idx[i] ) continue;
+
+            // store the index quantity
+            _header._parts[i].index_count = (u32) array_size(_p_part_idx[i]->list);
+
+            // store the range
+            _header._parts[i].idx = (geometry_binary_range)
+            {
+                .offset = size,
+                .size   = (u64) _header._parts[i].index_count * sizeof(u32)
+            };
+
+            // next stream
+            size = geometry_binary_align(size + _header._parts[i].idx.size);
+        }
+    }
+
+    // allocate memory for the file
+    p_data = default_allocator(0, size);
+
+    // error check
+    if ( NULL == p_data ) goto no_mem;
+
+    // zero the padding
+    memset(p_data, 0, size);
+
+    // write the vertex attributes
+    for (size_t i = 0; i < GEOMETRY_QTY; i++)
+    {
+
+        // initialized data
+        f32 *p_stream = (f32 *)(p_data + _header._attributes[i].offset);
+        size_t len = _header._attributes[i].size / sizeof(f32);
+
+        // absent
+        if ( NULL == _p_attributes[i] ) continue;
+
+        // convert each number
+        for (size_t j = 0; j < len; j++)
+        {
+
+            // initialized data
+            json_value *p_number = NULL;
+
+            // store the j'th number
+            array_index(_p_attributes[i]->list, j, (void **)&p_number);
+            p_stream[j] = (f32) ( JSON_VALUE_INTEGER == p_number->type ? (double) p_number->integer : p_number->number );
+        }
+    }
+
+    // compute the bounds
+    for (size_t i = 0; i < _header.vertex_count; i++)
+    {
+
+        // initialized data
+        const f32 *p_xyz = (const f32 *)(p_data + _header._attributes[GEOMETRY_XYZ].offset) + i * 3;
+
+        for (size_t j = 0; j < 3; j++)
+            _header.min[j] = ( p_xyz[j] < _header.min[j] ) ? p_xyz[j] : _header.min[j],
+            _header.max[j] = ( p_xyz[j] > _header.max[j] ) ? p_xyz[j] : _header.max[j];
+    }
+
+    // write the indices
+    if ( p_idx )
+    {
+
+        // initialized data
+        u32 *p_stream = (u32 *)(p_data + _header.idx.offset);
+
+        for (size_t i = 0; i < (size_t) _header.index_count * 3; i++)
+        {
+
+            // initialized data
+            json_value *p_index = NULL;
+
+            // store the i'th index
+            array_index(p_idx->list, i, (void **)&p_index);
+            p_stream[i] = (u32) p_index->integer;
+        }
+    }
+
+    // write the parts
+    for (size_t i = 0; i < _header.part_count; i++)
+    {
+
+        // initialized data
+        u32 *p_stream = (u32 *)(p_data + _header._parts[i].idx.offset);
+
+        // absent
+        if ( NULL == _p_part_idx[i] ) continue;
+
+        for (size_t j = 0; j < _header._parts[i].index_count; j++)
+        {
+
+            // initialized data
+            json_value *p_index = NULL;
+
+            // store the j'th index
+            array_index(_p_part_idx[i]->list, j, (void **)&p_index);
+            p_stream[j] = (u32) p_index->integer;
+        }
+    }
+
+    // write the header
+    memcpy(p_data, &_header, sizeof(geometry_binary_header));
+
+    // return a pointer to the caller
+    *pp_data = p_data,
+    *p_size  = size;
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_value:
+                #ifndef NDEBUG
+                    log_error("[g10] [geometry] Null pointer provided for parameter \"p_value\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_data:
+                #ifndef NDEBUG
+                    log_error("[g10] [geometry] Null pointer provided for parameter \"pp_data\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_size:
+                #ifndef NDEBUG
+                    log_error("[g10] [geometry] Null pointer provided for parameter \"p_size\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            wrong_type:
+                #ifndef NDEBUG
+                    log_error("[g10] [geometry] Parameter \"p_value\" must be of type [ object ] in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // json errors
+        {
+            no_xyz:
+                #ifndef NDEBUG
+                    log_error("[g10] [geometry] Parameter \"p_value\" is missing required property \"xyz\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int geometry_release ( geometry *p_geometry )
+{
+    extern int g_sdl3_geometry_destroy ( geometry **pp_geometry );
+
+    return g_sdl3_geometry_destroy(&p_geometry);
+}
+
 int geometry_info ( geometry *p_geometry )
 {
 
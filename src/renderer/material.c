@@ -1,7 +1,6 @@
 #include <material.h>
 
 // external functions
-extern int g_sdl3_texture_load ( texture **pp_texture, const char *p_path );
 int g_sdl3_texture_from_color ( texture **pp_texture, f32 r, f32 g, f32 b, f32 a );
 
 int material_from_json ( material **pp_material, json_value *p_value )
@@ -16,6 +15,7 @@ int material_from_json ( material **pp_material, json_value *p_value )
     memset(p_material, 0, sizeof(material));
 
     dict *p_dict = p_value->object;
+    asset_cache *p_textures = g_active_instance()->cache.p_texture_files;
 
     // name
     json_value *p_name = NULL;
@@ -29,7 +29,7 @@ int material_from_json ( material **pp_material, json_value *p_value )
     if ( p_albedo )
     {
         if ( p_albedo->type == JSON_VALUE_STRING )
-            g_sdl3_texture_load(&p_material->p_albedo_map, p_albedo->string);
+            asset_cache_acquire(p_textures, p_albedo->string, (void **)&p_material->p_albedo_map);
         else if ( p_albedo->type == JSON_VALUE_ARRAY )
         {
             array *list = p_albedo->list;
@@ -51,7 +51,7 @@ int material_from_json ( material **pp_material, json_value *p_value )
     if ( p_normal )
     {
         if ( p_normal->type == JSON_VALUE_STRING )
-            g_sdl3_texture_load(&p_material->p_normal_map, p_normal->string);
+            asset_cache_acquire(p_textures, p_normal->string, (void **)&p_material->p_normal_map);
         else if ( p_normal->type == JSON_VALUE_ARRAY )
         {
             g_sdl3_texture_from_color(&p_material->p_normal_map, 0.5, 0.5, 1.0, 1.0);
@@ -64,7 +64,7 @@ int material_from_json ( material **pp_material, json_value *p_value )
     if ( p_roughness )
     {
         if ( p_roughness->type == JSON_VALUE_STRING )
-             g_sdl3_texture_load(&p_material->p_roughness_map, p_roughness->string);
+             asset_cache_acquire(p_textures, p_roughness->string, (void **)&p_material->p_roughness_map);
         else if ( p_roughness->type == JSON_VALUE_NUMBER )
             p_material->roughness_value = (float)p_roughness->number;
     }
@@ -75,7 +75,7 @@ int material_from_json ( material **pp_material, json_value *p_value )
     if ( p_metallic )
     {
         if ( p_metallic->type == JSON_VALUE_STRING )
-             g_sdl3_texture_load(&p_material->p_metal_map, p_metallic->string);
+             asset_cache_acquire(p_textures, p_metallic->string, (void **)&p_material->p_metal_map);
         else if ( p_metallic->type == JSON_VALUE_NUMBER )
             p_material->metallic_value = (float)p_metallic->number;
     }
@@ -84,6 +84,112 @@ int material_from_json ( material **pp_material, json_value *p_value )
     return 1;
 }
 
+int material_load ( material **pp_material, const char *p_path, const void *p_data, size_t size )
+{
+
+    // argument check
+    if ( NULL == pp_material ) goto no_material;
+    if ( NULL ==      p_data ) goto no_data;
+
+    // initialized data
+    json_value *p_value = NULL;
+    char *p_text = default_allocator(0, size + 1);
+    int result = 0;
+
+    // error check
+    if ( NULL == p_text ) goto no_mem;
+
+    // copy the contents, and null terminate
+    memcpy(p_text, p_data, size);
+    p_text[size] = '\0';
+
+    // parse the text
+    if ( 0 == json_value_parse(p_text, NULL, &p_value) ) goto failed_to_parse_json;
+
+    // construct the material
+    result = material_from_json(pp_material, p_value);
+
+    // release the json value
+    json_value_free(p_value, 0);
+
+    // release the text
+    p_text = default_allocator(p_text, 0);
+
+    // done
+    return result;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_material:
+                #ifndef NDEBUG
+                    log_error("[g10] [material] Null pointer provided for parameter \"pp_material\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_data:
+                #ifndef NDEBUG
+                    log_error("[g10] [material] Null pointer provided for parameter \"p_data\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // json errors
+        {
+            failed_to_parse_json:
+                #ifndef NDEBUG
+                    log_error("[g10] [material] Failed to parse \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // release the text
+                p_text = default_allocator(p_text, 0);
+
+                // error
+                return 0;
+        }
+
+        // standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int material_release ( material *p_material )
+{
+
+    // argument check
+    if ( NULL == p_material ) return 0;
+
+    // initialized data
+    asset_cache *p_textures = g_active_instance()->cache.p_texture_files;
+
+    // drop texture references. solid color textures are not in the file cache
+    if ( p_material->p_albedo_map    ) asset_cache_release(p_textures, p_material->p_albedo_map);
+    if ( p_material->p_normal_map    ) asset_cache_release(p_textures, p_material->p_normal_map);
+    if ( p_material->p_roughness_map ) asset_cache_release(p_textures, p_material->p_roughness_map);
+    if ( p_material->p_metal_map     ) asset_cache_release(p_textures, p_material->p_metal_map);
+    if ( p_material->p_emission_map  ) asset_cache_release(p_textures, p_material->p_emission_map);
+
+    // release the material
+    p_material = default_allocator(p_material, 0);
+
+    // success
+    return 1;
+}
+
 int material_bind ( render_pass *p_render_pass, pipeline *p_pipeline, material *p_material )
 {
 
@@ -102,30 +208,10 @@ int material_bind ( render_pass *p_render_pass, pipeline *p_pipeline, material *
     //array_index(p_pipeline->p_samplers, 3, &p_metal_sampler);
 
     if ( p_material->p_albedo_map )
-    {
-        SDL_BindGPUFragmentSamplers(
-            p_render_pass->p_handle,
-            p_texture_sampler->idx, 
-            &(SDL_GPUTextureSamplerBinding){
-                .sampler = p_texture_sampler->p_handle,
-                .texture = p_material->p_albedo_map->p_handle
-            },
-            1
-        );
-    }
+        command_bind_sampler(p_render_pass, p_texture_sampler->idx, p_material->p_albedo_map->p_handle, p_texture_sampler->p_handle);
 
     if ( p_material->p_normal_map )
-    {
-        SDL_BindGPUFragmentSamplers(
-            p_render_pass->p_handle,
-            p_normal_sampler->idx, 
-            &(SDL_GPUTextureSamplerBinding){
-                .sampler = p_normal_sampler->p_handle,
-                .texture = p_material->p_normal_map->p_handle
-            },
-            1
-        );
-    }
+        command_bind_sampler(p_render_pass, p_normal_sampler->idx, p_material->p_normal_map->p_handle, p_normal_sampler->p_handle);
 /*
     if ( p_material->p_roughness_map )
     {
@@ -1,5 +1,12 @@
 #include <pipeline.h>
 
+// standard library
+#include <stdatomic.h>
+
+// data
+static _Atomic(u64) _pipeline_generation = 1,
+                    _pipeline_lookups    = 0;
+
 // function definitions
 int pipeline_set_bind_once (pipeline *p_pipeline, fn_pipeline_bind_once *pfn_bind_once)
 {
@@ -88,3 +95,43 @@ int pipeline_equality ( const pipeline *p_a, const pipeline *p_b )
 
     return p_a == p_b;
 }
+
+pipeline *pipeline_handle_get ( pipeline_handle *p_handle, const char *p_name )
+{
+
+    // argument check
+    if ( p_handle == (void *) 0 ) return 0;
+
+    // initialized data
+    u64 generation = atomic_load_explicit(&_pipeline_generation, memory_order_acquire);
+    pipeline *p_pipeline = 0;
+
+    // fast path
+    if ( p_handle->generation == generation ) return p_handle->p_pipeline;
+
+    // look up the pipeline
+    if ( p_name )
+        atomic_fetch_add_explicit(&_pipeline_lookups, 1, memory_order_relaxed),
+        dict_get(g_active_instance()->cache.p_pipeline, p_name, (void **)&p_pipeline);
+
+    // store
+    p_handle->p_pipeline = p_pipeline,
+    p_handle->generation = generation;
+
+    // done
+    return p_pipeline;
+}
+
+void pipeline_cache_invalidate ( void )
+{
+
+    // every handle is now stale
+    atomic_fetch_add_explicit(&_pipeline_generation, 1, memory_order_release);
+}
+
+u64 pipeline_lookup_count ( void )
+{
+
+    // done
+    return atomic_load_explicit(&_pipeline_lookups, memory_order_relaxed);
+}
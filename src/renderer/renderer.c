@@ -2,6 +2,23 @@
 #include <renderer.h>
 #include <attachment.h>
 #include <render_pass.h>
+#include <user_code.h>
+#include <schedule.h>
+
+// standard library
+#include <stdlib.h>
+
+// comparators
+static int renderer_frame_time_compare ( const void *p_a, const void *p_b )
+{
+
+    // initialized data
+    double a = *(const double *)p_a,
+           b = *(const double *)p_b;
+
+    // done
+    return ( a > b ) - ( a < b );
+}
 
 int renderer_info ( renderer *p_renderer )
 {
@@ -50,6 +67,9 @@ int renderer_render ( g_instance *p_instance )
     // late
     p_renderer->pfn_late(p_instance);
 
+    // count the frame
+    p_instance->commands.frames++;
+
     // success
     return 1;
 
@@ -68,3 +88,99 @@ int renderer_render ( g_instance *p_instance )
         }
     }
 }
+
+int renderer_benchmark ( g_instance *p_instance, size_t frames )
+{
+
+    // argument check
+    if ( NULL == p_instance ) goto no_instance;
+    if ( 0    ==     frames ) goto no_frames;
+
+    // initialized data
+    double *p_times = default_allocator(0, frames * sizeof(double)),
+           sum = 0.0;
+    size_t count = 0;
+
+    // error check
+    if ( NULL == p_times ) goto no_mem;
+
+    // count this run only
+    command_sink_reset(&p_instance->commands);
+
+    // run each frame
+    for (count = 0; count < frames && p_instance->running; count++)
+    {
+
+        // initialized data
+        timestamp t0 = timer_high_precision(),
+                  t1 = 0;
+
+        // run each system of the schedule
+        schedule_run(p_instance->p_schedule, p_instance);
+
+        // store the frame time
+        t1 = timer_high_precision(),
+        p_times[count] = (double)( t1 - t0 ) * 1000.0 / (double) timer_seconds_divisor(),
+        sum += p_times[count];
+    }
+
+    // nothing ran
+    if ( 0 == count ) goto done;
+
+    // order the frame times
+    qsort(p_times, count, sizeof(double), renderer_frame_time_compare);
+
+    // print the frame times
+    logger_pad(), log_info("Benchmark %s, %zu frames\n", command_backend_name(p_instance->backend), count),
+    logger_push(),
+    logger_pad(), printf("mean   - %8.3f ms\n", sum / (double) count),
+    logger_pad(), printf("min    - %8.3f ms\n", p_times[0]),
+    logger_pad(), printf("median - %8.3f ms\n", p_times[count / 2]),
+    logger_pad(), printf("p99    - %8.3f ms\n", p_times[( count * 99 ) / 100]),
+    logger_pad(), printf("max    - %8.3f ms\n", p_times[count - 1]),
+    command_sink_info(&p_instance->commands),
+    schedule_info(p_instance->p_schedule),
+    logger_pop();
+
+    done:
+
+    // release the frame times
+    p_times = default_allocator(p_times, 0);
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_instance:
+                #ifndef NDEBUG
+                    log_error("[g10] [renderer] Null pointer provided for parameter \"p_instance\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_frames:
+                #ifndef NDEBUG
+                    log_error("[g10] [renderer] Parameter \"frames\" must be greater than zero in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
@@ -1,5 +1,9 @@
 #include <texture.h>
 
+// external functions
+extern int g_sdl3_texture_from_memory ( texture **pp_texture, const void *p_data, size_t size );
+extern int g_sdl3_texture_destroy ( texture **pp_texture );
+
 const char *texture_key_accessor ( const texture *const p_texture )
 {
     return p_texture->_name;
@@ -9,3 +13,52 @@ int texture_equality ( const texture *p_a, const texture *p_b )
 {
     return p_a == p_b;
 }
+
+int texture_load ( texture **pp_texture, const char *p_path, const void *p_data, size_t size )
+{
+
+    // argument check
+    if ( NULL == pp_texture ) goto no_texture;
+
+    // construct the texture
+    if ( 0 == g_sdl3_texture_from_memory(pp_texture, p_data, size) ) goto failed_to_load_texture;
+
+    // name the texture after its path
+    strncpy((*pp_texture)->_name, p_path, sizeof((*pp_texture)->_name) - 1);
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_texture:
+                #ifndef NDEBUG
+                    log_error("[g10] [texture] Null pointer provided for parameter \"pp_texture\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // texture errors
+        {
+            failed_to_load_texture:
+                #ifndef NDEBUG
+                    log_error("[g10] [texture] Failed to load texture \"%s\" in call to function \"%s\"\n", p_path, __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int texture_release ( texture *p_texture )
+{
+
+    // done
+    return g_sdl3_texture_destroy(&p_texture);
+}
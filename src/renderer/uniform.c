@@ -15,9 +15,6 @@ int uniform_set_pack_push ( uniform *p_uniform, void *p_data, fn_pack *pfn_pack
     if ( NULL ==    p_data ) goto no_data;
     if ( NULL ==  pfn_pack ) goto no_pack;
     
-    // initialized data
-    g_instance *p_instance = g_active_instance();
-
     // set
     p_uniform->p_data = p_data;
 
@@ -25,8 +22,7 @@ int uniform_set_pack_push ( uniform *p_uniform, void *p_data, fn_pack *pfn_pack
     p_uniform->len = pfn_pack(&p_uniform->_buffer, p_uniform->p_data);
 
     // push
-    SDL_PushGPUVertexUniformData(p_instance->graphics.sdl3.command_buffer, (u32)p_uniform->idx, p_uniform->_buffer, (u32)p_uniform->len);
-    SDL_PushGPUFragmentUniformData(p_instance->graphics.sdl3.command_buffer, (u32)p_uniform->idx, p_uniform->_buffer, (u32)p_uniform->len);
+    command_push_uniform((u32)p_uniform->idx, p_uniform->_buffer, (size_t)p_uniform->len);
 
     // success
     return 1;
@@ -1,6 +1,17 @@
 // header file
 #include <aabb.h>
 
+// simd kernels. the instruction set follows the linear kernels
+#ifndef G10_LINEAR_SCALAR
+
+    // x86. sse2 is the x86-64 baseline, avx2 is detected at run time
+    #if defined(__SSE2__)
+        #include <immintrin.h>
+        #define AABB_HAS_SSE
+        #define AABB_HAS_AVX2
+    #endif
+#endif
+
 // function definitions
 int aabb_from_bounds ( aabb *p_aabb, vec3 min, vec3 max )
 {
@@ -21,83 +32,58 @@ int aabb_from_bounds ( aabb *p_aabb, vec3 min, vec3 max )
     no_aabb: return 0;
 }
 
-int aabb_from_transform ( aabb *p_aabb, transform *p_transform )
+int aabb_transform ( aabb *p_result, const aabb *p_aabb, mat4 m )
 {
 
     // error check
+    if ( NULL == p_result ) goto no_result;
     if ( NULL == p_aabb ) goto no_aabb;
-    if ( NULL == p_transform ) goto no_transform;
 
-    // computed data
-    mat4 world_matrix = { 0 };
+    // initialized data
+    vec3 c = { ( p_aabb->_max.x + p_aabb->_min.x ) * 0.5f, ( p_aabb->_max.y + p_aabb->_min.y ) * 0.5f, ( p_aabb->_max.z + p_aabb->_min.z ) * 0.5f },
+         e = { ( p_aabb->_max.x - p_aabb->_min.x ) * 0.5f, ( p_aabb->_max.y - p_aabb->_min.y ) * 0.5f, ( p_aabb->_max.z - p_aabb->_min.z ) * 0.5f };
 
-    // identity
-    mat4_identity(&world_matrix);
+    // the centre is a point
+    mat4_mul_point(&c, m, c);
 
-    // traverse parent hierarchy
-    // use a fixed stack to avoid dynamic allocation
-    transform *stack[64] = { 0 };
-    int top = 0;
-    transform *curr = p_transform;
-    
-    // push transforms onto stack
-    while ( curr && top < 64 ) 
+    // each half extent is the reach of the box along that axis
+    e = (vec3)
     {
-        stack[top++] = curr;
-        curr = curr->p_parent;
-    }
+        .x = fabsf(m.a) * e.x + fabsf(m.e) * e.y + fabsf(m.i) * e.z,
+        .y = fabsf(m.b) * e.x + fabsf(m.f) * e.y + fabsf(m.j) * e.z,
+        .z = fabsf(m.c) * e.x + fabsf(m.g) * e.y + fabsf(m.k) * e.z
+    };
 
-    // multiply matrices from root to leaf
-    while ( top > 0 ) 
-    {
-        transform *t = stack[--top];
-        mat4 temp = { 0 };
+    // store the result
+    p_result->_min = (vec3) { c.x - e.x, c.y - e.y, c.z - e.z },
+    p_result->_max = (vec3) { c.x + e.x, c.y + e.y, c.z + e.z };
 
-        // world = world * local
-        mat4_mul_mat4(&temp, world_matrix, t->model);
-        world_matrix = temp;
-    }
+    // success
+    return 1;
 
-    // define unit cube corners [-1, 1]
-    vec3 corners[8] = 
-    {
-        { -1.0f, -1.0f, -1.0f }, { 1.0f, -1.0f, -1.0f },
-        { -1.0f,  1.0f, -1.0f }, { 1.0f,  1.0f, -1.0f },
-        { -1.0f, -1.0f,  1.0f }, { 1.0f, -1.0f,  1.0f },
-        { -1.0f,  1.0f,  1.0f }, { 1.0f,  1.0f,  1.0f }
-    };
+    no_result:
+    no_aabb:
+        return 0;
+}
 
-    vec3 min_bounds = { 0 };
-    vec3 max_bounds = { 0 };
+int aabb_from_transform ( aabb *p_aabb, transform *p_transform )
+{
 
-    // transform first corner to initialize min/max
-    {
-        vec4 v4_in = { corners[0].x, corners[0].y, corners[0].z, 1.0f };
-        vec4 v4_out = { 0 };
-        mat4_mul_vec4(&v4_out, world_matrix, v4_in);
-        min_bounds = (vec3){ v4_out.x, v4_out.y, v4_out.z };
-        max_bounds = min_bounds;
-    }
+    // error check
+    if ( NULL == p_aabb ) goto no_aabb;
+    if ( NULL == p_transform ) goto no_transform;
 
-    // transform remaining corners
-    for ( int i = 1; i < 8; ++i )
-    {
-        vec4 v4_in = { corners[i].x, corners[i].y, corners[i].z, 1.0f };
-        vec4 v4_out = { 0 };
-        mat4_mul_vec4(&v4_out, world_matrix, v4_in);
-        
-        if ( v4_out.x < min_bounds.x ) min_bounds.x = v4_out.x;
-        if ( v4_out.y < min_bounds.y ) min_bounds.y = v4_out.y;
-        if ( v4_out.z < min_bounds.z ) min_bounds.z = v4_out.z;
+    // computed data
+    mat4 world_matrix = { 0 };
 
-        if ( v4_out.x > max_bounds.x ) max_bounds.x = v4_out.x;
-        if ( v4_out.y > max_bounds.y ) max_bounds.y = v4_out.y;
-        if ( v4_out.z > max_bounds.z ) max_bounds.z = v4_out.z;
-    }
+    // the world matrix, cached by the hierarchy when it is clean
+    transform_get_matrix_world(p_transform, &world_matrix);
 
-    // populate the struct
-    p_aabb->_min = min_bounds;
-    p_aabb->_max = max_bounds;
+    // the unit cube [-1, 1]
+    aabb unit = { ._min = { -1.0f, -1.0f, -1.0f }, ._max = { 1.0f, 1.0f, 1.0f } };
+
+    // transform the cube
+    aabb_transform(p_aabb, &unit, world_matrix);
 
     // done
     return 1;
@@ -126,10 +112,8 @@ int aabb_bind ( render_pass *p_render_pass, pipeline *p_pipeline, aabb *p_aabb )
 int aabb_draw ( render_pass *p_render_pass, pipeline *p_pipeline, aabb *p_aabb )
 {
 
-    // initialized data
-    g_instance *p_instance = g_active_instance();
-
-    SDL_DrawGPUPrimitives(p_render_pass->p_handle, 8, 1, 0, 0);
+    // draw the box
+    command_draw(p_render_pass, 8, 1);
     
     // success
     return 1;
@@ -201,3 +185,503 @@ int aabb_cull_frustum ( const aabb *p_aabb, const vec4 planes[6] )
 
     return 0; // Inside or intersecting
 }
+
+int aabb_cull_frustum_masked ( const aabb *p_aabb, const vec4 planes[6], u8 *p_mask, u8 *p_hint, size_t *p_tested )
+{
+    if ( !p_aabb || !planes || !p_mask || !p_hint ) return 0;
+
+    u8 mask = *p_mask;
+
+    for ( int k = 0; k < 6; k++ )
+    {
+
+        // start with the plane that culled last time
+        int i = ( *p_hint + k ) % 6;
+
+        if ( 0 == ( mask & ( 1 << i ) ) ) continue;
+
+        // the vertex furthest along the normal
+        float px = planes[i].x > 0.0f ? p_aabb->_max.x : p_aabb->_min.x;
+        float py = planes[i].y > 0.0f ? p_aabb->_max.y : p_aabb->_min.y;
+        float pz = planes[i].z > 0.0f ? p_aabb->_max.z : p_aabb->_min.z;
+
+        // the vertex nearest along the normal
+        float nx = planes[i].x > 0.0f ? p_aabb->_min.x : p_aabb->_max.x;
+        float ny = planes[i].y > 0.0f ? p_aabb->_min.y : p_aabb->_max.y;
+        float nz = planes[i].z > 0.0f ? p_aabb->_min.z : p_aabb->_max.z;
+
+        if ( p_tested ) (*p_tested)++;
+
+        if ( planes[i].x * px + planes[i].y * py + planes[i].z * pz + planes[i].w < 0.0f )
+        {
+            *p_hint = (u8) i;
+            return 1; // Outside the frustum
+        }
+
+        // fully inside this plane, so the children need not test it
+        if ( planes[i].x * nx + planes[i].y * ny + planes[i].z * nz + planes[i].w >= 0.0f )
+            mask &= (u8) ~( 1 << i );
+    }
+
+    *p_mask = mask;
+
+    return 0; // Inside or intersecting
+}
+
+int aabb_soa_set ( aabb_soa soa, size_t index, const aabb *p_aabb )
+{
+
+    // error check
+    if ( NULL == p_aabb ) return 0;
+
+    // centre and half extents
+    soa.p_cx[index] = ( p_aabb->_max.x + p_aabb->_min.x ) * 0.5f,
+    soa.p_cy[index] = ( p_aabb->_max.y + p_aabb->_min.y ) * 0.5f,
+    soa.p_cz[index] = ( p_aabb->_max.z + p_aabb->_min.z ) * 0.5f,
+    soa.p_ex[index] = ( p_aabb->_max.x - p_aabb->_min.x ) * 0.5f,
+    soa.p_ey[index] = ( p_aabb->_max.y - p_aabb->_min.y ) * 0.5f,
+    soa.p_ez[index] = ( p_aabb->_max.z - p_aabb->_min.z ) * 0.5f;
+
+    // success
+    return 1;
+}
+
+int aabb_soa_get ( aabb *p_aabb, aabb_soa soa, size_t index )
+{
+
+    // error check
+    if ( NULL == p_aabb ) return 0;
+
+    // min and max
+    p_aabb->_min = (vec3) { soa.p_cx[index] - soa.p_ex[index], soa.p_cy[index] - soa.p_ey[index], soa.p_cz[index] - soa.p_ez[index] },
+    p_aabb->_max = (vec3) { soa.p_cx[index] + soa.p_ex[index], soa.p_cy[index] + soa.p_ey[index], soa.p_cz[index] + soa.p_ez[index] };
+
+    // success
+    return 1;
+}
+
+// kernels
+/// scalar. the simd kernels finish with these
+static u0 aabb_transform_range ( aabb_soa *p_result, const mat4 *p_m, const aabb_soa *p_boxes, size_t i, size_t count )
+{
+    for (; i < count; i++)
+    {
+
+        // initialized data
+        const mat4 *m = &p_m[i];
+        float cx = p_boxes->p_cx[i], cy = p_boxes->p_cy[i], cz = p_boxes->p_cz[i],
+              ex = p_boxes->p_ex[i], ey = p_boxes->p_ey[i], ez = p_boxes->p_ez[i];
+
+        // the centre is a point
+        p_result->p_cx[i] = m->a * cx + m->e * cy + m->i * cz + m->m,
+        p_result->p_cy[i] = m->b * cx + m->f * cy + m->j * cz + m->n,
+        p_result->p_cz[i] = m->c * cx + m->g * cy + m->k * cz + m->o;
+
+        // the half extents go through the absolute value of the 3x3
+        p_result->p_ex[i] = fabsf(m->a) * ex + fabsf(m->e) * ey + fabsf(m->i) * ez,
+        p_result->p_ey[i] = fabsf(m->b) * ex + fabsf(m->f) * ey + fabsf(m->j) * ez,
+        p_result->p_ez[i] = fabsf(m->c) * ex + fabsf(m->g) * ey + fabsf(m->k) * ez;
+    }
+}
+
+static size_t aabb_cull_frustum_range ( u8 *p_result, const vec4 planes[6], const aabb_soa *p_boxes, size_t i, size_t count )
+{
+
+    // initialized data
+    size_t culled = 0;
+
+    for (; i < count; i++)
+    {
+
+        // initialized data
+        u8 outside = 0;
+
+        // the box is outside if its furthest point along a normal is behind the plane
+        for (size_t j = 0; j < 6 && 0 == outside; j++)
+            outside = ( planes[j].x * p_boxes->p_cx[i] + planes[j].y * p_boxes->p_cy[i] + planes[j].z * p_boxes->p_cz[i] + planes[j].w +
+                        fabsf(planes[j].x) * p_boxes->p_ex[i] + fabsf(planes[j].y) * p_boxes->p_ey[i] + fabsf(planes[j].z) * p_boxes->p_ez[i] ) < 0.0f;
+
+        // store the result
+        p_result[i] = outside,
+        culled     += outside;
+    }
+
+    // done
+    return culled;
+}
+
+static size_t aabb_overlap_range ( u8 *p_result, const aabb_soa *p_query, const aabb_soa *p_boxes, size_t i, size_t count )
+{
+
+    // initialized data
+    size_t overlapping = 0;
+
+    for (; i < count; i++)
+    {
+
+        // the boxes overlap if their centres are closer than their extents on every axis
+        u8 overlap = fabsf(p_boxes->p_cx[i] - *p_query->p_cx) <= p_boxes->p_ex[i] + *p_query->p_ex &&
+                     fabsf(p_boxes->p_cy[i] - *p_query->p_cy) <= p_boxes->p_ey[i] + *p_query->p_ey &&
+                     fabsf(p_boxes->p_cz[i] - *p_query->p_cz) <= p_boxes->p_ez[i] + *p_query->p_ez;
+
+        // store the result
+        p_result[i]  = overlap,
+        overlapping += overlap;
+    }
+
+    // done
+    return overlapping;
+}
+
+/// sse
+#ifdef AABB_HAS_SSE
+
+// the x, y, and z of column k of four matrices, one matrix per lane
+static inline u0 aabb_sse_column ( const mat4 *p_m, size_t k, __m128 *p_x, __m128 *p_y, __m128 *p_z )
+{
+
+    // initialized data
+    __m128 r0 = _mm_loadu_ps(&p_m[0].a + 4 * k),
+           r1 = _mm_loadu_ps(&p_m[1].a + 4 * k),
+           r2 = _mm_loadu_ps(&p_m[2].a + 4 * k),
+           r3 = _mm_loadu_ps(&p_m[3].a + 4 * k);
+
+    // transpose
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+    // w is always 0 or 1
+    *p_x = r0, *p_y = r1, *p_z = r2;
+}
+
+static u0 aabb_transform_sse ( aabb_soa *p_result, const mat4 *p_m, const aabb_soa *p_boxes, size_t count )
+{
+
+    // initialized data
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    size_t i = 0;
+
+    // four boxes at a time
+    for (; i + 4 <= count; i += 4)
+    {
+
+        // initialized data
+        __m128 a, b, c, e, f, g, m_i, j, k, m, n, o;
+        __m128 cx = _mm_loadu_ps(p_boxes->p_cx + i), cy = _mm_loadu_ps(p_boxes->p_cy + i), cz = _mm_loadu_ps(p_boxes->p_cz + i),
+               ex = _mm_loadu_ps(p_boxes->p_ex + i), ey = _mm_loadu_ps(p_boxes->p_ey + i), ez = _mm_loadu_ps(p_boxes->p_ez + i);
+
+        // the columns of each matrix
+        aabb_sse_column(p_m + i, 0, &a, &b, &c);
+        aabb_sse_column(p_m + i, 1, &e, &f, &g);
+        aabb_sse_column(p_m + i, 2, &m_i, &j, &k);
+        aabb_sse_column(p_m + i, 3, &m, &n, &o);
+
+        // the centre is a point
+        _mm_storeu_ps(p_result->p_cx + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, cx), _mm_mul_ps(e, cy)), _mm_add_ps(_mm_mul_ps(m_i, cz), m)));
+        _mm_storeu_ps(p_result->p_cy + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(b, cx), _mm_mul_ps(f, cy)), _mm_add_ps(_mm_mul_ps(j  , cz), n)));
+        _mm_storeu_ps(p_result->p_cz + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(c, cx), _mm_mul_ps(g, cy)), _mm_add_ps(_mm_mul_ps(k  , cz), o)));
+
+        // the half extents go through the absolute value of the 3x3
+        a = _mm_andnot_ps(sign, a), e = _mm_andnot_ps(sign, e), m_i = _mm_andnot_ps(sign, m_i),
+        b = _mm_andnot_ps(sign, b), f = _mm_andnot_ps(sign, f), j   = _mm_andnot_ps(sign, j),
+        c = _mm_andnot_ps(sign, c), g = _mm_andnot_ps(sign, g), k   = _mm_andnot_ps(sign, k);
+
+        _mm_storeu_ps(p_result->p_ex + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, ex), _mm_mul_ps(e, ey)), _mm_mul_ps(m_i, ez)));
+        _mm_storeu_ps(p_result->p_ey + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(b, ex), _mm_mul_ps(f, ey)), _mm_mul_ps(j  , ez)));
+        _mm_storeu_ps(p_result->p_ez + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(c, ex), _mm_mul_ps(g, ey)), _mm_mul_ps(k  , ez)));
+    }
+
+    // the rest
+    aabb_transform_range(p_result, p_m, p_boxes, i, count);
+}
+
+static size_t aabb_cull_frustum_sse ( u8 *p_result, const vec4 planes[6], const aabb_soa *p_boxes, size_t count )
+{
+
+    // initialized data
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    size_t i = 0, culled = 0;
+
+    // four boxes at a time
+    for (; i + 4 <= count; i += 4)
+    {
+
+        // initialized data
+        __m128 cx = _mm_loadu_ps(p_boxes->p_cx + i), cy = _mm_loadu_ps(p_boxes->p_cy + i), cz = _mm_loadu_ps(p_boxes->p_cz + i),
+               ex = _mm_loadu_ps(p_boxes->p_ex + i), ey = _mm_loadu_ps(p_boxes->p_ey + i), ez = _mm_loadu_ps(p_boxes->p_ez + i),
+               outside = _mm_setzero_ps();
+        int bits = 0;
+
+        // each plane
+        for (size_t j = 0; j < 6; j++)
+        {
+
+            // initialized data
+            __m128 nx = _mm_set1_ps(planes[j].x), ny = _mm_set1_ps(planes[j].y), nz = _mm_set1_ps(planes[j].z),
+                   d  = _mm_add_ps(_mm_mul_ps(nx, cx), _mm_set1_ps(planes[j].w));
+
+            // signed distance of the centre, plus the reach of the box toward the normal
+            d = _mm_add_ps(d, _mm_add_ps(_mm_mul_ps(ny, cy), _mm_mul_ps(nz, cz)));
+            d = _mm_add_ps(d, _mm_mul_ps(_mm_andnot_ps(sign, nx), ex));
+            d = _mm_add_ps(d, _mm_add_ps(_mm_mul_ps(_mm_andnot_ps(sign, ny), ey), _mm_mul_ps(_mm_andnot_ps(sign, nz), ez)));
+
+            // behind the plane
+            outside = _mm_or_ps(outside, _mm_cmplt_ps(d, _mm_setzero_ps()));
+
+            // every box is already outside
+            if ( 0xf == _mm_movemask_ps(outside) ) break;
+        }
+
+        // store the results
+        bits = _mm_movemask_ps(outside);
+
+        for (size_t j = 0; j < 4; j++) p_result[i + j] = (u8) ( ( bits >> j ) & 1 );
+
+        culled += (size_t) __builtin_popcount(bits);
+    }
+
+    // the rest
+    return culled + aabb_cull_frustum_range(p_result, planes, p_boxes, i, count);
+}
+
+static size_t aabb_overlap_sse ( u8 *p_result, const aabb_soa *p_query, const aabb_soa *p_boxes, size_t count )
+{
+
+    // initialized data
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    __m128 qcx = _mm_set1_ps(*p_query->p_cx), qcy = _mm_set1_ps(*p_query->p_cy), qcz = _mm_set1_ps(*p_query->p_cz),
+           qex = _mm_set1_ps(*p_query->p_ex), qey = _mm_set1_ps(*p_query->p_ey), qez = _mm_set1_ps(*p_query->p_ez);
+    size_t i = 0, overlapping = 0;
+
+    // four boxes at a time
+    for (; i + 4 <= count; i += 4)
+    {
+
+        // the boxes overlap if their centres are closer than their extents on every axis
+        __m128 x = _mm_cmple_ps(_mm_andnot_ps(sign, _mm_sub_ps(_mm_loadu_ps(p_boxes->p_cx + i), qcx)), _mm_add_ps(_mm_loadu_ps(p_boxes->p_ex + i), qex)),
+               y = _mm_cmple_ps(_mm_andnot_ps(sign, _mm_sub_ps(_mm_loadu_ps(p_boxes->p_cy + i), qcy)), _mm_add_ps(_mm_loadu_ps(p_boxes->p_ey + i), qey)),
+               z = _mm_cmple_ps(_mm_andnot_ps(sign, _mm_sub_ps(_mm_loadu_ps(p_boxes->p_cz + i), qcz)), _mm_add_ps(_mm_loadu_ps(p_boxes->p_ez + i), qez));
+        int bits = _mm_movemask_ps(_mm_and_ps(_mm_and_ps(x, y), z));
+
+        // store the results
+        for (size_t j = 0; j < 4; j++) p_result[i + j] = (u8) ( ( bits >> j ) & 1 );
+
+        overlapping += (size_t) __builtin_popcount(bits);
+    }
+
+    // the rest
+    return overlapping + aabb_overlap_range(p_result, p_query, p_boxes, i, count);
+}
+#endif
+
+/// avx2
+#ifdef AABB_HAS_AVX2
+
+// the x, y, and z of column k of eight matrices, one matrix per lane
+__attribute__((target("avx2,fma")))
+static inline u0 aabb_avx2_column ( const mat4 *p_m, size_t k, __m256 *p_x, __m256 *p_y, __m256 *p_z )
+{
+
+    // initialized data
+    __m128 lx, ly, lz, hx, hy, hz;
+
+    // two groups of four
+    aabb_sse_column(p_m    , k, &lx, &ly, &lz);
+    aabb_sse_column(p_m + 4, k, &hx, &hy, &hz);
+
+    // join the groups
+    *p_x = _mm256_insertf128_ps(_mm256_castps128_ps256(lx), hx, 1),
+    *p_y = _mm256_insertf128_ps(_mm256_castps128_ps256(ly), hy, 1),
+    *p_z = _mm256_insertf128_ps(_mm256_castps128_ps256(lz), hz, 1);
+}
+
+__attribute__((target("avx2,fma")))
+static u0 aabb_transform_avx2 ( aabb_soa *p_result, const mat4 *p_m, const aabb_soa *p_boxes, size_t count )
+{
+
+    // initialized data
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+    size_t i = 0;
+
+    // eight boxes at a time
+    for (; i + 8 <= count; i += 8)
+    {
+
+        // initialized data
+        __m256 a, b, c, e, f, g, m_i, j, k, m, n, o;
+        __m256 cx = _mm256_loadu_ps(p_boxes->p_cx + i), cy = _mm256_loadu_ps(p_boxes->p_cy + i), cz = _mm256_loadu_ps(p_boxes->p_cz + i),
+               ex = _mm256_loadu_ps(p_boxes->p_ex + i), ey = _mm256_loadu_ps(p_boxes->p_ey + i), ez = _mm256_loadu_ps(p_boxes->p_ez + i);
+
+        // the columns of each matrix
+        aabb_avx2_column(p_m + i, 0, &a, &b, &c);
+        aabb_avx2_column(p_m + i, 1, &e, &f, &g);
+        aabb_avx2_column(p_m + i, 2, &m_i, &j, &k);
+        aabb_avx2_column(p_m + i, 3, &m, &n, &o);
+
+        // the centre is a point
+        _mm256_storeu_ps(p_result->p_cx + i, _mm256_fmadd_ps(a, cx, _mm256_fmadd_ps(e, cy, _mm256_fmadd_ps(m_i, cz, m))));
+        _mm256_storeu_ps(p_result->p_cy + i, _mm256_fmadd_ps(b, cx, _mm256_fmadd_ps(f, cy, _mm256_fmadd_ps(j  , cz, n))));
+        _mm256_storeu_ps(p_result->p_cz + i, _mm256_fmadd_ps(c, cx, _mm256_fmadd_ps(g, cy, _mm256_fmadd_ps(k  , cz, o))));
+
+        // the half extents go through the absolute value of the 3x3
+        _mm256_storeu_ps(p_result->p_ex + i, _mm256_fmadd_ps(_mm256_andnot_ps(sign, a), ex, _mm256_fmadd_ps(_mm256_andnot_ps(sign, e), ey, _mm256_mul_ps(_mm256_andnot_ps(sign, m_i), ez))));
+        _mm256_storeu_ps(p_result->p_ey + i, _mm256_fmadd_ps(_mm256_andnot_ps(sign, b), ex, _mm256_fmadd_ps(_mm256_andnot_ps(sign, f), ey, _mm256_mul_ps(_mm256_andnot_ps(sign, j  ), ez))));
+        _mm256_storeu_ps(p_result->p_ez + i, _mm256_fmadd_ps(_mm256_andnot_ps(sign, c), ex, _mm256_fmadd_ps(_mm256_andnot_ps(sign, g), ey, _mm256_mul_ps(_mm256_andnot_ps(sign, k  ), ez))));
+    }
+
+    // the rest
+    aabb_transform_range(p_result, p_m, p_boxes, i, count);
+}
+
+__attribute__((target("avx2,fma")))
+static size_t aabb_cull_frustum_avx2 ( u8 *p_result, const vec4 planes[6], const aabb_soa *p_boxes, size_t count )
+{
+
+    // initialized data
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+    size_t i = 0, culled = 0;
+
+    // eight boxes at a time
+    for (; i + 8 <= count; i += 8)
+    {
+
+        // initialized data
+        __m256 cx = _mm256_loadu_ps(p_boxes->p_cx + i), cy = _mm256_loadu_ps(p_boxes->p_cy + i), cz = _mm256_loadu_ps(p_boxes->p_cz + i),
+               ex = _mm256_loadu_ps(p_boxes->p_ex + i), ey = _mm256_loadu_ps(p_boxes->p_ey + i), ez = _mm256_loadu_ps(p_boxes->p_ez + i),
+               outside = _mm256_setzero_ps();
+        int bits = 0;
+
+        // each plane
+        for (size_t j = 0; j < 6; j++)
+        {
+
+            // initialized data
+            __m256 nx = _mm256_set1_ps(planes[j].x), ny = _mm256_set1_ps(planes[j].y), nz = _mm256_set1_ps(planes[j].z),
+                   d  = _mm256_fmadd_ps(nx, cx, _mm256_set1_ps(planes[j].w));
+
+            // signed distance of the centre, plus the reach of the box toward the normal
+            d = _mm256_fmadd_ps(ny, cy, d);
+            d = _mm256_fmadd_ps(nz, cz, d);
+            d = _mm256_fmadd_ps(_mm256_andnot_ps(sign, nx), ex, d);
+            d = _mm256_fmadd_ps(_mm256_andnot_ps(sign, ny), ey, d);
+            d = _mm256_fmadd_ps(_mm256_andnot_ps(sign, nz), ez, d);
+
+            // behind the plane
+            outside = _mm256_or_ps(outside, _mm256_cmp_ps(d, _mm256_setzero_ps(), _CMP_LT_OQ));
+
+            // every box is already outside
+            if ( 0xff == _mm256_movemask_ps(outside) ) break;
+        }
+
+        // store the results
+        bits = _mm256_movemask_ps(outside);
+
+        for (size_t j = 0; j < 8; j++) p_result[i + j] = (u8) ( ( bits >> j ) & 1 );
+
+        culled += (size_t) __builtin_popcount(bits);
+    }
+
+    // the rest
+    return culled + aabb_cull_frustum_range(p_result, planes, p_boxes, i, count);
+}
+
+__attribute__((target("avx2,fma")))
+static size_t aabb_overlap_avx2 ( u8 *p_result, const aabb_soa *p_query, const aabb_soa *p_boxes, size_t count )
+{
+
+    // initialized data
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+    __m256 qcx = _mm256_set1_ps(*p_query->p_cx), qcy = _mm256_set1_ps(*p_query->p_cy), qcz = _mm256_set1_ps(*p_query->p_cz),
+           qex = _mm256_set1_ps(*p_query->p_ex), qey = _mm256_set1_ps(*p_query->p_ey), qez = _mm256_set1_ps(*p_query->p_ez);
+    size_t i = 0, overlapping = 0;
+
+    // eight boxes at a time
+    for (; i + 8 <= count; i += 8)
+    {
+
+        // the boxes overlap if their centres are closer than their extents on every axis
+        __m256 x = _mm256_cmp_ps(_mm256_andnot_ps(sign, _mm256_sub_ps(_mm256_loadu_ps(p_boxes->p_cx + i), qcx)), _mm256_add_ps(_mm256_loadu_ps(p_boxes->p_ex + i), qex), _CMP_LE_OQ),
+               y = _mm256_cmp_ps(_mm256_andnot_ps(sign, _mm256_sub_ps(_mm256_loadu_ps(p_boxes->p_cy + i), qcy)), _mm256_add_ps(_mm256_loadu_ps(p_boxes->p_ey + i), qey), _CMP_LE_OQ),
+               z = _mm256_cmp_ps(_mm256_andnot_ps(sign, _mm256_sub_ps(_mm256_loadu_ps(p_boxes->p_cz + i), qcz)), _mm256_add_ps(_mm256_loadu_ps(p_boxes->p_ez + i), qez), _CMP_LE_OQ);
+        int bits = _mm256_movemask_ps(_mm256_and_ps(_mm256_and_ps(x, y), z));
+
+        // store the results
+        for (size_t j = 0; j < 8; j++) p_result[i + j] = (u8) ( ( bits >> j ) & 1 );
+
+        overlapping += (size_t) __builtin_popcount(bits);
+    }
+
+    // the rest
+    return overlapping + aabb_overlap_range(p_result, p_query, p_boxes, i, count);
+}
+#endif
+
+// batches
+u0 aabb_transform_batch ( aabb_soa *p_result, const mat4 *p_m, aabb_soa boxes, size_t count )
+{
+
+    // error check
+    if ( NULL == p_result || NULL == p_m ) return;
+
+    // use the widest kernel the linear kernels use
+    switch ( linear_isa_get() )
+    {
+        #ifdef AABB_HAS_AVX2
+        case LINEAR_ISA_AVX2: aabb_transform_avx2(p_result, p_m, &boxes, count); return;
+        #endif
+
+        #ifdef AABB_HAS_SSE
+        case LINEAR_ISA_SSE: aabb_transform_sse(p_result, p_m, &boxes, count); return;
+        #endif
+
+        default: aabb_transform_range(p_result, p_m, &boxes, 0, count); return;
+    }
+}
+
+size_t aabb_cull_frustum_batch ( u8 *p_result, const vec4 planes[6], aabb_soa boxes, size_t count )
+{
+
+    // error check
+    if ( NULL == p_result || NULL == planes ) return 0;
+
+    // use the widest kernel the linear kernels use
+    switch ( linear_isa_get() )
+    {
+        #ifdef AABB_HAS_AVX2
+        case LINEAR_ISA_AVX2: return aabb_cull_frustum_avx2(p_result, planes, &boxes, count);
+        #endif
+
+        #ifdef AABB_HAS_SSE
+        case LINEAR_ISA_SSE: return aabb_cull_frustum_sse(p_result, planes, &boxes, count);
+        #endif
+
+        default: return aabb_cull_frustum_range(p_result, planes, &boxes, 0, count);
+    }
+}
+
+size_t aabb_overlap_batch ( u8 *p_result, const aabb *p_aabb, aabb_soa boxes, size_t count )
+{
+
+    // error check
+    if ( NULL == p_result || NULL == p_aabb ) return 0;
+
+    // initialized data
+    float query[6] = { 0 };
+    aabb_soa _query = { &query[0], &query[1], &query[2], &query[3], &query[4], &query[5] };
+
+    // the query as a centre and half extents
+    aabb_soa_set(_query, 0, p_aabb);
+
+    // use the widest kernel the linear kernels use
+    switch ( linear_isa_get() )
+    {
+        #ifdef AABB_HAS_AVX2
+        case LINEAR_ISA_AVX2: return aabb_overlap_avx2(p_result, &_query, &boxes, count);
+        #endif
+
+        #ifdef AABB_HAS_SSE
+        case LINEAR_ISA_SSE: return aabb_overlap_sse(p_result, &_query, &boxes, count);
+        #endif
+
+        default: return aabb_overlap_range(p_result, &_query, &boxes, 0, count);
+    }
+}
@@ -4,6 +4,8 @@
 #include <entity.h>
 #include <scene.h>
 #include <float.h>
+#include <stdlib.h>
+#include <string.h>
 
 // forward declarations for BVH adapters
 static int bvh_intersect_adapter ( bv *p_a, bv *p_b );
@@ -97,32 +99,11 @@ static int bvh_cull_adapter ( bv *p_bv, const vec4 planes[6] )
 static int bvh_bounds_adapter ( bv *p_bv, vec3 *p_min, vec3 *p_max )
 {
     if ( !p_bv || !p_min || !p_max ) return 0;
-    
-    vec3 min = {  FLT_MAX,  FLT_MAX,  FLT_MAX };
-    vec3 max = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
-    int has_bounds = 0;
-
-    for ( int i = 0; i < 4; i++ ) {
-        if ( p_bv->p_data[i] ) {
-            vec3 child_min, child_max;
-            if ( bv_bounds((bv *)p_bv->p_data[i], &child_min, &child_max) ) {
-                if ( child_min.x < min.x ) min.x = child_min.x;
-                if ( child_min.y < min.y ) min.y = child_min.y;
-                if ( child_min.z < min.z ) min.z = child_min.z;
-                if ( child_max.x > max.x ) max.x = child_max.x;
-                if ( child_max.y > max.y ) max.y = child_max.y;
-                if ( child_max.z > max.z ) max.z = child_max.z;
-                has_bounds = 1;
-            }
-        }
-    }
 
-    if ( has_bounds ) {
-        *p_min = min;
-        *p_max = max;
-        return 1;
-    }
-    return 0;
+    // interior nodes cache the union of their children
+    *p_min = p_bv->_min;
+    *p_max = p_bv->_max;
+    return 1;
 }
 
 static int bvh_info_adapter ( bv *p_bv )
@@ -207,6 +188,13 @@ int bv_bounds ( bv *p_bv, vec3 *p_min, vec3 *p_max )
     return 0;
 }
 
+int bv_resize ( bv *p_bv )
+{
+    if ( p_bv && p_bv->pfn_resize )
+        return p_bv->pfn_resize(p_bv);
+    return 0;
+}
+
 int bv_cull ( bv *p_bv, const vec4 planes[6] )
 {
     if ( p_bv && p_bv->pfn_cull )
@@ -235,6 +223,7 @@ int bv_from_entity ( bv **pp_bv, entity *p_entity )
     bv_from_aabb(pp_bv, p_aabb);
     if (*pp_bv) {
         (*pp_bv)->p_user_data = p_entity;
+        (*pp_bv)->pfn_resize  = bv_entity_resize;
     }
     return 1;
 }
@@ -264,56 +253,502 @@ int bv_from_scene ( bv **pp_bv, scene *p_scene )
 
     default_allocator(entities, 0);
 
-    if ( child_count == 0 ) {
-        default_allocator(children, 0);
-        return 0;
-    }
+    int result = bv_from_leaves(pp_bv, children, child_count, p_scene->bvh_build);
+
+    default_allocator(children, 0);
+
+    return result;
+}
+
+// builder
+#define BV_BUILD_BINS 12
+#define BV_MORTON_BITS 10
+
+typedef struct
+{
+    vec3 min, max, centroid;
+    u32  morton;
+    bv  *p_leaf,
+        *p_parent; // the parent of the leaf before the build, restored if it fails
+} bv_build_item;
+
+typedef size_t (fn_bv_split)( bv_build_item *p_items, size_t count );
+
+static float bv_surface_area ( vec3 min, vec3 max )
+{
+    float dx = max.x - min.x,
+          dy = max.y - min.y,
+          dz = max.z - min.z;
+
+    if ( dx < 0.0f || dy < 0.0f || dz < 0.0f ) return 0.0f;
+
+    return 2.0f * ( dx * dy + dy * dz + dz * dx );
+}
+
+static void bv_grow ( vec3 *p_min, vec3 *p_max, vec3 min, vec3 max )
+{
+    if ( min.x < p_min->x ) p_min->x = min.x;
+    if ( min.y < p_min->y ) p_min->y = min.y;
+    if ( min.z < p_min->z ) p_min->z = min.z;
+    if ( max.x > p_max->x ) p_max->x = max.x;
+    if ( max.y > p_max->y ) p_max->y = max.y;
+    if ( max.z > p_max->z ) p_max->z = max.z;
+}
+
+static float bv_axis ( vec3 v, int axis )
+{
+    return ( axis == 0 ) ? v.x : ( axis == 1 ) ? v.y : v.z;
+}
 
-    size_t current_count = child_count;
-    bv **current_level = children;
+static size_t bv_split_sah ( bv_build_item *p_items, size_t count )
+{
+
+    // initialized data
+    vec3 c_min = {  FLT_MAX,  FLT_MAX,  FLT_MAX },
+         c_max = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+    float best_cost = FLT_MAX;
+    int best_axis = -1, best_bin = 0;
+
+    // bound the centroids
+    for ( size_t i = 0; i < count; i++ )
+        bv_grow(&c_min, &c_max, p_items[i].centroid, p_items[i].centroid);
 
-    while ( current_count > 1 )
+    // evaluate each axis
+    for ( int axis = 0; axis < 3; axis++ )
     {
-        size_t next_count = (current_count + 3) / 4;
-        bv **next_level = default_allocator(0, next_count * sizeof(bv *));
-        
-        for ( size_t i = 0; i < next_count; i++ )
+
+        // initialized data
+        float lo = bv_axis(c_min, axis),
+              extent = bv_axis(c_max, axis) - lo;
+        struct { vec3 min, max; size_t count; } bins[BV_BUILD_BINS];
+        float right_area[BV_BUILD_BINS];
+        size_t right_count[BV_BUILD_BINS];
+
+        // degenerate axis
+        if ( extent <= 0.0f ) continue;
+
+        for ( int b = 0; b < BV_BUILD_BINS; b++ )
+            bins[b].min = (vec3) {  FLT_MAX,  FLT_MAX,  FLT_MAX },
+            bins[b].max = (vec3) { -FLT_MAX, -FLT_MAX, -FLT_MAX },
+            bins[b].count = 0;
+
+        // populate the bins
+        for ( size_t i = 0; i < count; i++ )
         {
-            bv *p_node = default_allocator(0, sizeof(bv));
-            *p_node = (bv)
+            int b = (int) ( BV_BUILD_BINS * ( ( bv_axis(p_items[i].centroid, axis) - lo ) / extent ) );
+            if ( b >= BV_BUILD_BINS ) b = BV_BUILD_BINS - 1;
+
+            bv_grow(&bins[b].min, &bins[b].max, p_items[i].min, p_items[i].max);
+            bins[b].count++;
+        }
+
+        // sweep right to left
+        {
+            vec3 min = {  FLT_MAX,  FLT_MAX,  FLT_MAX },
+                 max = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+            size_t n = 0;
+
+            for ( int b = BV_BUILD_BINS - 1; b > 0; b-- )
             {
-                .p_data        = { 0, 0, 0, 0 },
-                .p_parent      = 0,
-                .p_user_data   = 0,
-                .pfn_bind      = bvh_bind_adapter,
-                .pfn_draw      = bvh_draw_adapter,
-                .pfn_info      = bvh_info_adapter,
-                .pfn_intersect = bvh_intersect_adapter,
-                .pfn_contains  = bvh_contains_adapter,
-                .pfn_bounds    = bvh_bounds_adapter,
-                .pfn_cull      = bvh_cull_adapter
-            };
-            
-            for ( size_t j = 0; j < 4; j++ )
+                if ( bins[b].count ) bv_grow(&min, &max, bins[b].min, bins[b].max);
+                n += bins[b].count;
+                right_area[b] = bv_surface_area(min, max);
+                right_count[b] = n;
+            }
+        }
+
+        // sweep left to right, evaluating each plane
+        {
+            vec3 min = {  FLT_MAX,  FLT_MAX,  FLT_MAX },
+                 max = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+            size_t n = 0;
+
+            for ( int b = 0; b < BV_BUILD_BINS - 1; b++ )
             {
-                size_t child_idx = i * 4 + j;
-                if ( child_idx < current_count )
-                {
-                    p_node->p_data[j] = current_level[child_idx];
-                    current_level[child_idx]->p_parent = p_node;
-                }
+                if ( bins[b].count ) bv_grow(&min, &max, bins[b].min, bins[b].max);
+                n += bins[b].count;
+
+                if ( n == 0 || right_count[b + 1] == 0 ) continue;
+
+                float cost = bv_surface_area(min, max) * (float) n + right_area[b + 1] * (float) right_count[b + 1];
+
+                if ( cost < best_cost ) best_cost = cost, best_axis = axis, best_bin = b;
+            }
+        }
+    }
+
+    // every centroid coincides
+    if ( best_axis == -1 ) return count / 2;
+
+    // partition about the best plane
+    {
+        float lo = bv_axis(c_min, best_axis),
+              extent = bv_axis(c_max, best_axis) - lo;
+        size_t mid = 0;
+
+        for ( size_t i = 0; i < count; i++ )
+        {
+            int b = (int) ( BV_BUILD_BINS * ( ( bv_axis(p_items[i].centroid, best_axis) - lo ) / extent ) );
+            if ( b >= BV_BUILD_BINS ) b = BV_BUILD_BINS - 1;
+
+            if ( b <= best_bin )
+            {
+                bv_build_item _tmp = p_items[mid];
+                p_items[mid] = p_items[i];
+                p_items[i] = _tmp;
+                mid++;
             }
-            next_level[i] = p_node;
         }
-        
-        default_allocator(current_level, 0);
-        current_level = next_level;
-        current_count = next_count;
+
+        if ( mid == 0 || mid == count ) return count / 2;
+
+        return mid;
     }
+}
+
+static size_t bv_split_lbvh ( bv_build_item *p_items, size_t count )
+{
+
+    // initialized data
+    u32 first = p_items[0].morton,
+        last  = p_items[count - 1].morton;
+
+    // identical codes
+    if ( first == last ) return count / 2;
+
+    // find the highest differing bit
+    u32 diff = first ^ last, bit = 0x80000000u;
+    while ( 0 == ( diff & bit ) ) bit >>= 1;
+
+    // binary search for the first code with that bit set
+    size_t lo = 0, hi = count - 1;
+    while ( lo + 1 < hi )
+    {
+        size_t mid = ( lo + hi ) / 2;
+        if ( p_items[mid].morton & bit ) hi = mid;
+        else lo = mid;
+    }
+
+    return hi;
+}
+
+static u32 bv_morton_expand ( u32 v )
+{
+    v = ( v * 0x00010001u ) & 0xFF0000FFu;
+    v = ( v * 0x00000101u ) & 0x0F00F00Fu;
+    v = ( v * 0x00000011u ) & 0xC30C30C3u;
+    v = ( v * 0x00000005u ) & 0x49249249u;
+    return v;
+}
+
+static u32 bv_morton_quantize ( float v, float lo, float extent )
+{
+    float t = ( extent > 0.0f ) ? ( v - lo ) / extent : 0.0f;
+    u32 max = ( 1u << BV_MORTON_BITS ) - 1;
+
+    if ( t < 0.0f ) t = 0.0f;
+    if ( t > 1.0f ) t = 1.0f;
+
+    return (u32) ( t * (float) max );
+}
+
+static int bv_morton_compare ( const void *p_a, const void *p_b )
+{
+    u32 a = ((const bv_build_item *)p_a)->morton,
+        b = ((const bv_build_item *)p_b)->morton;
+
+    return ( a > b ) - ( a < b );
+}
+
+static void bv_release_interior ( bv *p_bv );
+
+static bv *bv_build_recursive ( bv_build_item *p_items, size_t count, fn_bv_split *pfn_split )
+{
+
+    // leaf
+    if ( count == 1 ) return p_items[0].p_leaf;
+
+    // initialized data
+    bv *p_node = default_allocator(0, sizeof(bv));
+    size_t lo[4] = { 0 }, len[4] = { count }, groups = 1;
+
+    if ( NULL == p_node ) return NULL;
+
+    *p_node = (bv)
+    {
+        .p_data        = { 0, 0, 0, 0 },
+        ._min          = {  FLT_MAX,  FLT_MAX,  FLT_MAX },
+        ._max          = { -FLT_MAX, -FLT_MAX, -FLT_MAX },
+        .p_parent      = 0,
+        .p_user_data   = 0,
+        .pfn_bind      = bvh_bind_adapter,
+        .pfn_draw      = bvh_draw_adapter,
+        .pfn_info      = bvh_info_adapter,
+        .pfn_intersect = bvh_intersect_adapter,
+        .pfn_contains  = bvh_contains_adapter,
+        .pfn_bounds    = bvh_bounds_adapter,
+        .pfn_cull      = bvh_cull_adapter
+    };
+
+    // few enough items to reference directly
+    if ( count <= 4 )
+    {
+        for ( size_t i = 0; i < count; i++ ) lo[i] = i, len[i] = 1;
+        groups = count;
+    }
+
+    // split the largest group until there are four
+    else while ( groups < 4 )
+    {
+        size_t g = 0;
 
-    *pp_bv = current_level[0];
-    default_allocator(current_level, 0);
+        for ( size_t i = 1; i < groups; i++ )
+            if ( len[i] > len[g] ) g = i;
 
+        if ( len[g] < 2 ) break;
+
+        size_t mid = pfn_split(p_items + lo[g], len[g]);
+
+        lo[groups]  = lo[g] + mid;
+        len[groups] = len[g] - mid;
+        len[g]      = mid;
+        groups++;
+    }
+
+    // construct each child
+    for ( size_t i = 0; i < groups; i++ )
+    {
+        bv *p_child = bv_build_recursive(p_items + lo[i], len[i], pfn_split);
+        vec3 min, max;
+
+        // out of memory. release the partial subtree
+        if ( NULL == p_child )
+        {
+            bv_release_interior(p_node);
+            return NULL;
+        }
+
+        p_node->p_data[i] = p_child;
+        p_child->p_parent = p_node;
+
+        if ( bv_bounds(p_child, &min, &max) )
+            bv_grow(&p_node->_min, &p_node->_max, min, max);
+    }
+
+    // remember the built surface area, to measure refit quality against
+    p_node->_area = bv_surface_area(p_node->_min, p_node->_max);
+
+    return p_node;
+}
+
+int bv_from_leaves ( bv **pp_bv, bv **pp_leaves, size_t count, enum bv_build_e build )
+{
+    if ( NULL == pp_bv || NULL == pp_leaves ) return 0;
+    if ( count == 0 ) return 0;
+
+    // initialized data
+    bv_build_item *p_items = default_allocator(0, count * sizeof(bv_build_item));
+    vec3 c_min = {  FLT_MAX,  FLT_MAX,  FLT_MAX },
+         c_max = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+    size_t n = 0;
+    bv *p_root = NULL;
+
+    if ( NULL == p_items ) return 0;
+
+    // gather leaf bounds and centroids
+    for ( size_t i = 0; i < count; i++ )
+    {
+        vec3 min, max;
+
+        // a leaf without bounds can not be placed
+        if ( 0 == bv_bounds(pp_leaves[i], &min, &max) )
+        {
+            #ifndef NDEBUG
+                log_warning("[g10] [bv] Leaf %zu has no bounds, and is left out of the hierarchy in call to function \"%s\"\n", i, __FUNCTION__);
+            #endif
+
+            continue;
+        }
+
+        p_items[n] = (bv_build_item)
+        {
+            .min      = min,
+            .max      = max,
+            .centroid = { ( min.x + max.x ) * 0.5f, ( min.y + max.y ) * 0.5f, ( min.z + max.z ) * 0.5f },
+            .morton   = 0,
+            .p_leaf   = pp_leaves[i],
+            .p_parent = pp_leaves[i]->p_parent
+        };
+
+        bv_grow(&c_min, &c_max, p_items[n].centroid, p_items[n].centroid);
+        n++;
+    }
+
+    if ( n == 0 )
+    {
+        default_allocator(p_items, 0);
+        return 0;
+    }
+
+    // sort along a morton curve
+    if ( build == BV_BUILD_LBVH )
+    {
+        vec3 extent = { c_max.x - c_min.x, c_max.y - c_min.y, c_max.z - c_min.z };
+
+        for ( size_t i = 0; i < n; i++ )
+            p_items[i].morton = 
+                ( bv_morton_expand(bv_morton_quantize(p_items[i].centroid.x, c_min.x, extent.x)) << 2 ) |
+                ( bv_morton_expand(bv_morton_quantize(p_items[i].centroid.y, c_min.y, extent.y)) << 1 ) |
+                ( bv_morton_expand(bv_morton_quantize(p_items[i].centroid.z, c_min.z, extent.z))      );
+
+        qsort(p_items, n, sizeof(bv_build_item), bv_morton_compare);
+    }
+
+    // build the tree
+    p_root = bv_build_recursive(p_items, n, ( build == BV_BUILD_LBVH ) ? bv_split_lbvh : bv_split_sah);
+    
+    // out of memory. the leaves go back to their old parents
+    if ( NULL == p_root )
+    {
+        #ifndef NDEBUG
+            log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+        #endif
+
+        for ( size_t i = 0; i < n; i++ )
+            p_items[i].p_leaf->p_parent = p_items[i].p_parent;
+
+        default_allocator(p_items, 0);
+
+        return 0;
+    }
+
+    // the root has no parent
+    p_root->p_parent = NULL;
+
+    default_allocator(p_items, 0);
+
+    // return the hierarchy to the caller
+    *pp_bv = p_root;
+
+    return 1;
+}
+
+// resize
+int bv_entity_resize ( bv *p_bv )
+{
+    if ( NULL == p_bv || NULL == p_bv->p_user_data || NULL == p_bv->p_data[0] ) return 0;
+
+    return aabb_from_entity((aabb *) p_bv->p_data[0], (entity *) p_bv->p_user_data);
+}
+
+// refit
+int bv_refit ( bv *p_leaf, float limit, bv **pp_degraded )
+{
+    if ( NULL == p_leaf ) return 0;
+
+    // initialized data
+    bv *p_degraded = NULL;
+
+    // walk the leaf to root path
+    for ( bv *p_node = p_leaf->p_parent; p_node; p_node = p_node->p_parent )
+    {
+        vec3 min = {  FLT_MAX,  FLT_MAX,  FLT_MAX },
+             max = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+        // union of the children
+        for ( size_t i = 0; i < 4; i++ )
+        {
+            vec3 c_min, c_max;
+
+            if ( p_node->p_data[i] && bv_bounds(p_node->p_data[i], &c_min, &c_max) )
+                bv_grow(&min, &max, c_min, c_max);
+        }
+
+        // the rest of the path is already correct
+        if ( 0 == memcmp(&min, &p_node->_min, sizeof(vec3)) && 
+             0 == memcmp(&max, &p_node->_max, sizeof(vec3)) ) break;
+
+        p_node->_min = min,
+        p_node->_max = max;
+
+        // quality check
+        if ( bv_surface_area(min, max) > limit * p_node->_area ) p_degraded = p_node;
+    }
+
+    // return the degraded node to the caller
+    if ( pp_degraded ) *pp_degraded = p_degraded;
+
+    // success
+    return 1;
+}
+
+static size_t bv_collect_leaves ( bv *p_bv, bv **pp_leaves, size_t n )
+{
+    if ( p_bv->p_user_data || p_bv->pfn_intersect != bvh_intersect_adapter )
+    {
+        if ( pp_leaves ) pp_leaves[n] = p_bv;
+        return n + 1;
+    }
+
+    for ( size_t i = 0; i < 4; i++ )
+        if ( p_bv->p_data[i] )
+            n = bv_collect_leaves(p_bv->p_data[i], pp_leaves, n);
+
+    return n;
+}
+
+static void bv_release_interior ( bv *p_bv )
+{
+    if ( p_bv->p_user_data || p_bv->pfn_intersect != bvh_intersect_adapter ) return;
+
+    for ( size_t i = 0; i < 4; i++ )
+        if ( p_bv->p_data[i] )
+            bv_release_interior(p_bv->p_data[i]);
+
+    default_allocator(p_bv, 0);
+}
+
+int bv_rebuild ( bv **pp_root, bv *p_node, enum bv_build_e build )
+{
+    if ( NULL == pp_root || NULL == p_node ) return 0;
+
+    // nothing to rebuild
+    if ( p_node->p_user_data ) return 1;
+
+    // initialized data
+    size_t count = bv_collect_leaves(p_node, NULL, 0);
+    bv **pp_leaves = default_allocator(0, count * sizeof(bv *)),
+        *p_parent = p_node->p_parent,
+        *p_new = NULL;
+
+    if ( NULL == pp_leaves ) return 0;
+
+    // rebuild over the same leaves
+    bv_collect_leaves(p_node, pp_leaves, 0);
+
+    if ( 0 == bv_from_leaves(&p_new, pp_leaves, count, build) )
+    {
+        default_allocator(pp_leaves, 0);
+        return 0;
+    }
+
+    default_allocator(pp_leaves, 0);
+
+    // splice the subtree into the hierarchy
+    p_new->p_parent = p_parent;
+
+    if ( p_parent )
+    {
+        for ( size_t i = 0; i < 4; i++ )
+            if ( p_parent->p_data[i] == p_node ) p_parent->p_data[i] = p_new;
+    }
+    else
+        *pp_root = p_new;
+
+    // release the old interior nodes
+    bv_release_interior(p_node);
+
+    // success
     return 1;
 }
 
@@ -0,0 +1,593 @@
+/** !
+ * Compiled, read only bounding volume hierarchy
+ *
+ * @file src/world/bvh.c
+ *
+ * @author Jacob Smith
+ */
+
+// header
+#include <bvh.h>
+
+// simd
+#if defined(__SSE__) || defined(_M_X64)
+    #include <xmmintrin.h>
+    #define BVH_SSE
+#elif defined(__ARM_NEON)
+    #include <arm_neon.h>
+    #define BVH_NEON
+#endif
+
+// static function declarations
+static void bvh_count ( bv *p_bv, size_t *p_nodes, size_t *p_leaves, size_t depth, size_t *p_depth );
+static s32  bvh_compile ( bvh *p_bvh, bv *p_bv, size_t *p_node, size_t *p_leaf );
+static void bvh_node_plane ( const bvh_node *p_node, vec4 plane, u32 *p_out, u32 *p_in );
+static u32  bvh_node_classify ( bvh_node *p_node, const vec4 planes[6], u32 valid, u8 masks[4], size_t *p_tested );
+static size_t bvh_cull_node ( bvh *p_bvh, const vec4 planes[6], bvh_task task, bvh_task children[4], size_t *p_children, fn_bvh_visit *pfn_visit, void *p_context, bvh_cull_stats *p_stats );
+
+// function definitions
+int bvh_from_bv ( bvh **pp_bvh, bv *p_bv )
+{
+
+    // argument check
+    if ( pp_bvh == (void *) 0 ) goto no_bvh;
+    if ( p_bv   == (void *) 0 ) goto no_bv;
+
+    // initialized data
+    bvh *p_bvh = default_allocator(0, sizeof(bvh));
+    size_t node_count = 0, leaf_count = 0, depth = 0, node = 0, leaf = 0;
+
+    // error check
+    if ( p_bvh == (void *) 0 ) goto no_mem;
+
+    // size the hierarchy
+    bvh_count(p_bv, &node_count, &leaf_count, 1, &depth);
+
+    // a lone leaf still needs a root node
+    if ( node_count == 0 ) node_count = 1;
+
+    // error check
+    if ( depth * 3 + 4 > BVH_STACK_MAX ) goto too_deep;
+
+    // allocate the node and leaf arrays
+    *p_bvh = (bvh)
+    {
+        .p_nodes    = default_allocator(0, node_count * sizeof(bvh_node)),
+        .pp_leaves  = default_allocator(0, leaf_count * sizeof(bv *)),
+        .node_count = node_count,
+        .leaf_count = leaf_count,
+        .depth      = depth,
+        .cull       = { 0 }
+    };
+
+    // error check
+    if ( p_bvh->p_nodes   == (void *) 0 ) goto no_mem;
+    if ( p_bvh->pp_leaves == (void *) 0 ) goto no_mem;
+
+    // compile
+    if ( p_bv->p_user_data )
+    {
+
+        // initialized data
+        bvh_node *p_root = &p_bvh->p_nodes[node++];
+        vec3 min, max;
+
+        // a hierarchy of one leaf
+        bv_bounds(p_bv, &min, &max);
+        p_bvh->pp_leaves[leaf++] = p_bv;
+
+        for ( size_t i = 0; i < 4; i++ )
+            p_root->min_x[i] = FLT_MAX , p_root->min_y[i] = FLT_MAX , p_root->min_z[i] = FLT_MAX,
+            p_root->max_x[i] = -FLT_MAX, p_root->max_y[i] = -FLT_MAX, p_root->max_z[i] = -FLT_MAX,
+            p_root->child[i] = BVH_EMPTY;
+
+        p_root->min_x[0] = min.x, p_root->min_y[0] = min.y, p_root->min_z[0] = min.z,
+        p_root->max_x[0] = max.x, p_root->max_y[0] = max.y, p_root->max_z[0] = max.z,
+        p_root->child[0] = ~(s32) 0;
+        p_root->plane    = 0;
+    }
+    else
+        bvh_compile(p_bvh, p_bv, &node, &leaf);
+
+    // return a pointer to the caller
+    *pp_bvh = p_bvh;
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_bvh:
+                #ifndef NDEBUG
+                    log_error("[g10] [bvh] Null pointer provided for parameter \"pp_bvh\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_bv:
+                #ifndef NDEBUG
+                    log_error("[g10] [bvh] Null pointer provided for parameter \"p_bv\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // g10 errors
+        {
+            too_deep:
+                #ifndef NDEBUG
+                    log_error("[g10] [bvh] Hierarchy of depth %zu is too deep to compile in call to function \"%s\"\n", depth, __FUNCTION__);
+                #endif
+
+                // release the hierarchy
+                default_allocator(p_bvh, 0);
+
+                // error
+                return 0;
+        }
+
+        // standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // release the hierarchy
+                if ( p_bvh )
+                {
+                    if ( p_bvh->p_nodes   ) default_allocator(p_bvh->p_nodes, 0);
+                    if ( p_bvh->pp_leaves ) default_allocator(p_bvh->pp_leaves, 0);
+
+                    default_allocator(p_bvh, 0);
+                }
+
+                // error
+                return 0;
+        }
+    }
+}
+
+/** !
+ * Classify the children of one node. Visible leaves are visited, and 
+ * visible interior children are returned as subtrees.
+ *
+ * @param p_bvh       the compiled hierarchy
+ * @param planes      the 6 frustum planes
+ * @param task        the node, and the planes it still tests
+ * @param children    return the visible interior children
+ * @param p_children  return the quantity of visible interior children
+ * @param pfn_visit   called once for each visible leaf
+ * @param p_context   passed through to pfn_visit
+ * @param p_stats     the metrics are added to this
+ *
+ * @return the quantity of visible leaves
+ */
+static size_t bvh_cull_node ( bvh *p_bvh, const vec4 planes[6], bvh_task task, bvh_task children[4], size_t *p_children, fn_bvh_visit *pfn_visit, void *p_context, bvh_cull_stats *p_stats )
+{
+
+    // initialized data
+    bvh_node *p_node = &p_bvh->p_nodes[task.node];
+    u8 masks[4] = { task.mask, task.mask, task.mask, task.mask };
+    u32 valid = 0, lanes = 0;
+    size_t visible = 0, count = 0;
+
+    for ( size_t i = 0; i < 4; i++ )
+        if ( p_node->child[i] != BVH_EMPTY ) valid |= 1u << i;
+
+    // a subtree fully inside the frustum needs no tests
+    lanes = ( task.mask ) ? bvh_node_classify(p_node, planes, valid, masks, &p_stats->planes_tested) : valid;
+
+    // visit each child
+    for ( size_t i = 0; i < 4; i++ )
+    {
+
+        // initialized data
+        s32 child = p_node->child[i];
+
+        // unused slot
+        if ( 0 == ( valid & ( 1u << i ) ) ) continue;
+
+        p_stats->nodes_visited++;
+
+        // culled
+        if ( 0 == ( lanes & ( 1u << i ) ) ) { p_stats->nodes_culled++; continue; }
+
+        // interior node
+        if ( child >= 0 ) 
+        { 
+            children[count].node = child, children[count].mask = masks[i], count++; 
+            continue; 
+        }
+
+        // leaf
+        if ( pfn_visit ) pfn_visit(p_bvh->pp_leaves[~child], p_context);
+
+        visible++;
+    }
+
+    // done
+    *p_children = count;
+
+    return visible;
+}
+
+size_t bvh_cull ( bvh *p_bvh, const vec4 planes[6], fn_bvh_visit *pfn_visit, void *p_context )
+{
+
+    // argument check
+    if ( p_bvh  == (void *) 0 ) return 0;
+    if ( planes == (void *) 0 ) return 0;
+
+    // initialized data
+    bvh_cull_stats _stats = { 0 };
+    size_t visible = bvh_cull_task(p_bvh, planes, (bvh_task) { .node = 0, .mask = BVH_PLANES_ALL }, pfn_visit, p_context, &_stats);
+
+    // store the metrics
+    p_bvh->cull = _stats;
+
+    // done
+    return visible;
+}
+
+size_t bvh_cull_split ( bvh *p_bvh, const vec4 planes[6], bvh_task *p_tasks, size_t max, fn_bvh_visit *pfn_visit, void *p_context, bvh_cull_stats *p_stats )
+{
+
+    // argument check
+    if ( p_bvh   == (void *) 0 ) return 0;
+    if ( planes  == (void *) 0 ) return 0;
+    if ( p_tasks == (void *) 0 ) return 0;
+    if ( p_stats == (void *) 0 ) return 0;
+
+    // initialized data
+    bvh_task _ring[BVH_TASKS_MAX];
+    size_t head = 0, live = 0;
+
+    // clamp
+    if ( max > BVH_TASKS_MAX ) max = BVH_TASKS_MAX;
+    if ( max == 0 ) return 0;
+
+    // start at the root, with every plane active
+    _ring[0] = (bvh_task) { .node = 0, .mask = BVH_PLANES_ALL }, live = 1;
+
+    // split the shallowest subtree while its children fit
+    while ( live && live + 3 <= max )
+    {
+
+        // initialized data
+        bvh_task task = _ring[head], children[4];
+        size_t count = 0;
+
+        // pop the front
+        head = ( head + 1 ) % BVH_TASKS_MAX, live--;
+
+        // cull one level
+        bvh_cull_node(p_bvh, planes, task, children, &count, pfn_visit, p_context, p_stats);
+
+        // push the visible children to the back
+        for ( size_t i = 0; i < count; i++ )
+            _ring[( head + live++ ) % BVH_TASKS_MAX] = children[i];
+    }
+
+    // return the subtrees to the caller, in order
+    for ( size_t i = 0; i < live; i++ )
+        p_tasks[i] = _ring[( head + i ) % BVH_TASKS_MAX];
+
+    // done
+    return live;
+}
+
+size_t bvh_cull_task ( bvh *p_bvh, const vec4 planes[6], bvh_task task, fn_bvh_visit *pfn_visit, void *p_context, bvh_cull_stats *p_stats )
+{
+
+    // argument check
+    if ( p_bvh   == (void *) 0 ) return 0;
+    if ( planes  == (void *) 0 ) return 0;
+    if ( p_stats == (void *) 0 ) return 0;
+
+    // initialized data
+    bvh_task stack[BVH_STACK_MAX];
+    size_t sp = 0, visible = 0;
+
+    // start at the subtree
+    stack[sp++] = task;
+
+    // walk the hierarchy
+    while ( sp )
+    {
+
+        // initialized data
+        bvh_task children[4];
+        size_t count = 0;
+
+        // cull one node
+        visible += bvh_cull_node(p_bvh, planes, stack[--sp], children, &count, pfn_visit, p_context, p_stats);
+
+        // descend into the visible children
+        for ( size_t i = 0; i < count; i++ ) stack[sp++] = children[i];
+    }
+
+    // done
+    return visible;
+}
+
+int bvh_refit ( bvh *p_bvh )
+{
+
+    // argument check
+    if ( p_bvh == (void *) 0 ) return 0;
+
+    // nodes are in preorder, so every child is refit before its parent
+    for ( size_t n = p_bvh->node_count; n-- > 0; )
+    {
+
+        // initialized data
+        bvh_node *p_node = &p_bvh->p_nodes[n];
+
+        for ( size_t i = 0; i < 4; i++ )
+        {
+
+            // initialized data
+            s32 child = p_node->child[i];
+            vec3 min = {  FLT_MAX,  FLT_MAX,  FLT_MAX },
+                 max = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+            // unused slot
+            if ( child == BVH_EMPTY ) continue;
+
+            // leaf
+            if ( child < 0 ) bv_bounds(p_bvh->pp_leaves[~child], &min, &max);
+
+            // interior node
+            else
+            {
+                const bvh_node *p_child = &p_bvh->p_nodes[child];
+
+                for ( size_t j = 0; j < 4; j++ )
+                {
+                    if ( p_child->min_x[j] < min.x ) min.x = p_child->min_x[j];
+                    if ( p_child->min_y[j] < min.y ) min.y = p_child->min_y[j];
+                    if ( p_child->min_z[j] < min.z ) min.z = p_child->min_z[j];
+                    if ( p_child->max_x[j] > max.x ) max.x = p_child->max_x[j];
+                    if ( p_child->max_y[j] > max.y ) max.y = p_child->max_y[j];
+                    if ( p_child->max_z[j] > max.z ) max.z = p_child->max_z[j];
+                }
+            }
+
+            p_node->min_x[i] = min.x, p_node->min_y[i] = min.y, p_node->min_z[i] = min.z,
+            p_node->max_x[i] = max.x, p_node->max_y[i] = max.y, p_node->max_z[i] = max.z;
+        }
+    }
+
+    // success
+    return 1;
+}
+
+int bvh_info ( bvh *p_bvh )
+{
+
+    // argument check
+    if ( p_bvh == (void *) 0 ) return 0;
+
+    // print the compiled hierarchy
+    logger_pad(), log_info("BVH @%p\n", p_bvh),
+    logger_push(),
+    logger_pad(), printf("nodes  - %zu\n", p_bvh->node_count),
+    logger_pad(), printf("leaves - %zu\n", p_bvh->leaf_count),
+    logger_pad(), printf("depth  - %zu\n", p_bvh->depth),
+    logger_pop();
+
+    // success
+    return 1;
+}
+
+int bvh_destroy ( bvh **pp_bvh )
+{
+
+    // argument check
+    if ( pp_bvh == (void *) 0 ) goto no_bvh;
+
+    // initialized data
+    bvh *p_bvh = *pp_bvh;
+
+    // no more pointer for caller
+    *pp_bvh = (void *) 0;
+
+    // release the memory
+    if ( p_bvh )
+        default_allocator(p_bvh->p_nodes, 0),
+        default_allocator(p_bvh->pp_leaves, 0),
+        default_allocator(p_bvh, 0);
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_bvh:
+                #ifndef NDEBUG
+                    log_error("[g10] [bvh] Null pointer provided for parameter \"pp_bvh\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+static void bvh_count ( bv *p_bv, size_t *p_nodes, size_t *p_leaves, size_t depth, size_t *p_depth )
+{
+
+    // leaf
+    if ( p_bv->p_user_data ) { (*p_leaves)++; return; }
+
+    // interior node
+    (*p_nodes)++;
+    if ( depth > *p_depth ) *p_depth = depth;
+
+    for ( size_t i = 0; i < 4; i++ )
+        if ( p_bv->p_data[i] )
+            bvh_count(p_bv->p_data[i], p_nodes, p_leaves, depth + 1, p_depth);
+}
+
+static s32 bvh_compile ( bvh *p_bvh, bv *p_bv, size_t *p_node, size_t *p_leaf )
+{
+
+    // initialized data
+    s32 index = (s32) (*p_node)++;
+    size_t slot = 0;
+
+    // store each child
+    for ( size_t i = 0; i < 4; i++ )
+    {
+
+        // initialized data
+        bv *p_child = p_bv->p_data[i];
+        vec3 min = {  FLT_MAX,  FLT_MAX,  FLT_MAX },
+             max = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+        s32 child = BVH_EMPTY;
+
+        // compile the child
+        if ( p_child && bv_bounds(p_child, &min, &max) )
+        {
+            if ( p_child->p_user_data )
+                p_bvh->pp_leaves[*p_leaf] = p_child,
+                child = ~(s32) (*p_leaf)++;
+            else
+                child = bvh_compile(p_bvh, p_child, p_node, p_leaf);
+        }
+        else
+            min = (vec3) {  FLT_MAX,  FLT_MAX,  FLT_MAX },
+            max = (vec3) { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+        // store the child in its lane
+        {
+            bvh_node *p_out = &p_bvh->p_nodes[index];
+
+            p_out->min_x[slot] = min.x, p_out->min_y[slot] = min.y, p_out->min_z[slot] = min.z,
+            p_out->max_x[slot] = max.x, p_out->max_y[slot] = max.y, p_out->max_z[slot] = max.z,
+            p_out->child[slot] = child;
+        }
+
+        slot++;
+    }
+
+    // no plane hint yet
+    p_bvh->p_nodes[index].plane = 0;
+
+    // done
+    return index;
+}
+
+static void bvh_node_plane ( const bvh_node *p_node, vec4 plane, u32 *p_out, u32 *p_in )
+{
+
+    #if defined(BVH_SSE)
+
+        // initialized data
+        __m128 x_far  = _mm_load_ps( ( plane.x > 0.0f ) ? p_node->max_x : p_node->min_x ),
+               y_far  = _mm_load_ps( ( plane.y > 0.0f ) ? p_node->max_y : p_node->min_y ),
+               z_far  = _mm_load_ps( ( plane.z > 0.0f ) ? p_node->max_z : p_node->min_z ),
+               x_near = _mm_load_ps( ( plane.x > 0.0f ) ? p_node->min_x : p_node->max_x ),
+               y_near = _mm_load_ps( ( plane.y > 0.0f ) ? p_node->min_y : p_node->max_y ),
+               z_near = _mm_load_ps( ( plane.z > 0.0f ) ? p_node->min_z : p_node->max_z ),
+               a = _mm_set1_ps(plane.x), b = _mm_set1_ps(plane.y),
+               c = _mm_set1_ps(plane.z), d = _mm_set1_ps(plane.w),
+               d_far  = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x_far , a), _mm_mul_ps(y_far , b)), _mm_add_ps(_mm_mul_ps(z_far , c), d)),
+               d_near = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x_near, a), _mm_mul_ps(y_near, b)), _mm_add_ps(_mm_mul_ps(z_near, c), d));
+
+        // the furthest vertex is behind the plane
+        *p_out = (u32) _mm_movemask_ps(_mm_cmplt_ps(d_far, _mm_setzero_ps()));
+
+        // the nearest vertex is in front of the plane
+        *p_in  = (u32) _mm_movemask_ps(_mm_cmpge_ps(d_near, _mm_setzero_ps()));
+
+    #elif defined(BVH_NEON)
+
+        // initialized data
+        const uint32x4_t bits = { 1, 2, 4, 8 };
+        float32x4_t d_far  = vdupq_n_f32(plane.w),
+                    d_near = vdupq_n_f32(plane.w);
+
+        d_far  = vmlaq_n_f32(d_far , vld1q_f32( ( plane.x > 0.0f ) ? p_node->max_x : p_node->min_x ), plane.x);
+        d_far  = vmlaq_n_f32(d_far , vld1q_f32( ( plane.y > 0.0f ) ? p_node->max_y : p_node->min_y ), plane.y);
+        d_far  = vmlaq_n_f32(d_far , vld1q_f32( ( plane.z > 0.0f ) ? p_node->max_z : p_node->min_z ), plane.z);
+        d_near = vmlaq_n_f32(d_near, vld1q_f32( ( plane.x > 0.0f ) ? p_node->min_x : p_node->max_x ), plane.x);
+        d_near = vmlaq_n_f32(d_near, vld1q_f32( ( plane.y > 0.0f ) ? p_node->min_y : p_node->max_y ), plane.y);
+        d_near = vmlaq_n_f32(d_near, vld1q_f32( ( plane.z > 0.0f ) ? p_node->min_z : p_node->max_z ), plane.z);
+
+        // the furthest vertex is behind the plane
+        *p_out = vaddvq_u32(vandq_u32(vcltq_f32(d_far, vdupq_n_f32(0.0f)), bits));
+
+        // the nearest vertex is in front of the plane
+        *p_in  = vaddvq_u32(vandq_u32(vcgeq_f32(d_near, vdupq_n_f32(0.0f)), bits));
+
+    #else
+
+        // initialized data
+        u32 out = 0, in = 0;
+
+        for ( size_t c = 0; c < 4; c++ )
+        {
+            float d_far  = plane.x * ( ( plane.x > 0.0f ) ? p_node->max_x[c] : p_node->min_x[c] ) +
+                           plane.y * ( ( plane.y > 0.0f ) ? p_node->max_y[c] : p_node->min_y[c] ) +
+                           plane.z * ( ( plane.z > 0.0f ) ? p_node->max_z[c] : p_node->min_z[c] ) + plane.w,
+                  d_near = plane.x * ( ( plane.x > 0.0f ) ? p_node->min_x[c] : p_node->max_x[c] ) +
+                           plane.y * ( ( plane.y > 0.0f ) ? p_node->min_y[c] : p_node->max_y[c] ) +
+                           plane.z * ( ( plane.z > 0.0f ) ? p_node->min_z[c] : p_node->max_z[c] ) + plane.w;
+
+            if ( d_far  <  0.0f ) out |= 1u << c;
+            if ( d_near >= 0.0f ) in  |= 1u << c;
+        }
+
+        *p_out = out,
+        *p_in  = in;
+    #endif
+}
+
+static u32 bvh_node_classify ( bvh_node *p_node, const vec4 planes[6], u32 valid, u8 masks[4], size_t *p_tested )
+{
+
+    // initialized data
+    u32 outside = 0, hint = p_node->plane, active = masks[0];
+    bool hinted = false;
+
+    // test the active planes, starting with the one that culled last frame
+    for ( u32 k = 0; k < 6; k++ )
+    {
+
+        // initialized data
+        u32 i = ( hint + k ) % 6, out = 0, in = 0;
+
+        if ( 0 == ( active & ( 1u << i ) ) ) continue;
+
+        bvh_node_plane(p_node, planes[i], &out, &in);
+        (*p_tested)++;
+
+        // children behind this plane
+        out &= valid & ~outside;
+        if ( out )
+        {
+            outside |= out;
+            if ( !hinted ) p_node->plane = (u8) i, hinted = true;
+        }
+
+        // children fully in front of this plane need not test it again
+        for ( size_t c = 0; c < 4; c++ )
+            if ( in & ( 1u << c ) ) masks[c] &= (u8) ~( 1u << i );
+
+        // every child is culled
+        if ( outside == valid ) break;
+    }
+
+    // done
+    return valid & ~outside;
+}
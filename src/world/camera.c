@@ -317,6 +317,11 @@ int camera_from_json ( camera **pp_camera, json_value *p_value )
             .target   = orientation,
             .up       = up
         },
+        .previous =
+        {
+            .location = location,
+            .target   = orientation
+        },
         .projection = 
         {
             .fov          = fov,
@@ -830,6 +835,86 @@ u0 camera_matrix_projection_perspective ( mat4 *p_projection, float fov, float a
     }
 }
 
+int camera_tick ( camera *p_camera )
+{
+
+    // argument check
+    if ( p_camera == (void *) 0 ) goto no_camera;
+
+    // store the current view
+    p_camera->previous.location = p_camera->view.location,
+    p_camera->previous.target   = p_camera->view.target;
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_camera:
+                #ifndef NDEBUG
+                    log_error("[g10] [camera] Null pointer provided for parameter \"p_camera\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int camera_interpolate ( camera *p_camera, float alpha )
+{
+
+    // argument check
+    if ( p_camera == (void *) 0 ) goto no_camera;
+
+    // initialized data
+    vec3 location = { 0 },
+         target   = { 0 };
+    float t = alpha,
+          u = 1.f - alpha;
+
+    // blend the views
+    location = (vec3)
+    {
+        .x = p_camera->previous.location.x * u + p_camera->view.location.x * t,
+        .y = p_camera->previous.location.y * u + p_camera->view.location.y * t,
+        .z = p_camera->previous.location.z * u + p_camera->view.location.z * t
+    },
+    target = (vec3)
+    {
+        .x = p_camera->previous.target.x * u + p_camera->view.target.x * t,
+        .y = p_camera->previous.target.y * u + p_camera->view.target.y * t,
+        .z = p_camera->previous.target.z * u + p_camera->view.target.z * t
+    };
+
+    // compute the view matrix
+    camera_matrix_view(&p_camera->matrix._view, location, target, p_camera->view.up);
+
+    // update the frustum planes
+    camera_update_frustum(p_camera);
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_camera:
+                #ifndef NDEBUG
+                    log_error("[g10] [camera] Null pointer provided for parameter \"p_camera\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
 int camera_info ( camera *p_camera )
 {
 
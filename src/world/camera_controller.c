@@ -9,35 +9,42 @@
 // header file
 #include <camera_controller.h>
 
+// preprocessor definitions
+#define CAMERA_CONTROLLER_MOVE_SPEED 12.f // units per second
+#define CAMERA_CONTROLLER_TURN_SPEED 3.f  // radians per second
+
 // function definitions
-int camera_controller_first_person_update ( camera *p_camera )
+int camera_controller_first_person_update ( camera *p_camera, float delta_time )
 {
 
+    // initialized data
+    float move = CAMERA_CONTROLLER_MOVE_SPEED * delta_time,
+          turn = CAMERA_CONTROLLER_TURN_SPEED * delta_time;
+
+    // the back and right vectors of the current view. the view matrix may
+    // hold an interpolated view
+    vec3 _back  = { 0 },
+         _right = { 0 },
+         _scratch = { 0 };
+
+    vec3_sub_vec3(&_scratch, p_camera->view.location, p_camera->view.target);
+    vec3_normalize(&_back, _scratch);
+    vec3_cross_product(&_scratch, p_camera->view.up, _back);
+    vec3_normalize(&_right, _scratch);
+
     // movement
     {
         
         // initialized data
         //vec3 _location = p_camera->view.location;
         vec3 _displacement = { 0 };
-        vec3 _right =
-        {
-            .x = p_camera->matrix._view.a,
-            .y = p_camera->matrix._view.e,
-            .z = p_camera->matrix._view.i
-        };
-        vec3 _back =
-        {
-            .x = p_camera->matrix._view.c,
-            .y = p_camera->matrix._view.g,
-            .z = p_camera->matrix._view.k
-        };
         vec3 _forward;
         vec3_mul_scalar(&_forward, _back, -1.0f);
 
         vec3 _forward_prime = { 0 },
              _right_prime   = { 0 };
-        float forward_backward = 0.2f * ( input_bind_value("FORWARD") - input_bind_value("BACKWARD") ),
-              left_right       = 0.2f * ( input_bind_value("STRAFE RIGHT") - input_bind_value("STRAFE LEFT") );
+        float forward_backward = move * ( input_bind_value("FORWARD") - input_bind_value("BACKWARD") ),
+              left_right       = move * ( input_bind_value("STRAFE RIGHT") - input_bind_value("STRAFE LEFT") );
 
         // scale the forward / backward displacement
         vec3_mul_scalar(&_forward_prime, _forward, forward_backward);
@@ -57,26 +64,18 @@ int camera_controller_first_person_update ( camera *p_camera )
 
         // up / down
         vec3 _up_prime = { 0 };
-        vec3_mul_scalar(&_up_prime, p_camera->view.up, 0.2f * ( input_bind_value("JUMP") - input_bind_value("PRONE") ) );
+        vec3_mul_scalar(&_up_prime, p_camera->view.up, move * ( input_bind_value("JUMP") - input_bind_value("PRONE") ) );
         vec3_add_vec3(&p_camera->view.location, p_camera->view.location, _up_prime);
     }
 
     // orientation
     {
-        float up_down   = 0.05f * ( input_bind_value("CAMERA DOWN") - input_bind_value("CAMERA UP") ),
-              side_side = 0.05f * ( input_bind_value("CAMERA LEFT") - input_bind_value("CAMERA RIGHT") );
-
-        // construct a forward vector from the view matrix 
-        // note: The third column of the view matrix is the camera's Z axis (Backwards)
-        vec3 back = 
-        {
-            .x = p_camera->matrix._view.c,
-            .y = p_camera->matrix._view.g,
-            .z = p_camera->matrix._view.k
-        };
+        float up_down   = turn * ( input_bind_value("CAMERA DOWN") - input_bind_value("CAMERA UP") ),
+              side_side = turn * ( input_bind_value("CAMERA LEFT") - input_bind_value("CAMERA RIGHT") );
 
+        // construct a forward vector from the view
         vec3 front;
-        vec3_mul_scalar(&front, back, -1.0f);
+        vec3_mul_scalar(&front, _back, -1.0f);
         vec3_normalize(&front, front);
 
         // convert cartesian direction vector to polar coordinates
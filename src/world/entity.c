@@ -2,6 +2,8 @@
 #include <entity.h>
 #include <material.h>
 #include <aabb.h>
+#include <asset_cache.h>
+#include <pipeline.h>
 
 // key accessor
 const char *entity_key_accessor ( const entity *const p_entity )
@@ -18,7 +20,7 @@ int entity_info ( entity *p_entity )
 
     logger_push(),
     logger_pad(), printf("name     - %s\n", p_entity->_name),
-    logger_pad(), printf("pipeline - %s\n", p_entity->pipeline),    
+    logger_pad(), printf("pipeline - %s\n", p_entity->_pipeline_name),    
     
     logger_pad(), printf("bounds:\n"),
     logger_push(),
@@ -56,6 +58,12 @@ int entity_from_json ( entity **pp_entity, json_value *p_value )
     g_instance *p_instance = g_active_instance();
     entity *p_entity = default_allocator(0, sizeof(entity));
 
+    // error check
+    if ( NULL == p_entity ) goto no_mem;
+
+    // nothing is loaded yet
+    *p_entity = (entity) { 0 };
+
     dict *p_dict = p_value->object;
     json_value *p_name          = NULL,
                *p_transform     = NULL,
@@ -72,36 +80,42 @@ int entity_from_json ( entity **pp_entity, json_value *p_value )
     // store the name
     strncpy(p_entity->_name, p_name->string, 63);
 
+    // no cache is built yet
+    p_entity->_version.inv_normal = 0,
+    p_entity->_version.bounds     = 0;
+
+    // no pipeline yet
+    p_entity->_pipeline_name[0] = '\0',
+    p_entity->_pipeline         = (pipeline_handle) { 0 };
+
     // construct a transform
     transform_from_json(&p_entity->p_transform, p_transform);
 
-    // add the entity to the pipeline's draw list
+    // store the pipeline name, and resolve it. the gather uses the handle, 
+    // and only looks the name up again after the pipelines are reloaded, so
+    // a pipeline that is missing now is found after the next reload
     if ( p_pipeline_name )
-    {
-
-        // initialized data
-        pipeline *p_pipeline = NULL;
-        dict_get(p_instance->cache.p_pipeline, p_pipeline_name->string, (void **)&p_pipeline);
-
-        // store the pipeline name
-        p_entity->pipeline = p_pipeline->_name;
-    }
+        strncpy(p_entity->_pipeline_name, p_pipeline_name->string, 63),
+        pipeline_handle_get(&p_entity->_pipeline, p_entity->_pipeline_name);
 
     if ( p_geometry )
     {
 
-        // initialized data
-        geometry *p_geom = NULL;
-
+        // external functions
         extern int g_sdl3_geometry_from_json ( geometry **pp_geometry, const json_value *p_value );
-        g_sdl3_geometry_from_json(&p_geom, p_geometry);
 
-        // store the geometry in the entity's transform
-        p_entity->p_geometry = p_geom;
+        // shared geometry file
+        if ( JSON_VALUE_STRING == p_geometry->type )
+            asset_cache_acquire(p_instance->cache.p_geometry_files, p_geometry->string, (void **)&p_entity->p_geometry);
+
+        // inline geometry
+        else
+            g_sdl3_geometry_from_json(&p_entity->p_geometry, p_geometry);
 
-        // TODO: clean this up later so no dangling pointers
-        p_entity->p_geometry->p_local_transform->p_parent = p_entity->p_transform;
+        // error check
+        if ( NULL == p_entity->p_geometry ) goto failed_to_load_geometry;
 
+        // bounds are per entity. the geometry may be shared
         bv_from_entity(&p_entity->p_bounds, p_entity);
 
         {
@@ -113,35 +127,9 @@ int entity_from_json ( entity **pp_entity, json_value *p_value )
 
     }
 
-    // parse Material
+    // shared material file
     if ( p_material && p_material->type == JSON_VALUE_STRING )
-    {
-        // load material from file
-        const char *path = p_material->string;
-        size_t len = load_file(path, 0, false);
-        
-        if ( len > 0 )
-        {
-            // Allocate buffer
-            char *buf = default_allocator(0, len + 1);
-            if ( buf )
-            {
-                load_file(path, buf, false);
-                buf[len] = '\0'; // null terminate
-
-                json_value *mat_json = 0;
-                if ( json_value_parse(buf, 0, &mat_json) )
-                {
-                    material_from_json(&p_entity->p_material, mat_json);
-                    
-                    // ideally free mat_json here if logic existed
-                }
-                
-                // free buffer
-                // default_allocator(buf, 0); 
-            }
-        }
-    }
+        asset_cache_acquire(p_instance->cache.p_material_files, p_material->string, (void **)&p_entity->p_material);
 
     // return a pointer to the caller
     *pp_entity = p_entity;
@@ -150,6 +138,25 @@ int entity_from_json ( entity **pp_entity, json_value *p_value )
     return 1;
     
     no_entity: return 0;
+
+    failed_to_load_geometry:
+        #ifndef NDEBUG
+            log_error("[g10] [entity] Failed to load geometry for entity \"%s\" in call to function \"%s\"\n", p_entity->_name, __FUNCTION__);
+        #endif
+
+        // release the entity, and whatever it acquired
+        entity_destroy(&p_entity);
+
+        // error
+        return 0;
+
+    no_mem:
+        #ifndef NDEBUG
+            log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+        #endif
+
+        // error
+        return 0;
 }
 
 int aabb_from_entity ( aabb *p_aabb, entity *p_entity )
@@ -163,46 +170,16 @@ int aabb_from_entity ( aabb *p_aabb, entity *p_entity )
 
     // initialized data
     aabb *p_geom_aabb = (aabb *) p_entity->p_geometry->p_bounds->p_data[0];
-    vec3 min = p_geom_aabb->_min;
-    vec3 max = p_geom_aabb->_max;
-    mat4 model = p_entity->p_transform->model;
+    mat4 world = { 0 };
 
-    // corners of the aabb
-    vec3 corners[8] = 
-    {
-        { min.x, min.y, min.z },
-        { max.x, min.y, min.z },
-        { min.x, max.y, min.z },
-        { max.x, max.y, min.z },
-        { min.x, min.y, max.z },
-        { max.x, min.y, max.z },
-        { min.x, max.y, max.z },
-        { max.x, max.y, max.z }
-    };
-
-    // transform the corners
-    vec3 new_min = {  3.402823e+38F,  3.402823e+38F,  3.402823e+38F };
-    vec3 new_max = { -3.402823e+38F, -3.402823e+38F, -3.402823e+38F };
-
-    for (size_t i = 0; i < 8; i++)
-    {
-        vec4 v_in = { corners[i].x, corners[i].y, corners[i].z, 1.0f };
-        vec4 v_out;
-        
-        mat4_mul_vec4(&v_out, model, v_in);
-
-        if ( v_out.x < new_min.x ) new_min.x = v_out.x;
-        if ( v_out.y < new_min.y ) new_min.y = v_out.y;
-        if ( v_out.z < new_min.z ) new_min.z = v_out.z;
-
-        if ( v_out.x > new_max.x ) new_max.x = v_out.x;
-        if ( v_out.y > new_max.y ) new_max.y = v_out.y;
-        if ( v_out.z > new_max.z ) new_max.z = v_out.z;
-    }
+    // the world matrix, so children are bounded where they are drawn
+    transform_get_matrix_world(p_entity->p_transform, &world);
+
+    // transform the centre and half extents of the geometry's bounds
+    aabb_transform(p_aabb, p_geom_aabb, world);
 
-    // store the result
-    p_aabb->_min = new_min;
-    p_aabb->_max = new_max;
+    // the bounds are current
+    p_entity->_version.bounds = transform_version(p_entity->p_transform);
 
     // success
     return 1;
@@ -219,13 +196,25 @@ int entity_bind ( render_pass *p_render_pass, pipeline *p_pipeline, entity *p_en
     if ( !p_entity ) return 0;
 
     // transform
-    transform_bind(p_render_pass, p_pipeline, p_entity->p_geometry->p_local_transform);
+    if ( p_render_pass->bound.p_transform != p_entity->p_transform )
+        transform_bind(p_render_pass, p_pipeline, p_entity->p_transform),
+        p_render_pass->bound.p_transform = p_entity->p_transform;
+    else
+        p_render_pass->bound.binds_skipped++;
   
     // material
-    if ( p_entity->p_material ) material_bind(p_render_pass, p_pipeline, p_entity->p_material);
+    if ( p_entity->p_material && p_render_pass->bound.p_material != p_entity->p_material )
+        material_bind(p_render_pass, p_pipeline, p_entity->p_material),
+        p_render_pass->bound.p_material = p_entity->p_material;
+    else if ( p_entity->p_material )
+        p_render_pass->bound.binds_skipped++;
     
     // bind the geometry
-    geometry_bind(p_render_pass, p_entity->p_geometry);
+    if ( p_render_pass->bound.p_geometry != p_entity->p_geometry )
+        geometry_bind(p_render_pass, p_entity->p_geometry),
+        p_render_pass->bound.p_geometry = p_entity->p_geometry;
+    else
+        p_render_pass->bound.binds_skipped++;
 
     // success
     return 1;
@@ -245,9 +234,8 @@ int entity_cull ( render_pass *p_render_pass, pipeline *p_pipeline, entity *p_en
     return 0; // If no bounds, don't cull
 }
 
-int entity_draw ( render_pass *p_render_pass, pipeline *p_pipeline, entity *p_entity )
+static int entity_draw_instances ( render_pass *p_render_pass, entity *p_entity, u32 instances )
 {
-    if ( !p_entity ) return 0;
 
     // draw geometry
     if ( p_entity->p_geometry )
@@ -261,31 +249,142 @@ int entity_draw ( render_pass *p_render_pass, pipeline *p_pipeline, entity *p_en
             // no part -> skip
             if (p_entity->p_geometry->_parts[i].p_handle == NULL) continue;
             
-            SDL_BindGPUIndexBuffer(
-                p_render_pass->p_handle,
-                &(SDL_GPUBufferBinding)
-                {
-                    .buffer = p_entity->p_geometry->_parts[i].p_handle,
-                    .offset = 0
-                },
-                SDL_GPU_INDEXELEMENTSIZE_32BIT
-            );
-
-            SDL_DrawGPUIndexedPrimitives(
-                p_render_pass->p_handle, 
-                p_entity->p_geometry->_parts[i].index_count * 3, 
-                1,
-                0, 
-                0, 
-                0
-            );
+            command_bind_index_buffer(p_render_pass, p_entity->p_geometry->_parts[i].p_handle);
+
+            command_draw_indexed(p_render_pass, p_entity->p_geometry->_parts[i].index_count * 3, instances);
         }
     }
     else if ( p_entity->p_geometry->p_index_handle )
-        SDL_DrawGPUIndexedPrimitives(p_render_pass->p_handle, p_entity->p_geometry->index_count * 3, 1, 0, 0, 0);
+        command_draw_indexed(p_render_pass, p_entity->p_geometry->index_count * 3, instances);
     else
-        SDL_DrawGPUPrimitives(p_render_pass->p_handle, p_entity->p_geometry->vertex_count, 1, 0, 0);
+        command_draw(p_render_pass, p_entity->p_geometry->vertex_count, instances);
 
     // success
     return 1;
 }
+
+int entity_draw ( render_pass *p_render_pass, pipeline *p_pipeline, entity *p_entity )
+{
+    if ( !p_entity ) return 0;
+
+    // draw one instance
+    return entity_draw_instances(p_render_pass, p_entity, 1);
+}
+
+static int entity_batch_pack ( void *p_buffer, const batch *p_batch )
+{
+
+    // initialized data
+    u32 range[2] = { p_batch->first, p_batch->count };
+
+    // copy the instance range
+    memcpy(p_buffer, range, sizeof(range));
+
+    // done
+    return sizeof(range);
+}
+
+int entity_bind_batch ( render_pass *p_render_pass, pipeline *p_pipeline, batch *p_batch )
+{
+    if ( !p_batch ) return 0;
+
+    // initialized data
+    entity *p_entity = p_batch->p_entity;
+    uniform *p_instance = NULL;
+
+    // instance range
+    if ( array_index(p_pipeline->p_uniforms, 0, (void **)&p_instance) )
+        uniform_set_pack_push(p_instance, p_batch, (fn_pack *)entity_batch_pack);
+
+    // material
+    if ( p_entity->p_material && p_render_pass->bound.p_material != p_entity->p_material )
+        material_bind(p_render_pass, p_pipeline, p_entity->p_material),
+        p_render_pass->bound.p_material = p_entity->p_material;
+    
+    // bind the geometry
+    if ( p_render_pass->bound.p_geometry != p_entity->p_geometry )
+        geometry_bind(p_render_pass, p_entity->p_geometry),
+        p_render_pass->bound.p_geometry = p_entity->p_geometry;
+
+    // success
+    return 1;
+}
+
+int entity_draw_batch ( render_pass *p_render_pass, pipeline *p_pipeline, batch *p_batch )
+{
+    if ( !p_batch ) return 0;
+
+    // draw every instance of the batch
+    return entity_draw_instances(p_render_pass, p_batch->p_entity, p_batch->count);
+}
+
+int entity_destroy ( entity **pp_entity )
+{
+
+    // argument check
+    if ( NULL == pp_entity ) goto no_entity;
+
+    // initialized data
+    g_instance *p_instance = g_active_instance();
+    entity *p_entity = *pp_entity;
+
+    // no more pointer for caller
+    *pp_entity = NULL;
+
+    // nothing to release
+    if ( NULL == p_entity ) return 1;
+
+    // bounds
+    if ( p_entity->p_bounds )
+    {
+
+        // initialized data
+        pipeline *p_pipeline = NULL;
+
+        // stop drawing the bounds
+        dict_get(p_instance->cache.p_pipeline, "aabb", (void **)&p_pipeline);
+        if ( p_pipeline )
+        {
+            for ( size_t i = 0; i < array_size(p_pipeline->p_static_draw_list); i++ )
+            {
+                void *p_item = NULL;
+
+                array_index(p_pipeline->p_static_draw_list, i, &p_item);
+                if ( p_item == p_entity->p_bounds ) { array_remove(p_pipeline->p_static_draw_list, i, NULL); break; }
+            }
+        }
+
+        bv_destroy(&p_entity->p_bounds);
+    }
+
+    // drop the shared geometry, or release inline geometry
+    if ( p_entity->p_geometry && 0 == asset_cache_release(p_instance->cache.p_geometry_files, p_entity->p_geometry) )
+        geometry_release(p_entity->p_geometry);
+
+    // drop the shared material
+    if ( p_entity->p_material ) asset_cache_release(p_instance->cache.p_material_files, p_entity->p_material);
+
+    // transform
+    if ( p_entity->p_transform ) transform_destroy(&p_entity->p_transform);
+
+    // release the entity
+    p_entity = default_allocator(p_entity, 0);
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_entity:
+                #ifndef NDEBUG
+                    log_error("[g10] [entity] Null pointer provided for parameter \"pp_entity\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
@@ -1,6 +1,8 @@
 // header
 #include <scene.h>
 #include <light.h>
+#include <aabb.h>
+#include <job.h>
 
 // function definitions
 int scene_from_json ( scene **pp_scene, json_value *p_value )
@@ -33,22 +35,42 @@ int scene_from_json ( scene **pp_scene, json_value *p_value )
                *p_entities = NULL,
                *p_cameras = NULL,
                *p_lights = NULL,
-               *p_skybox = NULL;
+               *p_skybox = NULL,
+               *p_bvh = NULL;
     
     dict_get(p_dict, "name"    , (void **)&p_name);
     dict_get(p_dict, "entities", (void **)&p_entities);
     dict_get(p_dict, "cameras" , (void **)&p_cameras);
     dict_get(p_dict, "lights"  , (void **)&p_lights);
     dict_get(p_dict, "skybox"  , (void **)&p_skybox);
+    dict_get(p_dict, "bvh"     , (void **)&p_bvh);
 
     // store the name
     strncpy(p_scene->_name, p_name->string, 63);
 
+    // store the bvh build strategy
+    p_scene->bvh_build = BV_BUILD_SAH;
+    if ( p_bvh && p_bvh->type == JSON_VALUE_STRING && 0 == strcmp(p_bvh->string, "lbvh") )
+        p_scene->bvh_build = BV_BUILD_LBVH;
+
+    // allocate the gather subtrees and buckets
+    p_scene->gather.p_tasks    = default_allocator(0, BVH_TASKS_MAX * sizeof(bvh_task)),
+    p_scene->gather.p_buckets  = default_allocator(0, ( BVH_TASKS_MAX + 1 ) * sizeof(scene_gather_bucket)),
+    p_scene->gather.task_count = 0;
+
+    // error check
+    if ( p_scene->gather.p_tasks == NULL || p_scene->gather.p_buckets == NULL ) goto no_mem;
+
+    memset(p_scene->gather.p_buckets, 0, ( BVH_TASKS_MAX + 1 ) * sizeof(scene_gather_bucket));
+
     // construct an entity list
     dict_construct(&p_scene->entities, 64, NULL, (fn_key_accessor *)entity_key_accessor, NULL);
     dict_construct(&p_scene->cameras, 64, NULL, (fn_key_accessor *)camera_key_accessor, NULL);
     dict_construct(&p_scene->lights, 64, NULL, (fn_key_accessor *)light_key_accessor, NULL);
 
+    // construct a transform hierarchy
+    transform_hierarchy_construct(&p_scene->p_transforms);
+
     // construct entities
     if ( p_entities )
     {
@@ -69,13 +91,67 @@ int scene_from_json ( scene **pp_scene, json_value *p_value )
             array_index(p_array, i, (void **)&p_value);
 
             // construct an entity from a json value
-            entity_from_json(&p_entity, p_value);
+            if ( 0 == entity_from_json(&p_entity, p_value) ) continue;
 
             // add the entity to the scene
             dict_add(p_scene->entities, p_entity);
+
+            // add the transform to the hierarchy
+            if ( p_entity->p_transform ) transform_hierarchy_add(p_scene->p_transforms, p_entity->p_transform);
+        }
+
+        // parent each entity named by another entity's "parent" property
+        for (size_t i = 0; i < len; i++)
+        {
+
+            // initialized data
+            json_value *p_value  = NULL,
+                       *p_child  = NULL,
+                       *p_parent = NULL;
+            entity *p_child_entity  = NULL,
+                   *p_parent_entity = NULL;
+
+            // get the i'th entity
+            array_index(p_array, i, (void **)&p_value);
+
+            // entities loaded from a path have no parent
+            if ( JSON_VALUE_OBJECT != p_value->type ) continue;
+
+            dict_get(p_value->object, "name"  , (void **)&p_child);
+            dict_get(p_value->object, "parent", (void **)&p_parent);
+
+            // type check
+            if ( NULL == p_parent || JSON_VALUE_STRING != p_parent->type ) continue;
+            if ( NULL == p_child  || JSON_VALUE_STRING != p_child->type  ) continue;
+
+            // find both entities
+            dict_get(p_scene->entities, p_child->string , (void **)&p_child_entity);
+            dict_get(p_scene->entities, p_parent->string, (void **)&p_parent_entity);
+
+            // error check
+            if ( NULL == p_child_entity || NULL == p_parent_entity ) 
+            {
+                #ifndef NDEBUG
+                    log_error("[g10] [scene] Entity \"%s\" has unknown parent \"%s\"\n", p_child->string, p_parent->string);
+                #endif
+
+                continue;
+            }
+
+            // attach the transforms
+            transform_set_parent(p_child_entity->p_transform, p_parent_entity->p_transform);
         }
     }
 
+    // compute the world matrices before the bounds
+    transform_hierarchy_update(p_scene->p_transforms);
+
+    // list the entities
+    dict_size(p_scene->entities, &p_scene->entity_count);
+    if ( p_scene->entity_count )
+        p_scene->pp_entities = default_allocator(0, p_scene->entity_count * sizeof(entity *)),
+        dict_values(p_scene->entities, (void **)p_scene->pp_entities, p_scene->entity_count);
+
     // construct cameras
     if ( p_cameras )
     {
@@ -141,6 +217,10 @@ int scene_from_json ( scene **pp_scene, json_value *p_value )
     // compute the scene bounds
     bv_from_scene(&p_scene->p_bounds, p_scene);
 
+    // compile the scene bounds for culling
+    if ( p_scene->p_bounds )
+        bvh_from_bv(&p_scene->p_bvh, p_scene->p_bounds);
+
     {
         g_instance *p_instance = g_active_instance();
         pipeline *p_pipeline = NULL;
@@ -156,6 +236,14 @@ int scene_from_json ( scene **pp_scene, json_value *p_value )
     return 1;
     
     no_scene: return 0;
+
+    no_mem:
+        #ifndef NDEBUG
+            log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+        #endif
+
+        // error
+        return 0;
 }
 
 int scene_info ( scene *p_scene )
@@ -170,9 +258,15 @@ int scene_info ( scene *p_scene )
     logger_push(),
     logger_pad(), printf("name - %s\n", p_scene->_name),
 
+    logger_pad(), printf("bvh    - %s\n", ( p_scene->bvh_build == BV_BUILD_LBVH ) ? "lbvh" : "sah"),
+    logger_pad(), printf("cull   - %zu visited, %zu culled, %zu plane tests, %zu drawn\n", p_scene->cull.nodes_visited, p_scene->cull.nodes_culled, p_scene->cull.planes_tested, p_scene->cull.drawables),
+    logger_pad(), printf("refit  - %zu leaves, %zu rebuilds\n", p_scene->cull.refits, p_scene->cull.rebuilds),
+    logger_pad(), printf("lookup - %zu pipeline names\n", p_scene->cull.pipeline_lookups),
+
     logger_pad(), printf("bounds: \n"),
     logger_push(),
     bv_info(p_scene->p_bounds),
+    bvh_info(p_scene->p_bvh),
     logger_pop(),
 
     logger_pad(), printf("entities: \n"),
@@ -205,35 +299,250 @@ static void clear_dynamic_list(pipeline *p_pipeline)
 {
     if ( !p_pipeline || !p_pipeline->p_dynamic_draw_list ) return;
 
-    while(array_size(p_pipeline->p_dynamic_draw_list))
-        array_remove(p_pipeline->p_dynamic_draw_list, 0, NULL);
+    draw_list_reset(p_pipeline->p_dynamic_draw_list);
 }
 
-static void bvh_gather_recursive(bv *p_bv, const vec4 planes[6], g_instance *p_instance)
+static float scene_view_depth ( scene *p_scene, bv *p_bv )
 {
-    if ( !p_bv ) return;
 
-    if ( bv_cull(p_bv, planes) ) return;
+    // initialized data
+    camera *p_camera = p_scene->p_active_camera;
+    mat4 *p_view = &p_camera->matrix._view;
+    vec3 min = { 0 }, max = { 0 }, c = { 0 };
+    float near_clip = p_camera->projection.near_clip,
+          far_clip  = p_camera->projection.far_clip,
+          depth     = 0.0f;
 
-    if ( p_bv->p_user_data )
+    if ( 0 == bv_bounds(p_bv, &min, &max) ) return 0.0f;
+
+    // the center of the bounds
+    c = (vec3) { ( min.x + max.x ) * 0.5f, ( min.y + max.y ) * 0.5f, ( min.z + max.z ) * 0.5f };
+
+    // distance along the view direction
+    depth = -( p_view->c * c.x + p_view->g * c.y + p_view->k * c.z + p_view->o );
+
+    // normalize
+    return ( far_clip > near_clip ) ? ( depth - near_clip ) / ( far_clip - near_clip ) : 0.0f;
+}
+
+static void bvh_gather_visit ( bv *p_leaf, scene *p_scene )
+{
+
+    // initialized data
+    entity *p_entity = (entity *)p_leaf->p_user_data;
+    pipeline *p_pipeline = NULL;
+    u64 key = 0;
+
+    if ( '\0' == p_entity->_pipeline_name[0] ) return;
+
+    // no string work unless the pipelines were reloaded
+    p_pipeline = pipeline_handle_get(&p_entity->_pipeline, p_entity->_pipeline_name);
+    if ( p_pipeline && p_pipeline->p_dynamic_draw_list )
     {
-        entity *p_entity = (entity *)p_bv->p_user_data;
-        if ( p_entity->pipeline )
+
+        // sort key
+        if ( p_pipeline->sort != DRAW_SORT_NONE )
+            key = draw_key(p_pipeline->sort, p_pipeline, p_entity->p_material, p_entity->p_geometry, scene_view_depth(p_scene, p_leaf));
+
+        // count the draws that were added
+        p_scene->cull.drawables += (size_t) draw_list_add(p_pipeline->p_dynamic_draw_list, p_entity, key);
+    }
+}
+
+/** !
+ * Record the draw of a visible leaf in the bucket of a gather task
+ * 
+ * @param p_leaf   the leaf
+ * @param p_bucket the bucket
+ * 
+ * @return void
+ */
+static void scene_gather_visit ( bv *p_leaf, scene_gather_bucket *p_bucket )
+{
+
+    // initialized data
+    entity *p_entity = (entity *)p_leaf->p_user_data;
+    pipeline *p_pipeline = NULL;
+    u64 key = 0;
+
+    if ( '\0' == p_entity->_pipeline_name[0] ) return;
+
+    // no string work unless the pipelines were reloaded
+    p_pipeline = pipeline_handle_get(&p_entity->_pipeline, p_entity->_pipeline_name);
+    if ( !p_pipeline || !p_pipeline->p_dynamic_draw_list ) return;
+
+    // sort key
+    if ( p_pipeline->sort != DRAW_SORT_NONE )
+        key = draw_key(p_pipeline->sort, p_pipeline, p_entity->p_material, p_entity->p_geometry, scene_view_depth(p_bucket->p_scene, p_leaf));
+
+    // grow the bucket
+    if ( p_bucket->count == p_bucket->max )
+    {
+
+        // initialized data
+        size_t max = ( p_bucket->max ) ? p_bucket->max * 2 : 64;
+        scene_draw *p_draws = default_allocator(p_bucket->p_draws, max * sizeof(scene_draw));
+
+        // error check
+        if ( p_draws == NULL ) goto no_mem;
+
+        p_bucket->p_draws = p_draws,
+        p_bucket->max     = max;
+    }
+
+    // store the draw
+    p_bucket->p_draws[p_bucket->count++] = (scene_draw)
+    {
+        .p_draw_list = p_pipeline->p_dynamic_draw_list,
+        .packet      = { .key = key, .p_drawable = p_entity }
+    };
+
+    // done
+    return;
+
+    // error handling
+    {
+
+        // standard library errors
         {
-            pipeline *p_pipeline = NULL;
-            dict_get(p_instance->cache.p_pipeline, p_entity->pipeline, (void **)&p_pipeline);
-            if ( p_pipeline && p_pipeline->p_dynamic_draw_list )
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\". \"%s\" is not drawn\n", __FUNCTION__, p_entity->_name);
+                #endif
+
+                // error
+                return;
+        }
+    }
+}
+
+/** !
+ * Cull a range of the subtrees of a gather. Each task fills its own bucket
+ * 
+ * @param p_scene the scene
+ * @param begin   the first subtree
+ * @param end     one past the last subtree
+ * 
+ * @return void
+ */
+static void scene_gather_tasks ( scene *p_scene, size_t begin, size_t end )
+{
+
+    for (size_t i = begin; i < end; i++)
+    {
+
+        // work on a copy, so tasks on other threads never share a line
+        scene_gather_bucket _bucket = p_scene->gather.p_buckets[i + 1];
+
+        // empty the bucket
+        _bucket.p_scene = p_scene,
+        _bucket.count   = 0,
+        _bucket.cull    = (bvh_cull_stats) { 0 };
+
+        // cull the subtree
+        bvh_cull_task(p_scene->p_bvh, p_scene->p_active_camera->frustum.planes, p_scene->gather.p_tasks[i], (fn_bvh_visit *)scene_gather_visit, &_bucket, &_bucket.cull);
+
+        // store
+        p_scene->gather.p_buckets[i + 1] = _bucket;
+    }
+}
+
+/** !
+ * Grow the draw list of each pipeline once, to hold the draws the gather 
+ * tasks found for it. Lists past the first SCENE_GATHER_LISTS grow as the
+ * draws are added.
+ * 
+ * @param p_scene the scene
+ * 
+ * @return void
+ */
+static void scene_gather_reserve ( scene *p_scene )
+{
+
+    // initialized data
+    struct { draw_list *p_draw_list; size_t count; } _lists[SCENE_GATHER_LISTS] = { 0 };
+    size_t list_count = 0;
+
+    // sum the draws of each list. there are few pipelines, so search
+    for (size_t i = 0; i <= p_scene->gather.task_count; i++)
+    {
+
+        // initialized data
+        scene_gather_bucket *p_bucket = &p_scene->gather.p_buckets[i];
+
+        for (size_t j = 0; j < p_bucket->count; j++)
+        {
+
+            // initialized data
+            draw_list *p_draw_list = p_bucket->p_draws[j].p_draw_list;
+            size_t k = 0;
+
+            while ( k < list_count && _lists[k].p_draw_list != p_draw_list ) k++;
+
+            // a new list
+            if ( k == list_count )
             {
-                array_add(p_pipeline->p_dynamic_draw_list, p_entity);
+                if ( list_count == SCENE_GATHER_LISTS ) continue;
+
+                _lists[list_count++].p_draw_list = p_draw_list;
             }
+
+            _lists[k].count++;
+        }
+    }
+
+    // grow each list once
+    for (size_t k = 0; k < list_count; k++)
+        if ( 0 == draw_list_reserve(_lists[k].p_draw_list, draw_list_size(_lists[k].p_draw_list) + _lists[k].count) ) 
+            goto failed_to_reserve;
+
+    // done
+    return;
+
+    // error handling
+    {
+
+        // g10 errors
+        {
+            failed_to_reserve:
+                #ifndef NDEBUG
+                    log_error("[g10] [scene] Failed to reserve draw list in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error. the lists grow as the draws are added
+                return;
+        }
+    }
+}
+
+static void bvh_gather_recursive(scene *p_scene, bv *p_bv, const vec4 planes[6], u8 mask)
+{
+    if ( !p_bv ) return;
+
+    p_scene->cull.nodes_visited++;
+
+    // test the planes the parent was not fully inside of
+    if ( mask )
+    {
+        aabb bounds = { 0 };
+
+        if ( 0 == bv_bounds(p_bv, &bounds._min, &bounds._max) ) return;
+
+        if ( aabb_cull_frustum_masked(&bounds, planes, &mask, &p_bv->_plane, &p_scene->cull.planes_tested) )
+        {
+            p_scene->cull.nodes_culled++;
+            return;
         }
     }
+
+    if ( p_bv->p_user_data )
+        bvh_gather_visit(p_bv, p_scene);
     else
     {
         for ( int i = 0; i < 4; i++ )
         {
             if ( p_bv->p_data[i] )
-                bvh_gather_recursive((bv *)p_bv->p_data[i], planes, p_instance);
+                bvh_gather_recursive(p_scene, (bv *)p_bv->p_data[i], planes, mask);
         }
     }
 }
@@ -249,28 +558,345 @@ int scene_gather_drawable
     
     // initialized data
     g_instance *p_instance = g_active_instance();
+    u64 lookups = pipeline_lookup_count();
     
-    // Clear all dynamic draw lists
+    // Reset all dynamic draw lists
     if ( p_instance->cache.p_pipeline )
         dict_foreach(p_instance->cache.p_pipeline, (fn_foreach *)clear_dynamic_list);
 
-    if ( p_scene->p_active_camera && p_scene->p_bounds )
+    // reset the cull metrics
+    p_scene->cull.nodes_visited = 0,
+    p_scene->cull.nodes_culled  = 0,
+    p_scene->cull.planes_tested = 0,
+    p_scene->cull.drawables     = 0;
+
+    // bring the world matrices up to date, and mark the bounds built from
+    // an older version. a still frame does neither
+    if ( transform_hierarchy_update(p_scene->p_transforms) && p_scene->pp_entities )
+        for (size_t i = 0; i < p_scene->entity_count; i++)
+            if ( p_scene->pp_entities[i]->_version.bounds != transform_version(p_scene->pp_entities[i]->p_transform) )
+                scene_entity_moved(p_scene, p_scene->pp_entities[i]);
+
+    // bring the hierarchy up to date
+    if ( p_scene->dirty.count ) scene_refit(p_scene);
+
+    // cull the compiled hierarchy in parallel
+    if ( p_scene->p_active_camera && p_scene->p_bvh )
+    {
+
+        // initialized data
+        scene_gather_bucket *p_split = &p_scene->gather.p_buckets[0];
+        bvh_cull_stats _stats = { 0 };
+
+        // split the top of the hierarchy. leaves above the split go in the
+        // first bucket
+        p_split->p_scene = p_scene,
+        p_split->count   = 0,
+        p_split->cull    = (bvh_cull_stats) { 0 };
+
+        p_scene->gather.task_count = bvh_cull_split(p_scene->p_bvh, p_scene->p_active_camera->frustum.planes, p_scene->gather.p_tasks, SCENE_GATHER_TASKS, (fn_bvh_visit *)scene_gather_visit, p_split, &p_split->cull);
+
+        // cull the subtrees. there are many more subtrees than threads, and 
+        // each thread claims the next one when it finishes, so uneven 
+        // subtrees balance out
+        job_parallel_for(p_scene->gather.task_count, 1, (fn_job_range *)scene_gather_tasks, p_scene);
+
+        // count the draws of each draw list, and grow each list once
+        scene_gather_reserve(p_scene);
+
+        // merge the buckets in order
+        for (size_t i = 0; i <= p_scene->gather.task_count; i++)
+        {
+
+            // initialized data
+            scene_gather_bucket *p_bucket = &p_scene->gather.p_buckets[i];
+
+            // count the draws that were added
+            for (size_t j = 0; j < p_bucket->count; j++)
+                p_scene->cull.drawables += (size_t) draw_list_add(p_bucket->p_draws[j].p_draw_list, p_bucket->p_draws[j].packet.p_drawable, p_bucket->p_draws[j].packet.key);
+
+            // accumulate the metrics
+            _stats.nodes_visited  += p_bucket->cull.nodes_visited,
+            _stats.nodes_culled   += p_bucket->cull.nodes_culled,
+            _stats.planes_tested  += p_bucket->cull.planes_tested;
+        }
+
+        // store the metrics
+        p_scene->p_bvh->cull = _stats;
+
+        p_scene->cull.nodes_visited = _stats.nodes_visited,
+        p_scene->cull.nodes_culled  = _stats.nodes_culled,
+        p_scene->cull.planes_tested = _stats.planes_tested;
+    }
+
+    // fall back to the pointer hierarchy
+    else if ( p_scene->p_active_camera && p_scene->p_bounds )
     {
-        bvh_gather_recursive(p_scene->p_bounds, p_scene->p_active_camera->frustum.planes, p_instance);
+        bvh_gather_recursive(p_scene, p_scene->p_bounds, p_scene->p_active_camera->frustum.planes, BVH_PLANES_ALL);
     }
 
-    if ( p_scene->p_skybox && p_scene->p_skybox->pipeline )
+    if ( p_scene->p_skybox && p_scene->p_skybox->_pipeline_name[0] )
     {
-        pipeline *p_pipeline = NULL;
-        dict_get(p_instance->cache.p_pipeline, p_scene->p_skybox->pipeline, (void **)&p_pipeline);
+        pipeline *p_pipeline = pipeline_handle_get(&p_scene->p_skybox->_pipeline, p_scene->p_skybox->_pipeline_name);
         if ( p_pipeline && p_pipeline->p_dynamic_draw_list )
         {
-            array_add(p_pipeline->p_dynamic_draw_list, p_scene->p_skybox);
+            draw_list_add(p_pipeline->p_dynamic_draw_list, p_scene->p_skybox, 0);
         }
     }
 
+    // pipeline name lookups. zero unless the pipelines were reloaded
+    p_scene->cull.pipeline_lookups = (size_t) ( pipeline_lookup_count() - lookups );
+
     // done
     return 1;
 
     no_scene: return 0;
 }
+
+int scene_entity_moved ( scene *p_scene, entity *p_entity )
+{
+
+    // argument check
+    if ( NULL == p_scene  ) goto no_scene;
+    if ( NULL == p_entity ) goto no_entity;
+
+    // initialized data
+    bv *p_leaf = p_entity->p_bounds;
+
+    // already marked, or not in the hierarchy
+    if ( NULL == p_leaf || p_leaf->_dirty ) return 1;
+
+    // grow the dirty list
+    if ( p_scene->dirty.count == p_scene->dirty.max )
+    {
+        size_t max = ( p_scene->dirty.max ) ? p_scene->dirty.max * 2 : 64;
+        bv **pp_leaves = default_allocator(p_scene->dirty.pp_leaves, max * sizeof(bv *));
+
+        // error check
+        if ( NULL == pp_leaves ) goto no_mem;
+
+        p_scene->dirty.pp_leaves = pp_leaves;
+
+        // the batch scratch. the boxes are rebuilt each refit, so nothing is copied
+        {
+
+            // initialized data
+            mat4  *p_world = default_allocator(p_scene->dirty.p_world, max * sizeof(mat4));
+            float *p_boxes = NULL;
+
+            // error check
+            if ( NULL == p_world ) goto no_mem;
+
+            p_scene->dirty.p_world = p_world;
+
+            // allocate the boxes
+            p_boxes = default_allocator(p_scene->dirty.p_boxes, max * 6 * sizeof(float));
+
+            // error check
+            if ( NULL == p_boxes ) goto no_mem;
+
+            p_scene->dirty.p_boxes = p_boxes;
+        }
+
+        p_scene->dirty.max = max;
+    }
+
+    // mark the leaf
+    p_leaf->_dirty = true;
+    p_scene->dirty.pp_leaves[p_scene->dirty.count++] = p_leaf;
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_scene:
+                #ifndef NDEBUG
+                    log_error("[g10] [scene] Null pointer provided for parameter \"p_scene\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_entity:
+                #ifndef NDEBUG
+                    log_error("[g10] [scene] Null pointer provided for parameter \"p_entity\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+// the entity of a leaf that bv_entity_resize would size from its geometry
+// and world matrix, or null if the leaf resizes some other way
+static entity *scene_refit_entity ( bv *p_leaf )
+{
+
+    // initialized data
+    entity *p_entity = p_leaf->p_user_data;
+
+    // not an entity leaf
+    if ( bv_entity_resize != p_leaf->pfn_resize || NULL == p_entity || NULL == p_leaf->p_data[0] ) return NULL;
+
+    // nothing to bound
+    if ( NULL == p_entity->p_geometry || NULL == p_entity->p_geometry->p_bounds || NULL == p_entity->p_transform ) return NULL;
+
+    // done
+    return p_entity;
+}
+
+int scene_refit ( scene *p_scene )
+{
+
+    // argument check
+    if ( NULL == p_scene ) goto no_scene;
+
+    // initialized data
+    bv **pp_dirty = p_scene->dirty.pp_leaves,
+        *p_root = p_scene->p_bounds;
+    size_t count = p_scene->dirty.count, degraded = 0, batched = 0;
+    float *p_boxes = p_scene->dirty.p_boxes;
+    size_t max = p_scene->dirty.max;
+    aabb_soa _boxes = 
+    {
+        .p_cx = &p_boxes[0 * max], .p_cy = &p_boxes[1 * max], .p_cz = &p_boxes[2 * max],
+        .p_ex = &p_boxes[3 * max], .p_ey = &p_boxes[4 * max], .p_ez = &p_boxes[5 * max]
+    };
+
+    // gather the geometry bounds and world matrix of each entity leaf. other
+    // leaves resize themselves
+    for ( size_t i = 0; i < count; i++ )
+    {
+
+        // initialized data
+        entity *p_entity = scene_refit_entity(pp_dirty[i]);
+
+        if ( NULL == p_entity ) { bv_resize(pp_dirty[i]); continue; }
+
+        aabb_soa_set(_boxes, batched, (aabb *) p_entity->p_geometry->p_bounds->p_data[0]);
+        transform_get_matrix_world(p_entity->p_transform, &p_scene->dirty.p_world[batched]);
+        batched++;
+    }
+
+    // move every entity's bounds into the world at once
+    aabb_transform_batch(&_boxes, p_scene->dirty.p_world, _boxes, batched);
+
+    // store the bounds in the same order they were gathered
+    for ( size_t i = 0, j = 0; i < count; i++ )
+    {
+
+        // initialized data
+        entity *p_entity = scene_refit_entity(pp_dirty[i]);
+
+        if ( NULL == p_entity ) continue;
+
+        aabb_soa_get((aabb *) pp_dirty[i]->p_data[0], _boxes, j++);
+        p_entity->_version.bounds = transform_version(p_entity->p_transform);
+    }
+
+    // refit each leaf to root path
+    for ( size_t i = 0; i < count; i++ )
+    {
+
+        // initialized data
+        bv *p_leaf = pp_dirty[i],
+           *p_degraded = NULL;
+
+        p_leaf->_dirty = false;
+
+        bv_refit(p_leaf, SCENE_REFIT_LIMIT, &p_degraded);
+
+        // the consumed slots are reused for the degraded subtrees
+        if ( p_degraded && !p_degraded->_dirty )
+            p_degraded->_dirty = true,
+            pp_dirty[degraded++] = p_degraded;
+    }
+
+    p_scene->cull.refits = count;
+    p_scene->cull.rebuilds = 0;
+    p_scene->dirty.count = 0;
+
+    // drop subtrees that are inside another degraded subtree. the outermost
+    // subtree stays marked, so it is still found above the ones cleared here
+    for ( size_t i = 0; i < degraded; i++ )
+        for ( bv *p_bv = pp_dirty[i]->p_parent; p_bv; p_bv = p_bv->p_parent )
+            if ( p_bv->_dirty ) { pp_dirty[i]->_dirty = false, pp_dirty[i] = NULL; break; }
+
+    // rebuild the rest
+    for ( size_t i = 0; i < degraded; i++ )
+    {
+        if ( NULL == pp_dirty[i] ) continue;
+
+        if ( bv_rebuild(&p_scene->p_bounds, pp_dirty[i], p_scene->bvh_build) ) 
+            p_scene->cull.rebuilds++;
+        else
+            pp_dirty[i]->_dirty = false;
+    }
+
+    // the root was rebuilt
+    if ( p_root != p_scene->p_bounds )
+    {
+
+        // initialized data
+        g_instance *p_instance = g_active_instance();
+        pipeline *p_pipeline = NULL;
+
+        // replace the root on the debug draw list
+        dict_get(p_instance->cache.p_pipeline, "aabb", (void **)&p_pipeline);
+        if ( p_pipeline )
+        {
+            for ( size_t i = 0; i < array_size(p_pipeline->p_static_draw_list); i++ )
+            {
+                void *p_item = NULL;
+
+                array_index(p_pipeline->p_static_draw_list, i, &p_item);
+                if ( p_item == p_root ) { array_remove(p_pipeline->p_static_draw_list, i, NULL); break; }
+            }
+
+            array_add(p_pipeline->p_static_draw_list, p_scene->p_bounds);
+        }
+    }
+
+    // the topology changed, so recompile
+    if ( p_scene->cull.rebuilds )
+        bvh_destroy(&p_scene->p_bvh),
+        bvh_from_bv(&p_scene->p_bvh, p_scene->p_bounds);
+
+    // the topology is unchanged, so refit in place
+    else if ( p_scene->p_bvh )
+        bvh_refit(p_scene->p_bvh);
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_scene:
+                #ifndef NDEBUG
+                    log_error("[g10] [scene] Null pointer provided for parameter \"p_scene\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
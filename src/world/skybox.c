@@ -2,6 +2,7 @@
 #include <camera.h>
 #include <uniform.h>
 #include <sampler.h>
+#include <pipeline.h>
 
 // external functions
 extern int g_sdl3_texture_load ( texture **pp_texture, const char *p_path );
@@ -42,8 +43,11 @@ int skybox_from_json ( skybox **pp_skybox, json_value *p_value )
     if ( p_geometry )
         g_sdl3_geometry_from_json(&p_skybox->p_geometry, p_geometry);
 
+    // keep the pipeline name, and resolve it. a pipeline that is missing now
+    // is found after the next reload
     if ( p_pipeline_name )
-        p_skybox->pipeline = p_pipeline_name->string;
+        strncpy(p_skybox->_pipeline_name, p_pipeline_name->string, 63),
+        pipeline_handle_get(&p_skybox->_pipeline, p_skybox->_pipeline_name);
 
     *pp_skybox = p_skybox;
     return 1;
@@ -60,15 +64,7 @@ int skybox_bind ( render_pass *p_render_pass, pipeline *p_pipeline, void *p_draw
 
     if ( p_skybox->p_texture && p_sampler )
     {
-        SDL_BindGPUFragmentSamplers(
-            p_render_pass->p_handle,
-            p_sampler->idx, 
-            &(SDL_GPUTextureSamplerBinding){
-                .sampler = p_sampler->p_handle,
-                .texture = p_skybox->p_texture->p_handle
-            },
-            1
-        );
+        command_bind_sampler(p_render_pass, p_sampler->idx, p_skybox->p_texture->p_handle, p_sampler->p_handle);
     }
 
     // Bind geometry
@@ -83,9 +79,9 @@ int skybox_draw ( render_pass *p_render_pass, pipeline *p_pipeline, void *p_draw
     if ( !p_skybox || !p_skybox->p_geometry ) return 0;
 
     if ( p_skybox->p_geometry->p_index_handle )
-        SDL_DrawGPUIndexedPrimitives(p_render_pass->p_handle, p_skybox->p_geometry->index_count * 3, 1, 0, 0, 0);
+        command_draw_indexed(p_render_pass, p_skybox->p_geometry->index_count * 3, 1);
     else
-        SDL_DrawGPUPrimitives(p_render_pass->p_handle, p_skybox->p_geometry->vertex_count, 1, 0, 0);
+        command_draw(p_render_pass, p_skybox->p_geometry->vertex_count, 1);
 
     return 1;
 }
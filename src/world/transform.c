@@ -2,6 +2,60 @@
 #include <transform.h>
 #include <aabb.h>
 
+// standard library
+#include <stdatomic.h>
+
+// g10
+#include <job.h>
+
+// data
+static _Atomic(u64) _transform_epoch = 0;
+
+// function definitions
+/** !
+ * Record a change to a transform. The transform takes the next version of
+ * every transform, so the maximum over a chain of ancestors only grows.
+ * 
+ * @param p_transform the transform
+ * 
+ * @return void
+ */
+static void transform_changed ( transform *p_transform )
+{
+    p_transform->version = atomic_fetch_add_explicit(&_transform_epoch, 1, memory_order_relaxed) + 1,
+    p_transform->dirty   = true;
+}
+
+/** !
+ * Record a change to the state of a transform. The first change of a tick 
+ * stores the state the tick started from. A change outside a tick is not
+ * blended, so the transform snaps to its new state.
+ * 
+ * @param p_transform the transform
+ * 
+ * @return void
+ */
+static void transform_moved ( transform *p_transform )
+{
+
+    // outside a tick
+    if ( p_transform->p_hierarchy == (void *) 0 || p_transform->p_hierarchy->ticking == false )
+    {
+        p_transform->moving = false;
+
+        return;
+    }
+
+    // moved earlier in this tick
+    if ( p_transform->moving ) return;
+
+    // store the current state
+    p_transform->previous.location    = p_transform->location,
+    p_transform->previous.orientation = p_transform->orientation,
+    p_transform->previous.scale       = p_transform->scale,
+    p_transform->moving               = true;
+}
+
 int transform_create ( transform **pp_transform )
 {
 
@@ -17,6 +71,9 @@ int transform_create ( transform **pp_transform )
     // initialize
     memset(p_transform, 0, sizeof(transform));
 
+    // no world matrix yet
+    transform_changed(p_transform);
+
     // return a pointer to the caller
     *pp_transform = p_transform;
 
@@ -69,16 +126,19 @@ int transform_construct (
     _transform = (transform)
     {
         .location   = location,
-        .rotation   = rotation,
         .scale      = scale,
         .model      = { 0 },
+        .p_parent   = p_parent
     };
 
+    // compute the orientation
+    quaternion_from_euler(&_transform.orientation, rotation);
+
     // compute the model matrix
-    mat4_model_from_vec3(
+    mat4_model_from_quaternion(
         &_transform.model,
         _transform.location,
-        _transform.rotation,
+        _transform.orientation,
         _transform.scale
     );
 
@@ -88,6 +148,9 @@ int transform_construct (
     // copy the transform from the stack to the heap
     memcpy(p_transform, &_transform, sizeof(transform));
 
+    // a new version
+    transform_changed(p_transform);
+
     // return a pointer to the caller
     *pp_transform = p_transform;
 
@@ -229,7 +292,8 @@ int transform_from_json
     size_t i = 0;
     transform *p_transform = (void *) 0;
     transform _transform = { 0 };
-    vec3 location, rotation, scale;
+    vec3 location, rotation = { 0 }, scale;
+    quaternion orientation = { 0 };
     mat4 model;
     dict *const p_dict = p_value->object;
     json_value *p_scratch[4] = { 0 };
@@ -251,6 +315,8 @@ int transform_from_json
     // type check
     if ( p_location->type != JSON_VALUE_ARRAY ) goto wrong_location_type;
     if ( p_scale->type    != JSON_VALUE_ARRAY ) goto wrong_scale_type;
+    if ( p_rotation   && p_rotation->type   != JSON_VALUE_ARRAY ) goto wrong_rotation_type;
+    if ( p_quaternion && p_quaternion->type != JSON_VALUE_ARRAY ) goto wrong_quaternion_type;
 
     // parse the location
     {
@@ -281,7 +347,39 @@ int transform_from_json
         };
     }
 
+    // parse the quaternion. it takes precedence over the euler rotation
+    if ( p_quaternion )
+    {
+
+        // initialized data
+        array *p_array = p_quaternion->list;
+        size_t len     = array_size(p_array);
+
+        // error check
+        if ( len != 4 ) goto wrong_quaternion_len;
+
+        // dump the quaternion values
+        array_slice(p_array, (void **) &p_scratch, 0, 3);
+
+        // error check
+        for ( i = 0; i < len; i++ ) 
+        {
+            if ( p_scratch[i]       ==        (void *) 0 ) goto quaternion_element_was_wrong_type;
+            if ( p_scratch[i]->type != JSON_VALUE_NUMBER ) goto quaternion_element_was_wrong_type;  
+        }
+
+        // store the quaternion, [ u, i, j, k ]
+        quaternion_normalize(&orientation, (quaternion)
+        {
+            .u = (float) p_scratch[0]->number,
+            .i = (float) p_scratch[1]->number,
+            .j = (float) p_scratch[2]->number,
+            .k = (float) p_scratch[3]->number
+        });
+    }
+
     // parse the rotation
+    else
     {
 
         // initialized data
@@ -289,9 +387,9 @@ int transform_from_json
         size_t len     = array_size(p_array);
 
         // error check
-        if ( len != 3 ) goto wrong_location_len;
+        if ( len != 3 ) goto wrong_rotation_len;
 
-        // dump the location values
+        // dump the rotation values
         array_slice(p_array, (void **) &p_scratch, 0, 2);
 
         // error check
@@ -308,6 +406,9 @@ int transform_from_json
             .y = (float) p_scratch[1]->number,
             .z = (float) p_scratch[2]->number                
         };
+
+        // compute the orientation
+        quaternion_from_euler(&orientation, rotation);
     }
     
     // parse the scale
@@ -340,15 +441,15 @@ int transform_from_json
     }       
         
     // calculate the model matrix
-    mat4_model_from_vec3(&model, location, rotation, scale);
+    mat4_model_from_quaternion(&model, location, orientation, scale);
 
     // construct a transform
     _transform = (transform)
     {
-        .location = location,
-        .rotation = rotation,
-        .scale    = scale,
-        .model    = model
+        .location    = location,
+        .orientation = orientation,
+        .scale       = scale,
+        .model       = model
     };
 
     // allocate memory for transform
@@ -360,6 +461,9 @@ int transform_from_json
     // copy the transform 
     memcpy(p_transform, &_transform, sizeof(transform));
 
+    // a new version
+    transform_changed(p_transform);
+
     // done
     done:
 
@@ -497,6 +601,33 @@ int transform_from_json
                 // error
                 return 0;
 
+            wrong_quaternion_type:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] \"quaternion\" property of transform object must be of type [ array ] in call to function \"%s\"\n", __FUNCTION__);
+                    log_info("\tRefer to gschema: https://schema.g10.app/transform.json\n");
+                #endif
+
+                // error
+                return 0;
+
+            wrong_quaternion_len:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Property \"quaternion\" of parameter \"p_value\" must be of length 4 in call to function \"%s\"\n", __FUNCTION__);
+                    log_info("\tRefer to gschema: https://schema.g10.app/transform.json\n");
+                #endif
+
+                // error
+                return 0;
+
+            quaternion_element_was_wrong_type:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Element %d of \"quaternion\" property of \"p_value\" parameter must be of type [ number ] in call to function \"%s\"\n", i, __FUNCTION__);
+                    log_info("\tRefer to gschema: https://schema.g10.app/transform.json\n");
+                #endif
+
+                // error
+                return 0;
+
             wrong_scale_type:
                 #ifndef NDEBUG
                     log_error("[g10] [transform] \"scale\" property of transform object must be of type [ array ] in call to function \"%s\"\n", __FUNCTION__);
@@ -591,13 +722,27 @@ int transform_get_matrix_world_recursive (
     // base case
     if ( p_transform == (void *) 0 ) goto no_transform;
 
-    // initialized data
-    mat4 parent_model = { 0 };
+    // root
+    if ( p_transform->p_parent == (void *) 0 )
+    {
+        
+        // copy the local matrix
+        memcpy(p_model_matrix, &p_transform->model, sizeof(mat4));
+    }
+
+    // child
+    else
+    {
+
+        // initialized data
+        mat4 parent_model = { 0 };
 
-    //transform_get_matrix_world_recursive(p_transform->parent_model, &parent_model)
+        // world matrix of the parent
+        transform_get_matrix_world_recursive(p_transform->p_parent, &parent_model);
 
-    // apply the transform
-    mat4_mul_mat4(p_model_matrix, parent_model, p_transform->model);
+        // apply the transform
+        mat4_mul_mat4_affine(p_model_matrix, parent_model, p_transform->model);
+    }
 
     // success
     return 1;
@@ -637,17 +782,15 @@ int transform_get_matrix_world (
     if ( p_transform    == (void *) 0 ) goto no_transform;
     if ( p_model_matrix == (void *) 0 ) goto no_return;
 
-    // initialized data
-    mat4 matrix_world = { 0 };
-
-    // identity matrix
-    mat4_identity(&matrix_world);
-
-    // recursively build the world matrix
-    transform_get_matrix_world_recursive(p_transform, &matrix_world);
+    // copy the cached world matrix, if transform_hierarchy_update built it 
+    // from the current version
+    if ( p_transform->world_version == transform_version(p_transform) )
+        memcpy(p_model_matrix, &p_transform->world, sizeof(mat4));
 
-    // copy the local matrix
-    memcpy(p_model_matrix, &p_transform->model, sizeof(mat4));
+    // otherwise apply each parent, and leave the cache alone. nothing is 
+    // written, so draws on other threads can read the same transform
+    else
+        transform_get_matrix_world_recursive(p_transform, p_model_matrix);
 
     // success
     return 1;
@@ -677,32 +820,248 @@ int transform_get_matrix_world (
     }
 }
 
+u64 transform_version ( const transform *p_transform )
+{
+
+    // initialized data
+    u64 version = 0;
+
+    // the newest change along the chain
+    for (const transform *p = p_transform; p; p = p->p_parent)
+        if ( p->version > version ) version = p->version;
+
+    // done
+    return version;
+}
+
+int transform_set_parent ( transform *p_transform, transform *p_parent )
+{
+
+    // argument check
+    if ( p_transform == (void *) 0 ) goto no_transform;
+
+    // a transform can not be its own ancestor
+    for (transform *p = p_parent; p; p = p->p_parent)
+        if ( p == p_transform ) goto cycle;
+
+    // store the parent
+    p_transform->p_parent = p_parent;
+
+    // the world matrix is stale
+    transform_changed(p_transform);
+
+    // the order of the hierarchy is stale
+    if ( p_transform->p_hierarchy )
+    {
+        p_transform->p_hierarchy->sorted = false;
+
+        // the new ancestors join the hierarchy
+        if ( p_parent && 0 == transform_hierarchy_add(p_transform->p_hierarchy, p_parent) ) goto failed_to_add_parent;
+    }
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_transform:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Null pointer provided for parameter \"p_transform\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            cycle:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Parameter \"p_parent\" is a descendant of parameter \"p_transform\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // g10 errors
+        {
+            failed_to_add_parent:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Failed to add parent to hierarchy in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int transform_set_location ( transform *p_transform, vec3 location )
+{
+
+    // argument check
+    if ( p_transform == (void *) 0 ) goto no_transform;
+
+    // store the location
+    transform_moved(p_transform);
+    p_transform->location = location;
+
+    // update the model matrix
+    mat4_model_from_quaternion(
+        &p_transform->model,
+        p_transform->location,
+        p_transform->orientation,
+        p_transform->scale
+    );
+
+    // the world matrix is stale
+    transform_changed(p_transform);
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_transform:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Null pointer provided for parameter \"p_transform\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int transform_set_scale ( transform *p_transform, vec3 scale )
+{
+
+    // argument check
+    if ( p_transform == (void *) 0 ) goto no_transform;
+
+    // store the scale
+    transform_moved(p_transform);
+    p_transform->scale = scale;
+
+    // update the model matrix
+    mat4_model_from_quaternion(
+        &p_transform->model,
+        p_transform->location,
+        p_transform->orientation,
+        p_transform->scale
+    );
+
+    // the world matrix is stale
+    transform_changed(p_transform);
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_transform:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Null pointer provided for parameter \"p_transform\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int transform_set_rotation ( transform *p_transform, quaternion rotation )
+{
+
+    // argument check
+    if ( p_transform == (void *) 0 ) goto no_transform;
+
+    // store the orientation
+    transform_moved(p_transform);
+    p_transform->orientation = rotation;
+
+    // update the model matrix
+    mat4_model_from_quaternion(
+        &p_transform->model,
+        p_transform->location,
+        p_transform->orientation,
+        p_transform->scale
+    );
+
+    // the world matrix is stale
+    transform_changed(p_transform);
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_transform:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Null pointer provided for parameter \"p_transform\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int transform_rotate ( transform *p_transform, quaternion delta )
+{
+
+    // argument check
+    if ( p_transform == (void *) 0 ) goto no_transform;
+
+    // initialized data
+    quaternion orientation = { 0 };
+
+    // apply the delta, then renormalize so rounding doesn't accumulate
+    quaternion_mul_quaternion(&orientation, delta, p_transform->orientation);
+    quaternion_normalize(&orientation, orientation);
+
+    // store the orientation, and update the model matrix
+    return transform_set_rotation(p_transform, orientation);
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_transform:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Null pointer provided for parameter \"p_transform\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
 int transform_bind ( render_pass *p_render_pass, pipeline *p_pipeline, transform *p_transform )
 {
      
     // initialized data
     uniform *p_m   = (void *) 0;
     uniform *p_inv = (void *) 0;
-    transform *p_iter = p_transform;
     mat4 _accumulator = { 0 };
 
-    // initialize 
-    mat4_identity(&_accumulator);
-
     // get the transform uniform
     array_index(p_pipeline->p_uniforms, 1, (void **)&p_m);
     
-    while ( p_iter )
-    {
-        mat4 _temp = { 0 };
-
-        // accumulator = parent * accumulator
-        mat4_mul_mat4(&_temp, p_iter->model, _accumulator);
-        _accumulator = _temp;
-
-        p_iter = p_iter->p_parent;
-    }
-
+    // world matrix
+    transform_get_matrix_world(p_transform, &_accumulator);
     
     // bind model matrix
     if ( p_m ) uniform_set_pack_push(p_m, &_accumulator, (fn_pack *)mat4_pack);
@@ -710,9 +1069,10 @@ int transform_bind ( render_pass *p_render_pass, pipeline *p_pipeline, transform
     // bind inv normal matrix
     if ( array_index(p_pipeline->p_uniforms, 0, (void **)&p_inv) )
     {
-        mat4 inv = { 0 }, inv_trans = { 0 };
-        mat4_inverse(&inv, _accumulator);
-        mat4_transpose(&inv_trans, inv);
+        mat3 normal = { 0 };
+        mat4 inv_trans = { 0 };
+        mat4_normal_matrix(&normal, _accumulator);
+        mat3_to_mat4(&inv_trans, normal);
         uniform_set_pack_push(p_inv, &inv_trans, (fn_pack *)mat4_pack);
     }
     
@@ -722,11 +1082,18 @@ int transform_bind ( render_pass *p_render_pass, pipeline *p_pipeline, transform
 int transform_info ( transform *p_transform )
 {
 
+    // initialized data
+    vec3 rotation = { 0 };
+
+    // the euler angles are derived from the orientation
+    quaternion_to_euler(&rotation, p_transform->orientation);
+
     logger_pad(), log_info("Transform @%p\n", p_transform);
 
     logger_push(),
     logger_pad(), printf("location - [ %.2f, %.2f, %.2f ]\n", p_transform->location.x, p_transform->location.y, p_transform->location.z);
-    logger_pad(), printf("rotation - [ %.2f, %.2f, %.2f ]\n", p_transform->rotation.x, p_transform->rotation.y, p_transform->rotation.z);
+    logger_pad(), printf("rotation - [ %.2f, %.2f, %.2f ]\n", rotation.x, rotation.y, rotation.z);
+    logger_pad(), printf("quat     - [ %.3f, %.3f, %.3f, %.3f ]\n", p_transform->orientation.u, p_transform->orientation.i, p_transform->orientation.j, p_transform->orientation.k);
     logger_pad(), printf("scale    - [ %.2f, %.2f, %.2f ]\n", p_transform->scale.x, p_transform->scale.y, p_transform->scale.z);
     logger_pop();
 
@@ -741,6 +1108,10 @@ int transform_pack ( void *p_buffer, transform *p_transform )
 
     // initialized data 
     char *p = p_buffer;
+    vec3 rotation = { 0 };
+
+    // the orientation is authoritative; the format stores euler angles
+    quaternion_to_euler(&rotation, p_transform->orientation);
 
     // pack the location
     p += pack_pack(p, "%3f32", 
@@ -751,9 +1122,9 @@ int transform_pack ( void *p_buffer, transform *p_transform )
 
     // pack the rotation
     p += pack_pack(p, "%3f32",
-        p_transform->rotation.x,
-        p_transform->rotation.y,
-        p_transform->rotation.z
+        rotation.x,
+        rotation.y,
+        rotation.z
     );
 
     // pack the scale
@@ -800,6 +1171,7 @@ int transform_unpack ( transform **pp_transform, void *p_buffer )
     // initialized data 
     transform *p_transform = NULL;
     char *p = p_buffer;
+    vec3 rotation = { 0 };
 
     transform_create(&p_transform);
 
@@ -812,9 +1184,9 @@ int transform_unpack ( transform **pp_transform, void *p_buffer )
 
     // unpack the rotation
     p += pack_unpack(p, "%3f32",
-        p_transform->rotation.x,
-        p_transform->rotation.y,
-        p_transform->rotation.z
+        rotation.x,
+        rotation.y,
+        rotation.z
     );
 
     // unpack the scale
@@ -824,11 +1196,14 @@ int transform_unpack ( transform **pp_transform, void *p_buffer )
         p_transform->scale.z
     );
 
+    // compute the orientation
+    quaternion_from_euler(&p_transform->orientation, rotation);
+
     // compute the model matrix
-    mat4_model_from_vec3(
+    mat4_model_from_quaternion(
         &p_transform->model,
         p_transform->location,
-        p_transform->rotation,
+        p_transform->orientation,
         p_transform->scale
     );
 
@@ -863,15 +1238,385 @@ int transform_unpack ( transform **pp_transform, void *p_buffer )
 }
 
 
-int transform_from_aabb ( transform *p_transform, aabb *p_aabb )
+/** !
+ * Find the slot of a transform in an open addressed table of transforms
+ * 
+ * @param pp_keys     the table
+ * @param mask        one less than the quantity of slots, a power of two
+ * @param p_transform the transform
+ * 
+ * @return the slot holding the transform, or the empty slot it belongs in
+ */
+static size_t transform_table_find ( const transform **pp_keys, size_t mask, const transform *p_transform )
 {
 
-    // argument check
-    if ( p_transform == (void *) 0 ) goto no_transform;
+    // initialized data
+    u64 h = (u64) (uintptr_t) p_transform;
+
+    // mix the bits of the address
+    h ^= h >> 33,
+    h *= 0xff51afd7ed558ccdULL,
+    h ^= h >> 33;
+
+    // probe
+    for (h &= mask; pp_keys[h] && pp_keys[h] != p_transform; h = ( h + 1 ) & mask);
+
+    // done
+    return (size_t) h;
+}
+
+size_t transform_pack_many ( void *p_buffer, transform *const *pp_transforms, size_t count )
+{
+
+    // argument check
+    if ( pp_transforms == (void *) 0 && count ) goto no_transforms;
+    if ( count >= TRANSFORM_RECORD_ROOT       ) goto too_many_transforms;
+
+    // initialized data
+    size_t                  size      = sizeof(transform_stream_header) + count * sizeof(transform_record),
+                            mask      = 0;
+    transform_stream_header _header   = { 0 };
+    transform_record       *p_records = (transform_record *) ((char *) p_buffer + sizeof(transform_stream_header));
+    const transform       **pp_keys   = (void *) 0;
+    u32                    *p_values  = (void *) 0;
+
+    // size only
+    if ( p_buffer == (void *) 0 ) return size;
+
+    // parents in a hierarchy are found by their index. anything else needs
+    // a table of transforms to indices
+    for (size_t i = 0; i < count; i++)
+    {
+
+        // initialized data
+        const transform *p_parent = pp_transforms[i]->p_parent;
+
+        // found by index
+        if ( p_parent == (void *) 0 ) continue;
+        if ( p_parent->_index < count && pp_transforms[p_parent->_index] == p_parent ) continue;
+
+        // at least half empty
+        for (mask = 1; mask < count * 2; mask <<= 1);
+
+        // allocate the table
+        pp_keys  = default_allocator(0, mask * sizeof(transform *));
+        p_values = default_allocator(0, mask * sizeof(u32));
+
+        // error check
+        if ( pp_keys == (void *) 0 || p_values == (void *) 0 ) goto no_mem;
+
+        // populate the table
+        memset(pp_keys, 0, mask * sizeof(transform *));
+        mask--;
+
+        for (size_t j = 0; j < count; j++)
+        {
+
+            // initialized data
+            size_t h = transform_table_find(pp_keys, mask, pp_transforms[j]);
+
+            // store
+            pp_keys[h]  = pp_transforms[j],
+            p_values[h] = (u32) j;
+        }
+
+        // done
+        break;
+    }
+
+    // write the header
+    _header = (transform_stream_header)
+    {
+        .magic       = TRANSFORM_STREAM_MAGIC,
+        .version     = TRANSFORM_STREAM_VERSION,
+        .header_size = sizeof(transform_stream_header),
+        .record_size = sizeof(transform_record),
+        .count       = count
+    };
+    memcpy(p_buffer, &_header, sizeof(transform_stream_header));
+
+    // write the records
+    for (size_t i = 0; i < count; i++)
+    {
+
+        // initialized data
+        const transform  *p_transform = pp_transforms[i],
+                         *p_parent    = p_transform->p_parent;
+        transform_record  _record     =
+        {
+            .location    = { p_transform->location.x, p_transform->location.y, p_transform->location.z },
+            .orientation = { p_transform->orientation.u, p_transform->orientation.i, p_transform->orientation.j, p_transform->orientation.k },
+            .scale       = { p_transform->scale.x, p_transform->scale.y, p_transform->scale.z },
+            .parent      = TRANSFORM_RECORD_ROOT
+        };
+
+        // find the parent. parents outside the array are written as roots
+        if ( p_parent )
+        {
+            if ( p_parent->_index < count && pp_transforms[p_parent->_index] == p_parent )
+                _record.parent = (u32) p_parent->_index;
+            else if ( pp_keys )
+            {
+
+                // initialized data
+                size_t h = transform_table_find(pp_keys, mask, p_parent);
+
+                if ( pp_keys[h] ) _record.parent = p_values[h];
+            }
+        }
+
+        // store
+        memcpy(&p_records[i], &_record, sizeof(transform_record));
+    }
+
+    // release the table
+    if ( pp_keys ) pp_keys  = default_allocator(pp_keys, 0),
+                   p_values = default_allocator(p_values, 0);
+
+    // success
+    return size;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_transforms:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Null pointer provided for parameter \"pp_transforms\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            too_many_transforms:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Parameter \"count\" must be less than %u in call to function \"%s\"\n", TRANSFORM_RECORD_ROOT, __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // release the table
+                if ( pp_keys  ) default_allocator(pp_keys, 0);
+                if ( p_values ) default_allocator(p_values, 0);
+
+                // error
+                return 0;
+        }
+    }
+}
+
+const transform_record *transform_stream_records ( const void *p_buffer, size_t size, size_t *p_count )
+{
+
+    // argument check
+    if ( p_buffer == (void *) 0 ) goto no_buffer;
+    if ( p_count  == (void *) 0 ) goto no_count;
+
+    // initialized data
+    transform_stream_header _header = { 0 };
+
+    // read the header
+    if ( size < sizeof(transform_stream_header) ) goto truncated;
+    memcpy(&_header, p_buffer, sizeof(transform_stream_header));
+
+    // validate the header
+    if ( _header.magic       != TRANSFORM_STREAM_MAGIC   ) goto wrong_magic;
+    if ( _header.version     != TRANSFORM_STREAM_VERSION ) goto wrong_version;
+    if ( _header.header_size != sizeof(transform_stream_header) ||
+         _header.record_size != sizeof(transform_record) ) goto wrong_layout;
+
+    // the records must fit
+    if ( _header.count > ( size - sizeof(transform_stream_header) ) / sizeof(transform_record) ) goto truncated;
+
+    // return the quantity of records to the caller
+    *p_count = (size_t) _header.count;
+
+    // success
+    return (const transform_record *) ((const char *) p_buffer + sizeof(transform_stream_header));
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_buffer:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Null pointer provided for parameter \"p_buffer\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_count:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Null pointer provided for parameter \"p_count\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // g10 errors
+        {
+            truncated:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Transform stream is truncated in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            wrong_magic:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Buffer is not a transform stream in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            wrong_version:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Unsupported transform stream version %u in call to function \"%s\"\n", _header.version, __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            wrong_layout:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Transform stream has a different header or record layout in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+size_t transform_unpack_many ( transform *p_transforms, const transform_record *p_records, size_t count )
+{
+
+    // argument check
+    if ( count == 0 ) return 0;
+    if ( p_transforms == (void *) 0 ) goto no_transforms;
+    if ( p_records    == (void *) 0 ) goto no_records;
+
+    // initialized data
+    size_t dropped = 0;
+
+    // one pass over the records
+    for (size_t i = 0; i < count; i++)
+    {
+
+        // initialized data
+        transform              *p_transform = &p_transforms[i];
+        const transform_record *p_record    = &p_records[i];
+
+        // initialize
+        memset(p_transform, 0, sizeof(transform));
+
+        // copy. a parent may follow its child
+        p_transform->location    = (vec3)       { p_record->location[0], p_record->location[1], p_record->location[2] },
+        p_transform->orientation = (quaternion) { p_record->orientation[0], p_record->orientation[1], p_record->orientation[2], p_record->orientation[3] },
+        p_transform->scale       = (vec3)       { p_record->scale[0], p_record->scale[1], p_record->scale[2] },
+        p_transform->p_parent    = ( p_record->parent < count ) ? &p_transforms[p_record->parent] : (void *) 0;
+
+        // a parent outside the stream
+        if ( p_record->parent >= count && p_record->parent != TRANSFORM_RECORD_ROOT ) dropped++;
+
+        // compute the model matrix
+        mat4_model_from_quaternion(
+            &p_transform->model,
+            p_transform->location,
+            p_transform->orientation,
+            p_transform->scale
+        );
+
+        // no world matrix yet
+        transform_changed(p_transform);
+    }
+
+    // break cycles. the index marks each transform on the chain walked from
+    // i with i + 1, and each transform whose chain ends at a root with SIZE_MAX
+    for (size_t i = 0; i < count; i++)
+    {
+
+        // walk up to a root, or to a finished chain
+        for (transform *p = &p_transforms[i]; p && p->_index == 0; p = p->p_parent)
+        {
+
+            // mark the chain
+            p->_index = i + 1;
+
+            // the parent is on the chain, so this link closes a cycle
+            if ( p->p_parent && p->p_parent->_index == i + 1 ) 
+                p->p_parent = (void *) 0,
+                dropped++;
+        }
+
+        // the chain is finished
+        for (transform *p = &p_transforms[i]; p && p->_index == i + 1; p = p->p_parent)
+            p->_index = SIZE_MAX;
+    }
+
+    // clear the marks
+    for (size_t i = 0; i < count; i++)
+        p_transforms[i]._index = 0;
+
+    // report dropped parents
+    if ( dropped )
+    {
+        #ifndef NDEBUG
+            log_warning("[g10] [transform] %zu of %zu records have a parent outside the stream or in a cycle, and were read as roots in call to function \"%s\"\n", dropped, count, __FUNCTION__);
+        #endif
+    }
+
+    // success
+    return count;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_transforms:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Null pointer provided for parameter \"p_transforms\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_records:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Null pointer provided for parameter \"p_records\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int transform_from_aabb ( transform *p_transform, aabb *p_aabb )
+{
+
+    // argument check
+    if ( p_transform == (void *) 0 ) goto no_transform;
     if ( p_aabb      == (void *) 0 ) goto no_aabb;
 
     // rotation is zero
-    p_transform->rotation = (vec3) { 0, 0, 0 };
+    quaternion_identity(&p_transform->orientation);
 
     // location = (max + min) / 2
     vec3_add_vec3(&p_transform->location, p_aabb->_max, p_aabb->_min);
@@ -882,13 +1627,16 @@ int transform_from_aabb ( transform *p_transform, aabb *p_aabb )
     vec3_mul_scalar(&p_transform->scale, p_transform->scale, 0.5f);
 
     // compute the model matrix
-    mat4_model_from_vec3(
+    mat4_model_from_quaternion(
         &p_transform->model,
         p_transform->location,
-        p_transform->rotation,
+        p_transform->orientation,
         p_transform->scale
     );
 
+    // the world matrix is stale
+    transform_changed(p_transform);
+
     // success
     return 1;
 
@@ -916,17 +1664,668 @@ int transform_from_aabb ( transform *p_transform, aabb *p_aabb )
     }
 }
 
-int transform_destroy ( transform **pp_transform )
+int transform_hierarchy_construct ( transform_hierarchy **pp_hierarchy )
 {
 
     // argument check
-    if ( pp_transform == (void *) 0 ) goto no_transform;
+    if ( pp_hierarchy == (void *) 0 ) goto no_hierarchy;
 
     // initialized data
-    transform *p_transform = *pp_transform;
+    transform_hierarchy *p_hierarchy = default_allocator(0, sizeof(transform_hierarchy));
 
-    // no more pointer for caller
-    *pp_transform = (void *) 0;
+    // error check
+    if ( p_hierarchy == (void *) 0 ) goto no_mem;
+
+    // initialize
+    memset(p_hierarchy, 0, sizeof(transform_hierarchy));
+
+    // an empty hierarchy is sorted
+    p_hierarchy->sorted = true;
+
+    // return a pointer to the caller
+    *pp_hierarchy = p_hierarchy;
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_hierarchy:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Null pointer provided for parameter \"pp_hierarchy\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int transform_hierarchy_add ( transform_hierarchy *p_hierarchy, transform *p_transform )
+{
+
+    // argument check
+    if ( p_hierarchy == (void *) 0 ) goto no_hierarchy;
+    if ( p_transform == (void *) 0 ) goto no_transform;
+
+    // add the transform, then each ancestor that is not in the hierarchy
+    for (transform *p = p_transform; p; p = p->p_parent)
+    {
+
+        // the rest of the ancestors are already here
+        if ( p->p_hierarchy == p_hierarchy ) break;
+
+        // error check
+        if ( p->p_hierarchy ) goto in_another_hierarchy;
+
+        // grow the hierarchy
+        if ( p_hierarchy->count == p_hierarchy->max )
+        {
+
+            // initialized data
+            size_t max = ( p_hierarchy->max ) ? p_hierarchy->max * 2 : 64;
+            transform **pp_transforms = default_allocator(p_hierarchy->pp_transforms, max * sizeof(transform *));
+            size_t     *p_extent      = (void *) 0;
+
+            // error check
+            if ( pp_transforms == (void *) 0 ) goto no_mem;
+
+            // store the transforms before the next allocation can fail
+            p_hierarchy->pp_transforms = pp_transforms;
+
+            // grow the extents
+            p_extent = default_allocator(p_hierarchy->p_extent, max * sizeof(size_t));
+
+            // error check
+            if ( p_extent == (void *) 0 ) goto no_mem;
+
+            p_hierarchy->p_extent = p_extent,
+            p_hierarchy->max      = max;
+        }
+
+        // append the transform
+        p->p_hierarchy = p_hierarchy,
+        p->_index      = p_hierarchy->count,
+        p->dirty       = true;
+
+        p_hierarchy->pp_transforms[p_hierarchy->count++] = p;
+        p_hierarchy->sorted = false;
+    }
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_hierarchy:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Null pointer provided for parameter \"p_hierarchy\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            no_transform:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Null pointer provided for parameter \"p_transform\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // g10 errors
+        {
+            in_another_hierarchy:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Transform already belongs to another hierarchy in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+/** !
+ * Remove a transform from its hierarchy. Its children become roots.
+ * 
+ * @param p_hierarchy the hierarchy
+ * @param p_transform the transform
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int transform_hierarchy_remove ( transform_hierarchy *p_hierarchy, transform *p_transform )
+{
+
+    // initialized data
+    size_t i = p_transform->_index;
+
+    // move the last transform into the slot
+    p_hierarchy->pp_transforms[i] = p_hierarchy->pp_transforms[--p_hierarchy->count];
+    p_hierarchy->pp_transforms[i]->_index = i;
+
+    // orphan the children
+    for (size_t j = 0; j < p_hierarchy->count; j++)
+        if ( p_hierarchy->pp_transforms[j]->p_parent == p_transform )
+            p_hierarchy->pp_transforms[j]->p_parent = (void *) 0,
+            transform_changed(p_hierarchy->pp_transforms[j]);
+
+    // the transform is no longer in the hierarchy
+    p_transform->p_hierarchy = (void *) 0;
+    p_hierarchy->sorted      = false;
+
+    // success
+    return 1;
+}
+
+/** !
+ * Sort a hierarchy in preorder, so each parent precedes its children, and
+ * each subtree is a contiguous range
+ * 
+ * @param p_hierarchy the hierarchy
+ * 
+ * @return 1 on success, 0 on error
+ */
+static int transform_hierarchy_sort ( transform_hierarchy *p_hierarchy )
+{
+
+    // initialized data
+    size_t       n             = p_hierarchy->count,
+                 out           = 0;
+    transform  **pp_transforms = p_hierarchy->pp_transforms,
+               **pp_sorted     = (void *) 0;
+    size_t      *p_scratch     = (void *) 0,
+                *p_child       = (void *) 0,
+                *p_sibling     = (void *) 0,
+                *p_stack       = (void *) 0;
+
+    // nothing to sort
+    if ( n == 0 ) goto done;
+
+    // allocate the scratch
+    p_scratch = default_allocator(0, 3 * n * sizeof(size_t)),
+    pp_sorted = default_allocator(0, p_hierarchy->max * sizeof(transform *));
+
+    // error check
+    if ( p_scratch == (void *) 0 ) goto no_mem;
+    if ( pp_sorted == (void *) 0 ) goto no_mem;
+
+    p_child   = p_scratch,
+    p_sibling = p_scratch + n,
+    p_stack   = p_scratch + 2 * n;
+
+    // no children yet
+    for (size_t i = 0; i < n; i++) p_child[i] = SIZE_MAX, p_sibling[i] = SIZE_MAX;
+
+    // link each transform to its parent. the lists come out reversed, and
+    // the stack reverses them again
+    for (size_t i = 0; i < n; i++)
+    {
+
+        // initialized data
+        transform *p_parent = pp_transforms[i]->p_parent;
+
+        // roots have no parent
+        if ( p_parent == (void *) 0 ) continue;
+
+        p_sibling[i] = p_child[p_parent->_index],
+        p_child[p_parent->_index] = i;
+    }
+
+    // walk each tree depth first
+    for (size_t r = 0; r < n; r++)
+    {
+
+        // initialized data
+        size_t top = 0;
+
+        // start from the roots
+        if ( pp_transforms[r]->p_parent ) continue;
+
+        p_stack[top++] = r;
+
+        while ( top )
+        {
+
+            // initialized data
+            size_t i = p_stack[--top];
+
+            // visit the transform
+            pp_sorted[out++] = pp_transforms[i];
+
+            // visit the children next
+            for (size_t c = p_child[i]; c != SIZE_MAX; c = p_sibling[c]) p_stack[top++] = c;
+        }
+    }
+
+    // error check
+    if ( out != n ) goto cycle;
+
+    // store the order
+    for (size_t i = 0; i < n; i++) pp_sorted[i]->_index = i, p_hierarchy->p_extent[i] = 1;
+
+    // each subtree extends over its descendants. children follow parents,
+    // so a reverse pass sees every descendant first
+    for (size_t i = n; i-- > 0; )
+        if ( pp_sorted[i]->p_parent )
+            p_hierarchy->p_extent[pp_sorted[i]->p_parent->_index] += p_hierarchy->p_extent[i];
+
+    // swap in the sorted transforms
+    p_hierarchy->pp_transforms = pp_sorted;
+    pp_transforms = default_allocator(pp_transforms, 0);
+    p_scratch = default_allocator(p_scratch, 0);
+
+    done:
+
+    // the hierarchy is sorted
+    p_hierarchy->sorted = true;
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // g10 errors
+        {
+            cycle:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Hierarchy contains a cycle in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // fall through
+                goto release;
+        }
+
+        // standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // fall through
+                goto release;
+        }
+
+        release:
+
+            // release the scratch
+            if ( p_scratch ) p_scratch = default_allocator(p_scratch, 0);
+            if ( pp_sorted ) pp_sorted = default_allocator(pp_sorted, 0);
+
+            // error
+            return 0;
+    }
+}
+
+/** !
+ * Compute the world matrix of a transform. The parent is current, so its
+ * world version is the version of its chain.
+ * 
+ * @param p_transform the transform
+ * 
+ * @return void
+ */
+static inline void transform_hierarchy_world ( transform *p_transform )
+{
+
+    // world = parent world * local
+    if ( p_transform->p_parent )
+        mat4_mul_mat4_affine(&p_transform->world, p_transform->p_parent->world, p_transform->model),
+        p_transform->world_version = ( p_transform->version > p_transform->p_parent->world_version ) ? p_transform->version : p_transform->p_parent->world_version;
+
+    // root
+    else
+        p_transform->world         = p_transform->model,
+        p_transform->world_version = p_transform->version;
+
+    // clean
+    p_transform->dirty = false;
+}
+
+/** !
+ * Compute the world matrices of some ranges of a hierarchy. The ranges are
+ * disjoint, and the parent of the first transform of each is current.
+ * 
+ * @param p_hierarchy the hierarchy
+ * @param begin       the first range
+ * @param end         one past the last range
+ * 
+ * @return void
+ */
+static void transform_hierarchy_world_ranges ( transform_hierarchy *p_hierarchy, size_t begin, size_t end )
+{
+    for (size_t r = begin; r < end; r++)
+        for (size_t i = p_hierarchy->p_ranges[2 * r]; i < p_hierarchy->p_ranges[2 * r + 1]; i++)
+            transform_hierarchy_world(p_hierarchy->pp_transforms[i]);
+}
+
+size_t transform_hierarchy_update ( transform_hierarchy *p_hierarchy )
+{
+
+    // argument check
+    if ( p_hierarchy == (void *) 0 ) goto no_hierarchy;
+
+    // initialized data
+    size_t updated = 0, ranges = 0;
+
+    // parents first
+    if ( p_hierarchy->sorted == false )
+        if ( 0 == transform_hierarchy_sort(p_hierarchy) ) goto failed_to_sort;
+
+    // gather the dirty subtrees into ranges
+    for (size_t i = 0; i < p_hierarchy->count; )
+    {
+
+        // initialized data
+        size_t extent = p_hierarchy->p_extent[i];
+
+        // clean transforms cost one test
+        if ( p_hierarchy->pp_transforms[i]->dirty == false ) { i++; continue; }
+
+        // a large subtree is split. its root is done here, and each child 
+        // is dirtied, so the scan gathers the subtrees of the children
+        if ( extent > TRANSFORM_HIERARCHY_GRAIN )
+        {
+            transform_hierarchy_world(p_hierarchy->pp_transforms[i]);
+
+            for (size_t c = i + 1; c < i + extent; c += p_hierarchy->p_extent[c])
+                p_hierarchy->pp_transforms[c]->dirty = true;
+
+            updated++, i++;
+
+            continue;
+        }
+
+        // extend the last range, if this subtree follows it, and it has room
+        if ( ranges && p_hierarchy->p_ranges[2 * ranges - 1] == i && i + extent - p_hierarchy->p_ranges[2 * ranges - 2] <= TRANSFORM_HIERARCHY_GRAIN )
+            p_hierarchy->p_ranges[2 * ranges - 1] = i + extent;
+
+        // start a range
+        else
+        {
+
+            // grow the ranges
+            if ( ranges == p_hierarchy->ranges_max )
+            {
+
+                // initialized data
+                size_t  max      = ( ranges ) ? ranges * 2 : 64;
+                size_t *p_ranges = default_allocator(p_hierarchy->p_ranges, 2 * max * sizeof(size_t));
+
+                // error check
+                if ( p_ranges == (void *) 0 ) goto no_mem;
+
+                // store the ranges
+                p_hierarchy->p_ranges   = p_ranges,
+                p_hierarchy->ranges_max = max;
+            }
+
+            p_hierarchy->p_ranges[2 * ranges]     = i,
+            p_hierarchy->p_ranges[2 * ranges + 1] = i + extent,
+            ranges++;
+        }
+
+        updated += extent, i += extent;
+    }
+
+    // recompute the ranges across the worker threads
+    if ( 0 == job_parallel_for(ranges, 1, (fn_job_range *) transform_hierarchy_world_ranges, p_hierarchy) ) goto failed_to_run;
+
+    // success
+    return updated;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_hierarchy:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Null pointer provided for parameter \"p_hierarchy\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // g10 errors
+        {
+            failed_to_sort:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Failed to sort hierarchy in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+
+            failed_to_run:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Failed to run parallel for in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+
+        // standard library errors
+        {
+            no_mem:
+                #ifndef NDEBUG
+                    log_error("[Standard Library] Failed to allocate memory in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int transform_hierarchy_tick ( transform_hierarchy *p_hierarchy )
+{
+
+    // argument check
+    if ( p_hierarchy == (void *) 0 ) goto no_hierarchy;
+
+    // changes are blended until the next interpolation
+    p_hierarchy->ticking = true;
+
+    for (size_t i = 0; i < p_hierarchy->count; i++)
+    {
+
+        // initialized data
+        transform *p_transform = p_hierarchy->pp_transforms[i];
+
+        // still since the tick before
+        if ( p_transform->moving == false ) continue;
+
+        // the model matrix was blended. rebuild it from the current state
+        mat4_model_from_quaternion(
+            &p_transform->model,
+            p_transform->location,
+            p_transform->orientation,
+            p_transform->scale
+        );
+
+        // the world matrix is stale, and the next change stores the state
+        transform_changed(p_transform),
+        p_transform->moving = false;
+    }
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_hierarchy:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Null pointer provided for parameter \"p_hierarchy\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int transform_hierarchy_interpolate ( transform_hierarchy *p_hierarchy, float alpha )
+{
+
+    // argument check
+    if ( p_hierarchy == (void *) 0 ) goto no_hierarchy;
+
+    // initialized data
+    float t = alpha,
+          u = 1.f - alpha;
+
+    // the ticks are over. later changes snap
+    p_hierarchy->ticking = false;
+
+    for (size_t i = 0; i < p_hierarchy->count; i++)
+    {
+
+        // initialized data
+        transform *p_transform = p_hierarchy->pp_transforms[i];
+        quaternion orientation = { 0 };
+        vec3 location = { 0 },
+             scale    = { 0 };
+
+        // the previous and current states are the same
+        if ( p_transform->moving == false ) continue;
+
+        // blend the states
+        location = (vec3)
+        {
+            .x = p_transform->previous.location.x * u + p_transform->location.x * t,
+            .y = p_transform->previous.location.y * u + p_transform->location.y * t,
+            .z = p_transform->previous.location.z * u + p_transform->location.z * t
+        },
+        scale = (vec3)
+        {
+            .x = p_transform->previous.scale.x * u + p_transform->scale.x * t,
+            .y = p_transform->previous.scale.y * u + p_transform->scale.y * t,
+            .z = p_transform->previous.scale.z * u + p_transform->scale.z * t
+        };
+
+        quaternion_nlerp(&orientation, p_transform->previous.orientation, p_transform->orientation, t);
+
+        // compute the model matrix
+        mat4_model_from_quaternion(&p_transform->model, location, orientation, scale);
+
+        // the world matrix is stale
+        transform_changed(p_transform);
+    }
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_hierarchy:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Null pointer provided for parameter \"p_hierarchy\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int transform_hierarchy_destroy ( transform_hierarchy **pp_hierarchy )
+{
+
+    // argument check
+    if ( pp_hierarchy == (void *) 0 ) goto no_hierarchy;
+
+    // initialized data
+    transform_hierarchy *p_hierarchy = *pp_hierarchy;
+
+    // no more pointer for caller
+    *pp_hierarchy = (void *) 0;
+
+    // nothing to release
+    if ( p_hierarchy == (void *) 0 ) return 1;
+
+    // the transforms leave the hierarchy
+    for (size_t i = 0; i < p_hierarchy->count; i++) p_hierarchy->pp_transforms[i]->p_hierarchy = (void *) 0;
+
+    // release the memory
+    if ( p_hierarchy->pp_transforms ) p_hierarchy->pp_transforms = default_allocator(p_hierarchy->pp_transforms, 0);
+    if ( p_hierarchy->p_extent )      p_hierarchy->p_extent      = default_allocator(p_hierarchy->p_extent, 0);
+    if ( p_hierarchy->p_ranges )      p_hierarchy->p_ranges      = default_allocator(p_hierarchy->p_ranges, 0);
+
+    p_hierarchy = default_allocator(p_hierarchy, 0);
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            no_hierarchy:
+                #ifndef NDEBUG
+                    log_error("[g10] [transform] Null pointer provided for parameter \"pp_hierarchy\" in call to function \"%s\"\n", __FUNCTION__);
+                #endif
+
+                // error
+                return 0;
+        }
+    }
+}
+
+int transform_destroy ( transform **pp_transform )
+{
+
+    // argument check
+    if ( pp_transform == (void *) 0 ) goto no_transform;
+
+    // initialized data
+    transform *p_transform = *pp_transform;
+
+    // no more pointer for caller
+    *pp_transform = (void *) 0;
+
+    // leave the hierarchy
+    if ( p_transform && p_transform->p_hierarchy ) transform_hierarchy_remove(p_transform->p_hierarchy, p_transform);
 
     // release the memory
     p_transform = default_allocator(p_transform, 0);
@@ -0,0 +1,353 @@
+/** !
+ * Instanced batch test, on the null backend
+ *
+ * @file util/batch/test.c
+ *
+ * @author Jacob Smith
+ */
+
+// standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// gsdk
+/// core
+#include <core/log.h>
+
+/// data
+#include <data/dict.h>
+
+// g10
+#include <g10.h>
+#include <command.h>
+#include <light.h>
+#include <entity.h>
+#include <pipeline.h>
+#include <draw_list.h>
+#include <batch.h>
+#include <transform.h>
+#include <schedule.h>
+
+// preprocessor definitions
+#define TEST_GEOMETRIES 3
+#define TEST_MATERIALS  2
+#define TEST_STATES     ( TEST_GEOMETRIES * TEST_MATERIALS )
+#define TEST_RANKS      4
+#define TEST_ENTITIES   ( TEST_STATES * TEST_RANKS )
+
+// forward declarations
+/** !
+ * Print a usage message to standard out
+ *
+ * @param argv0 the name of the program
+ *
+ * @return void
+ */
+void print_usage ( const char *argv0 );
+
+/** !
+ * Record the result of a check, and print it if it failed
+ *
+ * @param ok     the result
+ * @param p_what what was checked
+ *
+ * @return ok
+ */
+bool test_check ( bool ok, const char *p_what );
+
+/** !
+ * Batch interleaved entities of 6 states, and check the batches and their
+ * order
+ *
+ * @param p_pipeline the instanced pipeline
+ *
+ * @return void
+ */
+void test_grouping ( pipeline *p_pipeline );
+
+/** !
+ * Run a frame of the instance, and check the batches of the instanced
+ * pipeline against its draw list
+ *
+ * @param p_instance the instance
+ * @param p_pipeline the instanced pipeline
+ *
+ * @return void
+ */
+void test_frame ( g_instance *p_instance, pipeline *p_pipeline );
+
+// data
+static size_t checks = 0, failures = 0;
+
+// stand in for geometry and materials. batching only compares them
+static u8 _geometries[TEST_GEOMETRIES][64] = { 0 },
+          _materials[TEST_MATERIALS][64]   = { 0 };
+
+// entry point
+int main ( int argc, const char *argv[] )
+{
+
+    // initialized data
+    g_instance *p_instance = NULL;
+    pipeline *p_pipeline = NULL;
+    const char *p_instance_path = ( argc > 1 ) ? argv[1] : "assets/headless.json";
+
+    // error check
+    if ( argc > 2 ) goto invalid_arguments;
+
+    // initialize g10
+    if ( 0 == g_init(&p_instance, p_instance_path) ) goto failed_to_initialize_g10;
+
+    // error check
+    if ( G10_BACKEND_NULL != p_instance->backend ) goto not_headless;
+
+    // program the instanced pipeline, as the example does
+    program_pipeline("default_instanced",
+        (fn_pipeline_bind_once *)lighting_bind_once,
+        NULL,
+        (fn_pipeline_bind_each *)entity_bind_batch,
+        (fn_pipeline_draw *)entity_draw_batch
+    );
+
+    // find the instanced pipeline
+    dict_get(p_instance->cache.p_pipeline, "default_instanced", (void **)&p_pipeline);
+
+    // error check
+    if ( NULL == p_pipeline || NULL == p_pipeline->instancing.p_batches ) goto no_pipeline;
+
+    // run the tests
+    test_grouping(p_pipeline);
+    test_frame(p_instance, p_pipeline);
+
+    // summary
+    printf("batch test: %zu of %zu checks passed\n", checks - failures, checks);
+
+    // done
+    return ( failures ) ? EXIT_FAILURE : EXIT_SUCCESS;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            invalid_arguments:
+
+                // print a usage message to standard out
+                print_usage(argv[0]);
+
+                // error
+                return EXIT_FAILURE;
+        }
+
+        // g10 errors
+        {
+            failed_to_initialize_g10:
+
+                // log the error
+                log_error("Error: Failed to initialize g10!\n");
+
+                // error
+                return EXIT_FAILURE;
+
+            not_headless:
+
+                // log the error
+                log_error("Error: \"%s\" does not select the null backend!\n", p_instance_path);
+
+                // error
+                return EXIT_FAILURE;
+
+            no_pipeline:
+
+                // log the error
+                log_error("Error: \"%s\" has no instanced pipeline named \"default_instanced\"!\n", p_instance_path);
+
+                // error
+                return EXIT_FAILURE;
+        }
+    }
+}
+
+bool test_check ( bool ok, const char *p_what )
+{
+
+    // count the check
+    checks++;
+
+    // report a failure
+    if ( false == ok )
+        failures++,
+        log_error("[batch test] FAIL: %s\n", p_what);
+
+    // done
+    return ok;
+}
+
+void test_grouping ( pipeline *p_pipeline )
+{
+
+    // initialized data
+    entity _entities[TEST_ENTITIES] = { 0 };
+    size_t order[TEST_STATES] = { 0 };
+    u64 state_keys[TEST_STATES] = { 0 };
+    draw_list *p_draw_list = NULL;
+    batch_list *p_batch_list = NULL;
+
+    // construct the lists
+    if ( false == test_check(draw_list_construct(&p_draw_list, 4), "construct a draw list") ) return;
+    if ( false == test_check(batch_list_construct(&p_batch_list, 4), "construct a batch list") ) return;
+
+    // entity i has state i % 6 and rank i / 6. later ranks are nearer, so
+    // sorting front to back reverses them
+    for (size_t i = 0; i < TEST_ENTITIES; i++)
+    {
+
+        // initialized data
+        entity *p_entity = &_entities[i];
+        size_t state = i % TEST_STATES,
+               rank  = i / TEST_STATES;
+        float depth = (float) ( TEST_RANKS - rank ) * 0.2f;
+
+        // the entity
+        snprintf(p_entity->_name, sizeof(p_entity->_name), "entity %zu", i);
+        transform_construct(&p_entity->p_transform, (vec3) { (float) i, 0.f, 0.f }, (vec3) { 0.f, 0.f, 0.f }, (vec3) { 1.f, 1.f, 1.f }, NULL);
+
+        p_entity->p_geometry = (geometry *) _geometries[state % TEST_GEOMETRIES],
+        p_entity->p_material = (material *) _materials[state / TEST_GEOMETRIES];
+
+        // draw it
+        draw_list_add(p_draw_list, p_entity, draw_key(DRAW_SORT_OPAQUE, p_pipeline, p_entity->p_material, p_entity->p_geometry, depth));
+    }
+
+    // the states, in key order
+    for (size_t s = 0; s < TEST_STATES; s++)
+        order[s]      = s,
+        state_keys[s] = draw_key(DRAW_SORT_OPAQUE, p_pipeline, _materials[s / TEST_GEOMETRIES], _geometries[s % TEST_GEOMETRIES], 0.f);
+
+    for (size_t i = 1; i < TEST_STATES; i++)
+        for (size_t j = i; j > 0 && state_keys[order[j - 1]] > state_keys[order[j]]; j--)
+        {
+            size_t t = order[j];
+
+            order[j] = order[j - 1],
+            order[j - 1] = t;
+        }
+
+    // sort, and group
+    test_check(TEST_ENTITIES == draw_list_size(p_draw_list), "the draw list grows to hold every entity");
+    test_check(draw_list_sort(p_draw_list), "sort the draw list");
+    test_check(batch_list_build(p_batch_list, p_draw_list), "build the batches");
+
+    // one batch per state, of every rank
+    test_check(TEST_STATES   == p_batch_list->batch_count   , "one batch per geometry and material");
+    test_check(TEST_ENTITIES == p_batch_list->instance_count, "one instance per entity");
+
+    for (size_t b = 0; b < p_batch_list->batch_count && b < TEST_STATES; b++)
+    {
+
+        // initialized data
+        batch *p_batch = &p_batch_list->p_batches[b];
+        size_t state = order[b];
+
+        // the batch
+        test_check(TEST_RANKS == p_batch->count, "every batch holds one entity of each rank");
+        test_check(b * TEST_RANKS == p_batch->first, "batches are contiguous, in key order");
+        test_check(p_batch->p_entity->p_geometry == (geometry *) _geometries[state % TEST_GEOMETRIES], "batch geometry is in key order");
+        test_check(p_batch->p_entity->p_material == (material *) _materials[state / TEST_GEOMETRIES], "batch material is in key order");
+
+        // front to back within the batch
+        for (size_t j = 0; j < p_batch->count && j < TEST_RANKS; j++)
+        {
+
+            // initialized data
+            entity *p_expected = &_entities[state + TEST_STATES * ( TEST_RANKS - 1 - j )];
+            mat4 model = { 0 };
+
+            transform_get_matrix_world(p_expected->p_transform, &model);
+
+            test_check(0 == memcmp(&model, &p_batch_list->p_instances[p_batch->first + j].model, sizeof(mat4)), "instances are front to back within a batch");
+        }
+    }
+
+    // clean up
+    for (size_t i = 0; i < TEST_ENTITIES; i++)
+        transform_destroy(&_entities[i].p_transform);
+
+    draw_list_destroy(&p_draw_list);
+    batch_list_destroy(&p_batch_list);
+
+    // done
+    return;
+}
+
+void test_frame ( g_instance *p_instance, pipeline *p_pipeline )
+{
+
+    // initialized data
+    batch_list *p_batches = p_pipeline->instancing.p_batches;
+    draw_list *p_draw_list = p_pipeline->p_dynamic_draw_list;
+    size_t drawables = 0, instances = 0;
+
+    // one frame, with no window and no device
+    test_check(schedule_run(p_instance->p_schedule, p_instance), "run a frame on the null backend");
+
+    // the entities with geometry
+    for (size_t i = 0; i < draw_list_size(p_draw_list); i++)
+    {
+
+        // initialized data
+        entity *p_entity = p_draw_list->p_packets[i].p_drawable;
+
+        if ( p_entity && p_entity->p_geometry ) drawables++;
+    }
+
+    test_check(drawables == p_batches->instance_count, "the frame has one instance per drawn entity");
+
+    // the batches cover the instances in order, and adjacent batches differ
+    for (size_t b = 0; b < p_batches->batch_count; b++)
+    {
+
+        // initialized data
+        batch *p_batch = &p_batches->p_batches[b];
+
+        test_check(0 < p_batch->count, "frame batches are not empty");
+        test_check(instances == p_batch->first, "frame batches are contiguous");
+
+        if ( b )
+        {
+
+            // initialized data
+            entity *p_a = p_batches->p_batches[b - 1].p_entity,
+                   *p_b = p_batch->p_entity;
+
+            test_check(p_a->p_geometry != p_b->p_geometry || p_a->p_material != p_b->p_material, "adjacent frame batches differ in state");
+        }
+
+        instances += p_batch->count;
+    }
+
+    test_check(instances == p_batches->instance_count, "frame batches cover every instance");
+
+    // the sorted keys never decrease
+    if ( p_pipeline->sort != DRAW_SORT_NONE )
+        for (size_t i = 1; i < draw_list_size(p_draw_list); i++)
+            if ( false == test_check(p_draw_list->p_packets[i - 1].key <= p_draw_list->p_packets[i].key, "the frame draw list is in key order") ) break;
+
+    // done
+    return;
+}
+
+void print_usage ( const char *argv0 )
+{
+
+    // argument check
+    if ( NULL == argv0 ) exit(EXIT_FAILURE);
+
+    // print a usage message to standard out
+    printf("Usage: %s [ instance ]\n", argv0);
+    printf("    instance  an instance with \"backend\" : \"null\", assets/headless.json by default\n");
+
+    // done
+    return;
+}
@@ -0,0 +1,337 @@
+/** !
+ * Frustum cull microbenchmark, every plane against the active plane mask
+ *
+ * @file util/bvh/bench.c
+ *
+ * @author Jacob Smith
+ */
+
+// standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// gsdk
+/// core
+#include <core/log.h>
+#include <core/sync.h>
+
+// g10
+#include <g10.h>
+#include <aabb.h>
+#include <bv.h>
+#include <bvh.h>
+
+// preprocessor definitions
+#define BENCH_ITERATIONS 64
+#define BENCH_COUNT      10000
+
+// type definitions
+/** !
+ * Cull the boxes once
+ *
+ * @param p_tested the quantity of planes tested is added to this
+ *
+ * @return the quantity of visible boxes
+ */
+typedef size_t (fn_bench_case)( size_t *p_tested );
+
+// forward declarations
+/** !
+ * Print a usage message to standard out
+ *
+ * @param argv0 the name of the program
+ *
+ * @return void
+ */
+void print_usage ( const char *argv0 );
+
+/** !
+ * Time a case of the benchmark
+ *
+ * @param pfn_case  the case
+ * @param p_tested  return the planes tested by one cull
+ * @param p_visible return the boxes visible to one cull
+ *
+ * @return nanoseconds per cull
+ */
+double bench_time ( fn_bench_case *pfn_case, size_t *p_tested, size_t *p_visible );
+
+/// cases
+size_t bench_leaves   ( size_t *p_tested );
+size_t bench_unmasked ( size_t *p_tested );
+size_t bench_masked   ( size_t *p_tested );
+size_t bench_compiled ( size_t *p_tested );
+
+// data
+static size_t  box_count = 0;
+static aabb  **pp_boxes = NULL;
+static bv     *p_root = NULL;
+static bvh    *p_bvh = NULL;
+static vec4    planes[6] = { 0 };
+
+static const struct
+{
+    const char    *p_name;
+    fn_bench_case *pfn_case;
+} _cases[] =
+{
+    { "leaves, 6 planes"  , bench_leaves   },
+    { "pointer, 6 planes" , bench_unmasked },
+    { "pointer, masked"   , bench_masked   },
+    { "compiled, masked"  , bench_compiled }
+};
+
+// entry point
+int main ( int argc, const char *argv[] )
+{
+
+    // initialized data
+    bv **pp_leaves = NULL;
+    size_t side = 0;
+    float extent = 0;
+
+    // error check
+    if ( argc > 2 ) goto invalid_arguments;
+
+    // parse the count
+    box_count = ( argc == 2 ) ? strtoull(argv[1], NULL, 10) : BENCH_COUNT;
+
+    // error check
+    if ( 0 == box_count ) goto invalid_arguments;
+
+    // allocate the boxes, and their leaves
+    pp_boxes  = default_allocator(0, box_count * sizeof(aabb *)),
+    pp_leaves = default_allocator(0, box_count * sizeof(bv *));
+
+    // error check
+    if ( pp_boxes == NULL || pp_leaves == NULL ) goto no_mem;
+
+    // a cube of unit boxes, two units apart
+    side   = (size_t) ceil(cbrt((double) box_count)),
+    extent = (float) side * 2.f;
+
+    for (size_t i = 0; i < box_count; i++)
+    {
+
+        // initialized data
+        float x = (float) ( i % side ) * 2.f,
+              y = (float) ( i / side % side ) * 2.f,
+              z = (float) ( i / side / side ) * 2.f;
+
+        // the box
+        pp_boxes[i] = default_allocator(0, sizeof(aabb));
+
+        // error check
+        if ( pp_boxes[i] == NULL ) goto no_mem;
+
+        *pp_boxes[i] = (aabb) { ._min = { x, y, z }, ._max = { x + 1.f, y + 1.f, z + 1.f } };
+
+        // the leaf. the compiler treats volumes with user data as leaves
+        if ( 0 == bv_from_aabb(&pp_leaves[i], pp_boxes[i]) ) goto no_mem;
+
+        pp_leaves[i]->p_user_data = pp_boxes[i];
+    }
+
+    // build, and compile
+    if ( 0 == bv_from_leaves(&p_root, pp_leaves, box_count, BV_BUILD_SAH) ) goto failed_to_build;
+    if ( 0 == bvh_from_bv(&p_bvh, p_root)                                 ) goto failed_to_build;
+
+    // header
+    printf("%-20s %-8s %12s %14s %10s\n", "case", "view", "ns", "planes tested", "visible");
+
+    // the whole cube in view, then the half of it below x = extent / 2
+    for (size_t view = 0; view < 2; view++)
+    {
+
+        // a box shaped frustum around the cube
+        for (size_t i = 0; i < 6; i++)
+            planes[i] = (vec4)
+            {
+                (float) ( ( i == 0 ) - ( i == 1 ) ),
+                (float) ( ( i == 2 ) - ( i == 3 ) ),
+                (float) ( ( i == 4 ) - ( i == 5 ) ),
+                ( i & 1 ) ? extent + 1.f : 1.f
+            };
+
+        // cut at the middle
+        if ( view == 1 ) planes[1].w = extent * 0.5f;
+
+        // each case
+        for (size_t i = 0; i < sizeof(_cases) / sizeof(*_cases); i++)
+        {
+
+            // initialized data
+            size_t tested = 0, visible = 0;
+            double ns = bench_time(_cases[i].pfn_case, &tested, &visible);
+
+            // print the result
+            printf("%-20s %-8s %12.0f %14zu %10zu\n", _cases[i].p_name, ( view ) ? "half" : "whole", ns, tested, visible);
+        }
+    }
+
+    // summary
+    printf("%zu boxes, %zu nodes, depth %zu, %d iterations each\n", box_count, p_bvh->node_count, p_bvh->depth, BENCH_ITERATIONS);
+
+    // clean up. the leaves release the boxes
+    bvh_destroy(&p_bvh);
+    bv_destroy(&p_root);
+
+    pp_boxes  = default_allocator(pp_boxes, 0),
+    pp_leaves = default_allocator(pp_leaves, 0);
+
+    // success
+    return EXIT_SUCCESS;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            invalid_arguments:
+
+                // print a usage message to standard out
+                print_usage(argv[0]);
+
+                // error
+                return EXIT_FAILURE;
+        }
+
+        // g10 errors
+        {
+            failed_to_build:
+
+                // log the error
+                log_error("Error: Failed to build the hierarchy!\n");
+
+                // error
+                return EXIT_FAILURE;
+        }
+
+        // standard library errors
+        {
+            no_mem:
+
+                // log the error
+                log_error("Error: Out of memory!\n");
+
+                // error
+                return EXIT_FAILURE;
+        }
+    }
+}
+
+double bench_time ( fn_bench_case *pfn_case, size_t *p_tested, size_t *p_visible )
+{
+
+    // initialized data
+    timestamp t0 = 0, t1 = 0;
+    size_t tested = 0;
+
+    // warm up, and count the planes of one cull
+    *p_tested  = 0,
+    *p_visible = pfn_case(p_tested);
+
+    // time the case
+    t0 = timer_high_precision();
+    for (size_t i = 0; i < BENCH_ITERATIONS; i++) pfn_case(&tested);
+    t1 = timer_high_precision();
+
+    // done
+    return (double)( t1 - t0 ) * 1000000000.0 / (double) timer_seconds_divisor() / BENCH_ITERATIONS;
+}
+
+/** !
+ * Cull a subtree of the pointer hierarchy
+ *
+ * @param p_bv     the subtree
+ * @param mask     the planes the parent was not fully inside of
+ * @param inherit  false to test all 6 planes at every volume
+ * @param p_tested the quantity of planes tested is added to this
+ *
+ * @return the quantity of visible boxes
+ */
+static size_t bench_recursive ( bv *p_bv, u8 mask, bool inherit, size_t *p_tested )
+{
+
+    // initialized data
+    aabb bounds = { 0 };
+    size_t visible = 0;
+
+    // the planes to test
+    if ( false == inherit ) mask = BVH_PLANES_ALL;
+
+    // cull
+    if ( mask )
+    {
+        if ( 0 == bv_bounds(p_bv, &bounds._min, &bounds._max) ) return 0;
+        if ( aabb_cull_frustum_masked(&bounds, planes, &mask, &p_bv->_plane, p_tested) ) return 0;
+    }
+
+    // leaf
+    if ( p_bv->p_user_data ) return 1;
+
+    // each child
+    for (size_t i = 0; i < 4; i++)
+        if ( p_bv->p_data[i] ) visible += bench_recursive(p_bv->p_data[i], mask, inherit, p_tested);
+
+    // done
+    return visible;
+}
+
+size_t bench_leaves ( size_t *p_tested )
+{
+
+    // initialized data
+    size_t visible = 0;
+
+    // every box against every plane, with no hierarchy
+    for (size_t i = 0; i < box_count; i++)
+    {
+
+        // initialized data
+        u8 mask = BVH_PLANES_ALL, hint = 0;
+
+        visible += !aabb_cull_frustum_masked(pp_boxes[i], planes, &mask, &hint, p_tested);
+    }
+
+    // done
+    return visible;
+}
+
+size_t bench_unmasked ( size_t *p_tested )
+{
+    return bench_recursive(p_root, BVH_PLANES_ALL, false, p_tested);
+}
+
+size_t bench_masked ( size_t *p_tested )
+{
+    return bench_recursive(p_root, BVH_PLANES_ALL, true, p_tested);
+}
+
+size_t bench_compiled ( size_t *p_tested )
+{
+
+    // initialized data
+    size_t visible = bvh_cull(p_bvh, planes, NULL, NULL);
+
+    // the metrics of the cull
+    *p_tested += p_bvh->cull.planes_tested;
+
+    // done
+    return visible;
+}
+
+void print_usage ( const char *argv0 )
+{
+
+    // argument check
+    if ( NULL == argv0 ) exit(EXIT_FAILURE);
+
+    // print a usage message to standard out
+    printf("Usage: %s [ box count ]\n", argv0);
+
+    // done
+    return;
+}
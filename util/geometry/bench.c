@@ -0,0 +1,292 @@
+/** ! 
+ * Geometry loader benchmark, json against binary
+ * 
+ * @file util/geometry/bench.c
+ * 
+ * @author Jacob Smith
+ */
+
+// standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <unistd.h>
+
+// gsdk
+/// core
+#include <core/log.h>
+#include <core/sync.h>
+
+/// reflection
+#include <reflection/json.h>
+
+// g10
+#include <g10.h>
+#include <geometry.h>
+
+// preprocessor definitions
+#define BENCH_ITERATIONS 16
+
+// forward declarations
+/** !
+ * Print a usage message to standard out
+ * 
+ * @param argv0 the name of the program
+ * 
+ * @return void
+ */
+void print_usage ( const char *argv0 );
+
+/** !
+ * Load a json geometry the way the json loader does, up to the transfer
+ * buffer copy. No GPU work is timed.
+ * 
+ * @param p_path    path to the json geometry
+ * @param p_staging stands in for the mapped transfer buffer
+ * 
+ * @return bytes staged on success, 0 on error
+ */
+size_t load_json ( const char *p_path, void *p_staging );
+
+/** !
+ * Load a binary geometry the way the binary loader does, up to the 
+ * transfer buffer copy. No GPU work is timed.
+ * 
+ * @param p_path    path to the binary geometry
+ * @param p_staging stands in for the mapped transfer buffer
+ * 
+ * @return bytes staged on success, 0 on error
+ */
+size_t load_binary ( const char *p_path, void *p_staging );
+
+// data
+static void *p_staging = NULL;
+
+// entry point
+int main ( int argc, const char *argv[] )
+{
+
+    // initialized data
+    const char *p_directory = ( argc > 1 ) ? argv[1] : "assets/geometry";
+    char _binary_path[] = "/tmp/g10_geometry_bench_XXXXXX";
+    DIR *p_dir = NULL;
+    struct dirent *p_entry = NULL;
+    size_t files = 0, json_bytes = 0, binary_bytes = 0;
+    double json_total = 0, binary_total = 0;
+    int fd = -1;
+
+    // error check
+    if ( argc > 2 ) goto invalid_arguments;
+
+    // open the directory
+    p_dir = opendir(p_directory);
+
+    // error check
+    if ( NULL == p_dir ) goto failed_to_open_directory;
+
+    // the binary files are written to one scratch path
+    fd = mkstemp(_binary_path);
+
+    // error check
+    if ( -1 == fd ) goto failed_to_open_directory;
+
+    // header
+    printf("%-32s %10s %10s %10s %10s %8s\n", "geometry", "json B", "bin B", "json ms", "bin ms", "speedup");
+
+    // iterate through each json geometry
+    while ( ( p_entry = readdir(p_dir) ) )
+    {
+
+        // initialized data
+        char _path[1024] = { 0 };
+        size_t name_len = strlen(p_entry->d_name), len = 0, size = 0;
+        char *p_text = NULL;
+        void *p_data = NULL;
+        json_value *p_value = NULL;
+        timestamp t0 = 0, t1 = 0;
+        double json_ms = 0, binary_ms = 0;
+
+        // skip anything that is not json
+        if ( name_len < 5 || strcmp(p_entry->d_name + name_len - 5, ".json") ) continue;
+
+        // build the path
+        snprintf(_path, sizeof(_path), "%s/%s", p_directory, p_entry->d_name);
+
+        // convert, untimed
+        len    = load_file(_path, NULL, true),
+        p_text = default_allocator(0, len + 1);
+        load_file(_path, p_text, true);
+        p_text[len] = '\0';
+
+        if ( 0 == json_value_parse(p_text, NULL, &p_value) ) { p_text = default_allocator(p_text, 0); continue; }
+        if ( 0 == geometry_binary_from_json(p_value, &p_data, &size) ) { json_value_free(p_value, 0); p_text = default_allocator(p_text, 0); continue; }
+
+        json_value_free(p_value, 0);
+        p_text = default_allocator(p_text, 0);
+
+        // write the binary geometry
+        if ( -1 == ftruncate(fd, 0) || -1 == lseek(fd, 0, SEEK_SET) || (ssize_t) size != write(fd, p_data, size) ) goto failed_to_write_file;
+
+        // grow the staging buffer
+        p_staging = default_allocator(p_staging, size);
+
+        // time the json loader
+        t0 = timer_high_precision();
+        for (size_t i = 0; i < BENCH_ITERATIONS; i++) load_json(_path, p_staging);
+        t1 = timer_high_precision();
+        json_ms = (double)( t1 - t0 ) * 1000.0 / (double) timer_seconds_divisor() / BENCH_ITERATIONS;
+
+        // time the binary loader
+        t0 = timer_high_precision();
+        for (size_t i = 0; i < BENCH_ITERATIONS; i++) load_binary(_binary_path, p_staging);
+        t1 = timer_high_precision();
+        binary_ms = (double)( t1 - t0 ) * 1000.0 / (double) timer_seconds_divisor() / BENCH_ITERATIONS;
+
+        // print the result
+        printf("%-32.32s %10zu %10zu %10.3f %10.3f %7.1fx\n", p_entry->d_name, len, size, json_ms, binary_ms, json_ms / ( binary_ms > 0 ? binary_ms : 1e-9 ));
+
+        // accumulate
+        files++,
+        json_bytes   += len,
+        binary_bytes += size,
+        json_total   += json_ms,
+        binary_total += binary_ms;
+
+        // release the binary geometry
+        p_data = default_allocator(p_data, 0);
+    }
+
+    // summary
+    printf("%-32s %10zu %10zu %10.3f %10.3f %7.1fx\n", "total", json_bytes, binary_bytes, json_total, binary_total, json_total / ( binary_total > 0 ? binary_total : 1e-9 ));
+    printf("%zu files, %d iterations each\n", files, BENCH_ITERATIONS);
+
+    // clean up
+    closedir(p_dir),
+    close(fd),
+    unlink(_binary_path);
+    p_staging = default_allocator(p_staging, 0);
+
+    // success
+    return EXIT_SUCCESS;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            invalid_arguments:
+
+                // print a usage message to standard out
+                print_usage(argv[0]);
+
+                // error
+                return EXIT_FAILURE;
+        }
+
+        // file errors
+        {
+            failed_to_open_directory:
+                log_error("Error: Failed to open \"%s\"\n", p_directory);
+
+                // error
+                return EXIT_FAILURE;
+
+            failed_to_write_file:
+                log_error("Error: Failed to write \"%s\"\n", _binary_path);
+
+                // clean up
+                closedir(p_dir),
+                close(fd),
+                unlink(_binary_path);
+
+                // error
+                return EXIT_FAILURE;
+        }
+    }
+}
+
+size_t load_json ( const char *p_path, void *p_staging )
+{
+
+    // initialized data
+    size_t len = load_file(p_path, NULL, true), size = 0, staged = 0;
+    char *p_text = default_allocator(0, len + 1);
+    void *p_data = NULL;
+    json_value *p_value = NULL;
+    const geometry_binary_header *p_header = NULL;
+
+    // load the file
+    load_file(p_path, p_text, true);
+    p_text[len] = '\0';
+
+    // parse, then convert each number
+    json_value_parse(p_text, NULL, &p_value);
+    geometry_binary_from_json(p_value, &p_data, &size);
+    geometry_binary_validate(p_data, size, &p_header);
+
+    // copy each stream to the staging buffer
+    for (size_t i = 0; i < GEOMETRY_QTY; i++)
+        memcpy((char *)p_staging + p_header->_attributes[i].offset, (char *)p_data + p_header->_attributes[i].offset, p_header->_attributes[i].size),
+        staged += p_header->_attributes[i].size;
+
+    memcpy((char *)p_staging + p_header->idx.offset, (char *)p_data + p_header->idx.offset, p_header->idx.size);
+    staged += p_header->idx.size;
+
+    for (size_t i = 0; i < p_header->part_count; i++)
+        memcpy((char *)p_staging + p_header->_parts[i].idx.offset, (char *)p_data + p_header->_parts[i].idx.offset, p_header->_parts[i].idx.size),
+        staged += p_header->_parts[i].idx.size;
+
+    // release
+    json_value_free(p_value, 0);
+    p_data = default_allocator(p_data, 0),
+    p_text = default_allocator(p_text, 0);
+
+    // done
+    return staged;
+}
+
+size_t load_binary ( const char *p_path, void *p_staging )
+{
+
+    // initialized data
+    size_t size = 0, staged = 0;
+    const void *p_data = map_file(p_path, &size);
+    const geometry_binary_header *p_header = NULL;
+
+    // error check
+    if ( 0 == geometry_binary_validate(p_data, size, &p_header) ) goto done;
+
+    // copy each stream from the mapping to the staging buffer
+    for (size_t i = 0; i < GEOMETRY_QTY; i++)
+        memcpy((char *)p_staging + p_header->_attributes[i].offset, (const char *)p_data + p_header->_attributes[i].offset, p_header->_attributes[i].size),
+        staged += p_header->_attributes[i].size;
+
+    memcpy((char *)p_staging + p_header->idx.offset, (const char *)p_data + p_header->idx.offset, p_header->idx.size);
+    staged += p_header->idx.size;
+
+    for (size_t i = 0; i < p_header->part_count; i++)
+        memcpy((char *)p_staging + p_header->_parts[i].idx.offset, (const char *)p_data + p_header->_parts[i].idx.offset, p_header->_parts[i].idx.size),
+        staged += p_header->_parts[i].idx.size;
+
+    done:
+
+    // unmap the file
+    unmap_file(p_data, size);
+
+    // done
+    return staged;
+}
+
+void print_usage ( const char *argv0 )
+{
+
+    // argument check
+    if ( NULL == argv0 ) exit(EXIT_FAILURE);
+
+    // print a usage message to standard out
+    printf("Usage: %s [ geometry directory ]\n", argv0);
+
+    // done
+    return;
+}
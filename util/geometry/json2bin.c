@@ -0,0 +1,172 @@
+/** ! 
+ * Convert json geometry to binary geometry
+ * 
+ * @file util/geometry/json2bin.c
+ * 
+ * @author Jacob Smith
+ */
+
+// standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// gsdk
+/// core
+#include <core/log.h>
+
+/// reflection
+#include <reflection/json.h>
+
+// g10
+#include <g10.h>
+#include <geometry.h>
+
+// forward declarations
+/** !
+ * Print a usage message to standard out
+ * 
+ * @param argv0 the name of the program
+ * 
+ * @return void
+ */
+void print_usage ( const char *argv0 );
+
+/** !
+ * Convert one json geometry file to a binary geometry file
+ * 
+ * @param p_input  path to the json geometry
+ * @param p_output path to the binary geometry
+ * 
+ * @return 1 on success, 0 on error
+ */
+int convert ( const char *p_input, const char *p_output );
+
+// entry point
+int main ( int argc, const char *argv[] )
+{
+
+    // error check
+    if ( argc < 3 || ( argc - 1 ) % 2 ) goto invalid_arguments;
+
+    // convert each pair of paths
+    for (int i = 1; i < argc; i += 2)
+        if ( 0 == convert(argv[i], argv[i + 1]) ) goto failed_to_convert;
+    
+    // success
+    return EXIT_SUCCESS;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            invalid_arguments:
+
+                // print a usage message to standard out
+                print_usage(argv[0]);
+
+                // error
+                return EXIT_FAILURE;
+        }
+
+        // conversion errors
+        {
+            failed_to_convert:
+
+                // error
+                return EXIT_FAILURE;
+        }
+    }
+}
+
+int convert ( const char *p_input, const char *p_output )
+{
+
+    // initialized data
+    size_t len = load_file(p_input, NULL, true), size = 0;
+    char *p_text = NULL;
+    void *p_data = NULL;
+    json_value *p_value = NULL;
+    FILE *p_file = NULL;
+
+    // error check
+    if ( 0 == len ) goto failed_to_load_file;
+
+    // allocate memory for the text
+    p_text = default_allocator(0, len + 1);
+
+    // load the file
+    if ( 0 == load_file(p_input, p_text, true) ) goto failed_to_load_file;
+
+    // null terminate
+    p_text[len] = '\0';
+
+    // parse the text
+    if ( 0 == json_value_parse(p_text, NULL, &p_value) ) goto failed_to_parse_json;
+
+    // convert
+    if ( 0 == geometry_binary_from_json(p_value, &p_data, &size) ) goto failed_to_parse_json;
+
+    // write the binary geometry
+    p_file = fopen(p_output, "wb");
+
+    // error check
+    if ( NULL == p_file ) goto failed_to_write_file;
+    if ( size != fwrite(p_data, 1, size, p_file) ) goto failed_to_write_file;
+
+    // close the file
+    fclose(p_file);
+
+    // log
+    log_info("%s -> %s (%zu -> %zu bytes)\n", p_input, p_output, len, size);
+
+    // release
+    json_value_free(p_value, 0);
+    p_data = default_allocator(p_data, 0),
+    p_text = default_allocator(p_text, 0);
+
+    // success
+    return 1;
+
+    // error handling
+    {
+
+        // file errors
+        {
+            failed_to_load_file:
+                log_error("Error: Failed to load \"%s\"\n", p_input);
+
+                // error
+                return 0;
+
+            failed_to_parse_json:
+                log_error("Error: Failed to parse geometry \"%s\"\n", p_input);
+
+                // error
+                return 0;
+
+            failed_to_write_file:
+                log_error("Error: Failed to write \"%s\"\n", p_output);
+
+                // close the file
+                if ( p_file ) fclose(p_file);
+
+                // error
+                return 0;
+        }
+    }
+}
+
+void print_usage ( const char *argv0 )
+{
+
+    // argument check
+    if ( NULL == argv0 ) exit(EXIT_FAILURE);
+
+    // print a usage message to standard out
+    printf("Usage: %s <input.json> <output.gmesh> [ <input.json> <output.gmesh> ... ]\n", argv0);
+
+    // done
+    return;
+}
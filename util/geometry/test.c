@@ -0,0 +1,215 @@
+/** !
+ * Binary geometry validation test, against malformed streams
+ *
+ * @file util/geometry/test.c
+ *
+ * @author Jacob Smith
+ */
+
+// standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// gsdk
+/// core
+#include <core/log.h>
+
+// g10
+#include <g10.h>
+#include <geometry.h>
+
+// preprocessor definitions
+#define TEST_VERTICES  4
+#define TEST_TRIANGLES 2
+
+// forward declarations
+/** !
+ * Record the result of a check, and print it if it failed
+ *
+ * @param ok     the result
+ * @param p_what what was checked
+ *
+ * @return ok
+ */
+bool test_check ( bool ok, const char *p_what );
+
+/** !
+ * Lay out a well formed binary geometry with every stream
+ *
+ * @param p_data return the contents of the file
+ * @param p_size return the size of the contents
+ *
+ * @return void
+ */
+void test_build ( u8 *p_data, size_t *p_size );
+
+/** !
+ * Check that each malformed variant of one vertex stream is rejected
+ *
+ * @param p_valid the contents of a well formed file
+ * @param size    the size of the contents
+ * @param _type   the vertex stream
+ *
+ * @return void
+ */
+void test_stream ( const u8 *p_valid, size_t size, enum geometry_vertex_attribute_e _type );
+
+// data
+static size_t checks = 0, failures = 0;
+
+static const char *_stream_names[GEOMETRY_QTY] =
+{
+    [GEOMETRY_XYZ]  = "xyz",
+    [GEOMETRY_UV]   = "uv",
+    [GEOMETRY_NXYZ] = "nxyz",
+    [GEOMETRY_TXYZ] = "txyz",
+    [GEOMETRY_BXYZ] = "bxyz"
+};
+
+static const size_t _components[GEOMETRY_QTY] =
+{
+    [GEOMETRY_XYZ]  = 3,
+    [GEOMETRY_UV]   = 2,
+    [GEOMETRY_NXYZ] = 3,
+    [GEOMETRY_TXYZ] = 4,
+    [GEOMETRY_BXYZ] = 3
+};
+
+// the file, with room for every stream
+static _Alignas(GEOMETRY_BINARY_ALIGN) u8 _valid[4096], _scratch[4096];
+
+// entry point
+int main ( int argc, const char *argv[] )
+{
+
+    // initialized data
+    const geometry_binary_header *p_header = NULL;
+    size_t size = 0;
+
+    // unused
+    (void) argc, (void) argv;
+
+    // a well formed file
+    test_build(_valid, &size);
+    test_check(geometry_binary_validate(_valid, size, &p_header), "a well formed file is accepted");
+
+    // absent streams are accepted
+    memcpy(_scratch, _valid, size);
+    ((geometry_binary_header *)_scratch)->_attributes[GEOMETRY_BXYZ] = (geometry_binary_range) { 0 };
+    test_check(geometry_binary_validate(_scratch, size, &p_header), "an absent stream is accepted");
+
+    // each stream, malformed
+    for (size_t i = 0; i < GEOMETRY_QTY; i++)
+        test_stream(_valid, size, (enum geometry_vertex_attribute_e) i);
+
+    // summary
+    printf("geometry test: %zu of %zu checks passed\n", checks - failures, checks);
+
+    // done
+    return ( failures ) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+bool test_check ( bool ok, const char *p_what )
+{
+
+    // count the check
+    checks++;
+
+    // report a failure
+    if ( false == ok )
+        failures++,
+        log_error("[geometry test] FAIL: %s\n", p_what);
+
+    // done
+    return ok;
+}
+
+void test_build ( u8 *p_data, size_t *p_size )
+{
+
+    // initialized data
+    geometry_binary_header *p_header = (geometry_binary_header *) p_data;
+    size_t size = sizeof(geometry_binary_header);
+
+    // the header
+    memset(p_data, 0, sizeof(_valid));
+
+    *p_header = (geometry_binary_header)
+    {
+        .magic        = GEOMETRY_BINARY_MAGIC,
+        .version      = GEOMETRY_BINARY_VERSION,
+        .header_size  = sizeof(geometry_binary_header),
+        .vertex_count = TEST_VERTICES,
+        .index_count  = TEST_TRIANGLES
+    };
+
+    // the vertex streams
+    for (size_t i = 0; i < GEOMETRY_QTY; i++)
+    {
+        p_header->_attributes[i] = (geometry_binary_range)
+        {
+            .offset = size,
+            .size   = TEST_VERTICES * _components[i] * sizeof(f32)
+        };
+
+        size = ( size + p_header->_attributes[i].size + GEOMETRY_BINARY_ALIGN - 1 ) & ~(size_t)( GEOMETRY_BINARY_ALIGN - 1 );
+    }
+
+    // the indices
+    p_header->idx = (geometry_binary_range)
+    {
+        .offset = size,
+        .size   = TEST_TRIANGLES * 3 * sizeof(u32)
+    };
+
+    size += p_header->idx.size;
+
+    // return the size to the caller
+    *p_size = size;
+
+    // done
+    return;
+}
+
+void test_stream ( const u8 *p_valid, size_t size, enum geometry_vertex_attribute_e _type )
+{
+
+    // initialized data
+    const geometry_binary_header *p_header = NULL;
+    geometry_binary_range *p_range = &((geometry_binary_header *)_scratch)->_attributes[_type];
+    u64 element = _components[_type] * sizeof(f32);
+    char _what[128] = { 0 };
+
+    // one vertex short
+    memcpy(_scratch, p_valid, size);
+    p_range->size -= element;
+    snprintf(_what, sizeof(_what), "a %s stream one vertex short is rejected", _stream_names[_type]);
+    test_check(0 == geometry_binary_validate(_scratch, size, &p_header), _what);
+
+    // one vertex long
+    memcpy(_scratch, p_valid, size);
+    p_range->size += element;
+    snprintf(_what, sizeof(_what), "a %s stream one vertex long is rejected", _stream_names[_type]);
+    test_check(0 == geometry_binary_validate(_scratch, size, &p_header), _what);
+
+    // a partial element
+    memcpy(_scratch, p_valid, size);
+    p_range->size -= sizeof(f32);
+    snprintf(_what, sizeof(_what), "a %s stream with a partial vertex is rejected", _stream_names[_type]);
+    test_check(0 == geometry_binary_validate(_scratch, size, &p_header), _what);
+
+    // misaligned
+    memcpy(_scratch, p_valid, size);
+    p_range->offset += sizeof(f32);
+    snprintf(_what, sizeof(_what), "a misaligned %s stream is rejected", _stream_names[_type]);
+    test_check(0 == geometry_binary_validate(_scratch, size, &p_header), _what);
+
+    // the file ends inside the stream
+    memcpy(_scratch, p_valid, size);
+    snprintf(_what, sizeof(_what), "a file that ends inside the %s stream is rejected", _stream_names[_type]);
+    test_check(0 == geometry_binary_validate(_scratch, (size_t)( p_range->offset + p_range->size - 1 ), &p_header), _what);
+
+    // done
+    return;
+}
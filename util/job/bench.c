@@ -0,0 +1,295 @@
+/** !
+ * Job system microbenchmark, the cost of scheduling against the work
+ *
+ * @file util/job/bench.c
+ *
+ * @author Jacob Smith
+ */
+
+// standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// gsdk
+/// core
+#include <core/log.h>
+#include <core/sync.h>
+
+// g10
+#include <g10.h>
+#include <job.h>
+
+// preprocessor definitions
+#define BENCH_ITERATIONS 64
+#define BENCH_COUNT      65536
+#define BENCH_CHAIN      1024
+
+// type definitions
+/** !
+ * Run one case of the benchmark over count elements
+ *
+ * @param count the quantity of elements
+ *
+ * @return void
+ */
+typedef void (fn_bench_case)( size_t count );
+
+// forward declarations
+/** !
+ * Print a usage message to standard out
+ *
+ * @param argv0 the name of the program
+ *
+ * @return void
+ */
+void print_usage ( const char *argv0 );
+
+/** !
+ * Time a case of the benchmark
+ *
+ * @param pfn_case the case
+ * @param count    the quantity of elements
+ *
+ * @return nanoseconds per element
+ */
+double bench_time ( fn_bench_case *pfn_case, size_t count );
+
+/// cases
+void bench_serial        ( size_t count );
+void bench_submit        ( size_t count );
+void bench_parallel_1    ( size_t count );
+void bench_parallel_16   ( size_t count );
+void bench_parallel_256  ( size_t count );
+void bench_parallel_4096 ( size_t count );
+void bench_chain         ( size_t count );
+
+// data
+static u32 *p_data = NULL;
+static job_counter _chain[BENCH_CHAIN] = { 0 };
+static struct
+{
+    const char    *p_name;
+    fn_bench_case *pfn_case;
+    const char    *p_unit;
+} _cases[] =
+{
+    { "serial loop"        , bench_serial       , "element" },
+    { "submit empty"       , bench_submit       , "job"     },
+    { "parallel for 1"     , bench_parallel_1   , "element" },
+    { "parallel for 16"    , bench_parallel_16  , "element" },
+    { "parallel for 256"   , bench_parallel_256 , "element" },
+    { "parallel for 4096"  , bench_parallel_4096, "element" },
+    { "dependency chain"   , bench_chain        , "link"    }
+};
+
+// entry point
+int main ( int argc, const char *argv[] )
+{
+
+    // initialized data
+    size_t workers = 0,
+           count   = BENCH_COUNT;
+
+    // error check
+    if ( argc > 3 ) goto invalid_arguments;
+
+    // parse the worker count, and the element count
+    if ( argc >= 2 ) workers = strtoull(argv[1], NULL, 10);
+    if ( argc == 3 ) count   = strtoull(argv[2], NULL, 10);
+
+    // error check
+    if ( 0 == count ) goto invalid_arguments;
+
+    // start the workers
+    if ( 0 == job_init(workers) ) goto failed_to_start_jobs;
+
+    // allocate the elements
+    p_data = default_allocator(0, count * sizeof(u32));
+
+    // error check
+    if ( p_data == NULL ) goto no_mem;
+
+    // populate the elements
+    for (size_t i = 0; i < count; i++) p_data[i] = (u32) i;
+
+    // header
+    printf("%-20s %12s %s\n", "case", "ns", "per");
+
+    // each case
+    for (size_t i = 0; i < sizeof(_cases) / sizeof(*_cases); i++)
+    {
+
+        // initialized data
+        size_t n  = ( _cases[i].pfn_case == bench_chain ) ? BENCH_CHAIN : count;
+        double ns = bench_time(_cases[i].pfn_case, n);
+
+        // print the result
+        printf("%-20s %12.2f %s\n", _cases[i].p_name, ns, _cases[i].p_unit);
+    }
+
+    // summary
+    printf("%zu elements, %d iterations each, %zu workers\n", count, BENCH_ITERATIONS, job_worker_count());
+
+    // clean up
+    p_data = default_allocator(p_data, 0);
+
+    job_quit();
+
+    // success
+    return EXIT_SUCCESS;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            invalid_arguments:
+
+                // print a usage message to standard out
+                print_usage(argv[0]);
+
+                // error
+                return EXIT_FAILURE;
+        }
+
+        // g10 errors
+        {
+            failed_to_start_jobs:
+
+                // log the error
+                log_error("Error: Failed to start the job system!\n");
+
+                // error
+                return EXIT_FAILURE;
+        }
+
+        // standard library errors
+        {
+            no_mem:
+
+                // log the error
+                log_error("Error: Out of memory!\n");
+
+                // error
+                return EXIT_FAILURE;
+        }
+    }
+}
+
+double bench_time ( fn_bench_case *pfn_case, size_t count )
+{
+
+    // initialized data
+    timestamp t0 = 0, t1 = 0;
+
+    // warm up
+    pfn_case(count);
+
+    // time the case
+    t0 = timer_high_precision();
+    for (size_t i = 0; i < BENCH_ITERATIONS; i++) pfn_case(count);
+    t1 = timer_high_precision();
+
+    // done
+    return (double)( t1 - t0 ) * 1000000000.0 / (double) timer_seconds_divisor() / BENCH_ITERATIONS / (double) count;
+}
+
+/** !
+ * A few instructions of work per element
+ *
+ * @param p_context unused
+ * @param begin     the first element
+ * @param end       one past the last element
+ *
+ * @return void
+ */
+static void bench_range ( void *p_context, size_t begin, size_t end )
+{
+
+    // unused
+    (void) p_context;
+
+    // hash each element
+    for (size_t i = begin; i < end; i++) p_data[i] = p_data[i] * 2654435761u + 1;
+}
+
+/** !
+ * No work
+ *
+ * @param p_context unused
+ *
+ * @return void
+ */
+static void bench_empty ( void *p_context )
+{
+
+    // unused
+    (void) p_context;
+}
+
+void bench_serial ( size_t count )
+{
+    bench_range(NULL, 0, count);
+}
+
+void bench_submit ( size_t count )
+{
+
+    // initialized data
+    job_counter _counter = { 0 };
+
+    // submit, then help run
+    for (size_t i = 0; i < count; i++) job_submit(bench_empty, NULL, &_counter);
+
+    job_wait(&_counter);
+}
+
+void bench_parallel_1 ( size_t count )
+{
+    job_parallel_for(count, 1, bench_range, NULL);
+}
+
+void bench_parallel_16 ( size_t count )
+{
+    job_parallel_for(count, 16, bench_range, NULL);
+}
+
+void bench_parallel_256 ( size_t count )
+{
+    job_parallel_for(count, 256, bench_range, NULL);
+}
+
+void bench_parallel_4096 ( size_t count )
+{
+    job_parallel_for(count, 4096, bench_range, NULL);
+}
+
+void bench_chain ( size_t count )
+{
+
+    // each link runs after the one before it
+    memset(_chain, 0, sizeof(_chain));
+
+    job_submit(bench_empty, NULL, &_chain[0]);
+
+    for (size_t i = 1; i < count; i++) job_submit_after(bench_empty, NULL, &_chain[i], &_chain[i - 1]);
+
+    // wait for every link, so no thread is still finishing one when the
+    // counters are reused
+    for (size_t i = 0; i < count; i++) job_wait(&_chain[i]);
+}
+
+void print_usage ( const char *argv0 )
+{
+
+    // argument check
+    if ( NULL == argv0 ) exit(EXIT_FAILURE);
+
+    // print a usage message to standard out
+    printf("Usage: %s [ workers [ element count ] ]\n", argv0);
+    printf("    workers  worker threads, or 0 for one less than the processors\n");
+
+    // done
+    return;
+}
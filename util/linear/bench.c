@@ -0,0 +1,348 @@
+/** !
+ * Linear algebra microbenchmark, one at a time against batches
+ *
+ * @file util/linear/bench.c
+ *
+ * @author Jacob Smith
+ */
+
+// standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// gsdk
+/// core
+#include <core/log.h>
+#include <core/sync.h>
+
+// g10
+#include <g10.h>
+#include <linear.h>
+#include <aabb.h>
+
+// preprocessor definitions
+#define BENCH_ITERATIONS 64
+#define BENCH_COUNT      4096
+
+// type definitions
+/** !
+ * Run one case of the benchmark over count elements
+ *
+ * @param count the quantity of elements
+ *
+ * @return void
+ */
+typedef void (fn_bench_case)( size_t count );
+
+// forward declarations
+/** !
+ * Print a usage message to standard out
+ *
+ * @param argv0 the name of the program
+ *
+ * @return void
+ */
+void print_usage ( const char *argv0 );
+
+/** !
+ * Time a case of the benchmark
+ *
+ * @param pfn_case the case
+ * @param count    the quantity of elements
+ *
+ * @return nanoseconds per element
+ */
+double bench_time ( fn_bench_case *pfn_case, size_t count );
+
+/// cases
+void bench_vec4_loop   ( size_t count );
+void bench_vec4_array  ( size_t count );
+void bench_vec4_soa    ( size_t count );
+void bench_mat4_loop   ( size_t count );
+void bench_mat4_array  ( size_t count );
+void bench_affine_loop ( size_t count );
+void bench_normal_loop ( size_t count );
+void bench_normal_affine ( size_t count );
+void bench_model_loop  ( size_t count );
+void bench_model_array ( size_t count );
+void bench_aabb_loop   ( size_t count );
+void bench_aabb_batch  ( size_t count );
+void bench_cull_loop   ( size_t count );
+void bench_cull_batch  ( size_t count );
+
+// data
+static mat4  m = { 0 };
+static mat4 *p_a = NULL, *p_b = NULL, *p_c = NULL;
+static vec4 *p_in = NULL, *p_out = NULL;
+static vec3 *p_location = NULL, *p_rotation = NULL, *p_scale = NULL;
+static vec4_soa soa_in = { 0 }, soa_out = { 0 };
+static aabb *p_boxes = NULL;
+static aabb_soa boxes_in = { 0 }, boxes_out = { 0 };
+static u8 *p_culled = NULL;
+static vec4 planes[6] = { 0 };
+
+static const struct
+{
+    const char    *p_name;
+    fn_bench_case *pfn_loop,
+                  *pfn_batch;
+} _cases[] =
+{
+    { "mat4 x vec4 (aos)"  , bench_vec4_loop , bench_vec4_array  },
+    { "mat4 x vec4 (soa)"  , bench_vec4_loop , bench_vec4_soa    },
+    { "mat4 x mat4"        , bench_mat4_loop , bench_mat4_array  },
+    { "mat4 x mat4 affine" , bench_mat4_loop , bench_affine_loop },
+    { "normal matrix"      , bench_normal_loop, bench_normal_affine },
+    { "model from vec3"    , bench_model_loop, bench_model_array },
+    { "aabb transform"     , bench_aabb_loop , bench_aabb_batch  },
+    { "aabb frustum cull"  , bench_cull_loop , bench_cull_batch  }
+};
+
+// entry point
+int main ( int argc, const char *argv[] )
+{
+
+    // initialized data
+    size_t count = BENCH_COUNT;
+
+    // error check
+    if ( argc > 2 ) goto invalid_arguments;
+
+    // parse the count
+    if ( argc == 2 ) count = strtoull(argv[1], NULL, 10);
+
+    // error check
+    if ( 0 == count ) goto invalid_arguments;
+
+    // allocate the operands
+    p_a        = default_allocator(0, count * sizeof(mat4)),
+    p_b        = default_allocator(0, count * sizeof(mat4)),
+    p_c        = default_allocator(0, count * sizeof(mat4)),
+    p_in       = default_allocator(0, count * sizeof(vec4)),
+    p_out      = default_allocator(0, count * sizeof(vec4)),
+    p_location = default_allocator(0, count * sizeof(vec3)),
+    p_rotation = default_allocator(0, count * sizeof(vec3)),
+    p_scale    = default_allocator(0, count * sizeof(vec3)),
+    p_boxes    = default_allocator(0, count * sizeof(aabb)),
+    p_culled   = default_allocator(0, count * sizeof(u8));
+
+    for (size_t i = 0; i < 4; i++)
+        (&soa_in.p_x)[i]  = default_allocator(0, count * sizeof(float)),
+        (&soa_out.p_x)[i] = default_allocator(0, count * sizeof(float));
+
+    for (size_t i = 0; i < 6; i++)
+        (&boxes_in.p_cx)[i]  = default_allocator(0, count * sizeof(float)),
+        (&boxes_out.p_cx)[i] = default_allocator(0, count * sizeof(float));
+
+    // populate the operands
+    for (size_t i = 0; i < 16; i++) (&m.a)[i] = (float)( i % 5 ) * 0.25f + 0.5f;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        for (size_t j = 0; j < 16; j++)
+            (&p_a[i].a)[j] = (float)( ( i + j ) % 7 ) * 0.125f,
+            (&p_b[i].a)[j] = (float)( ( i * j ) % 5 ) * 0.25f;
+
+        p_in[i]       = (vec4) { (float) i, (float) ( i % 3 ), (float) ( i % 5 ), 1.f },
+        p_location[i] = (vec3) { (float) i, 0.f, (float) -i },
+        p_rotation[i] = (vec3) { (float) ( i % 360 ), 45.f, 0.f },
+        p_scale[i]    = (vec3) { 1.f, 2.f, 1.f };
+
+        soa_in.p_x[i] = p_in[i].x,
+        soa_in.p_y[i] = p_in[i].y,
+        soa_in.p_z[i] = p_in[i].z,
+        soa_in.p_w[i] = p_in[i].w;
+
+        p_boxes[i] = (aabb) { ._min = { (float) -i, -1.f, (float) ( i % 7 ) }, ._max = { (float) -i + 2.f, 1.f, (float) ( i % 7 ) + 1.f } };
+
+        aabb_soa_set(boxes_in, i, &p_boxes[i]);
+    }
+
+    // a box shaped frustum, around half of the boxes
+    for (size_t i = 0; i < 6; i++)
+        planes[i] = (vec4) { ( i == 0 ) - ( i == 1 ), ( i == 2 ) - ( i == 3 ), ( i == 4 ) - ( i == 5 ), (float) count * 0.5f };
+
+    // header
+    printf("%-20s %-8s %12s %12s %8s\n", "kernel", "isa", "loop ns", "batch ns", "speedup");
+
+    // each instruction set this build supports on this processor
+    for (size_t isa = 0; isa < LINEAR_ISA_QTY; isa++)
+    {
+
+        // skip unsupported instruction sets
+        if ( 0 == linear_isa_set((enum linear_isa_e) isa) ) continue;
+
+        // each case
+        for (size_t i = 0; i < sizeof(_cases) / sizeof(*_cases); i++)
+        {
+
+            // initialized data
+            double loop_ns  = bench_time(_cases[i].pfn_loop, count),
+                   batch_ns = bench_time(_cases[i].pfn_batch, count);
+
+            // print the result
+            printf("%-20s %-8s %12.2f %12.2f %7.1fx\n", _cases[i].p_name, linear_isa_name((enum linear_isa_e) isa), loop_ns, batch_ns, loop_ns / ( batch_ns > 0 ? batch_ns : 1e-9 ));
+        }
+    }
+
+    // summary
+    printf("%zu elements, %d iterations each\n", count, BENCH_ITERATIONS);
+
+    // clean up
+    for (size_t i = 0; i < 4; i++)
+        (&soa_in.p_x)[i]  = default_allocator((&soa_in.p_x)[i], 0),
+        (&soa_out.p_x)[i] = default_allocator((&soa_out.p_x)[i], 0);
+
+    for (size_t i = 0; i < 6; i++)
+        (&boxes_in.p_cx)[i]  = default_allocator((&boxes_in.p_cx)[i], 0),
+        (&boxes_out.p_cx)[i] = default_allocator((&boxes_out.p_cx)[i], 0);
+
+    p_a        = default_allocator(p_a, 0),
+    p_b        = default_allocator(p_b, 0),
+    p_c        = default_allocator(p_c, 0),
+    p_in       = default_allocator(p_in, 0),
+    p_out      = default_allocator(p_out, 0),
+    p_location = default_allocator(p_location, 0),
+    p_rotation = default_allocator(p_rotation, 0),
+    p_scale    = default_allocator(p_scale, 0),
+    p_boxes    = default_allocator(p_boxes, 0),
+    p_culled   = default_allocator(p_culled, 0);
+
+    // success
+    return EXIT_SUCCESS;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            invalid_arguments:
+
+                // print a usage message to standard out
+                print_usage(argv[0]);
+
+                // error
+                return EXIT_FAILURE;
+        }
+    }
+}
+
+double bench_time ( fn_bench_case *pfn_case, size_t count )
+{
+
+    // initialized data
+    timestamp t0 = 0, t1 = 0;
+
+    // warm up
+    pfn_case(count);
+
+    // time the case
+    t0 = timer_high_precision();
+    for (size_t i = 0; i < BENCH_ITERATIONS; i++) pfn_case(count);
+    t1 = timer_high_precision();
+
+    // done
+    return (double)( t1 - t0 ) * 1000000000.0 / (double) timer_seconds_divisor() / BENCH_ITERATIONS / (double) count;
+}
+
+void bench_vec4_loop ( size_t count )
+{
+    for (size_t i = 0; i < count; i++) mat4_mul_vec4(&p_out[i], m, p_in[i]);
+}
+
+void bench_vec4_array ( size_t count )
+{
+    mat4_mul_vec4_array(p_out, m, p_in, count);
+}
+
+void bench_vec4_soa ( size_t count )
+{
+    mat4_mul_vec4_soa(&soa_out, m, soa_in, count);
+}
+
+void bench_mat4_loop ( size_t count )
+{
+    for (size_t i = 0; i < count; i++) mat4_mul_mat4(&p_c[i], p_a[i], p_b[i]);
+}
+
+void bench_mat4_array ( size_t count )
+{
+    mat4_mul_mat4_array(p_c, p_a, p_b, count);
+}
+
+void bench_affine_loop ( size_t count )
+{
+    for (size_t i = 0; i < count; i++) mat4_mul_mat4_affine(&p_c[i], p_a[i], p_b[i]);
+}
+
+void bench_normal_loop ( size_t count )
+{
+    for (size_t i = 0; i < count; i++)
+    {
+
+        // initialized data
+        mat4 inverse = { 0 };
+
+        // the general inverse transpose
+        mat4_inverse(&inverse, p_a[i]);
+        mat4_transpose(&p_c[i], inverse);
+    }
+}
+
+void bench_normal_affine ( size_t count )
+{
+    for (size_t i = 0; i < count; i++) mat4_normal_matrix((mat3 *) &p_c[i], p_a[i]);
+}
+
+void bench_model_loop ( size_t count )
+{
+    for (size_t i = 0; i < count; i++) mat4_model_from_vec3(&p_c[i], p_location[i], p_rotation[i], p_scale[i]);
+}
+
+void bench_model_array ( size_t count )
+{
+    mat4_model_from_vec3_array(p_c, p_location, p_rotation, p_scale, count);
+}
+
+void bench_aabb_loop ( size_t count )
+{
+    for (size_t i = 0; i < count; i++)
+    {
+
+        // initialized data
+        aabb _aabb = { 0 };
+
+        // one box at a time
+        aabb_transform(&_aabb, &p_boxes[i], p_a[i]);
+        aabb_soa_set(boxes_out, i, &_aabb);
+    }
+}
+
+void bench_aabb_batch ( size_t count )
+{
+    aabb_transform_batch(&boxes_out, p_a, boxes_in, count);
+}
+
+void bench_cull_loop ( size_t count )
+{
+    for (size_t i = 0; i < count; i++) p_culled[i] = (u8) aabb_cull_frustum(&p_boxes[i], planes);
+}
+
+void bench_cull_batch ( size_t count )
+{
+    aabb_cull_frustum_batch(p_culled, planes, boxes_in, count);
+}
+
+void print_usage ( const char *argv0 )
+{
+
+    // argument check
+    if ( NULL == argv0 ) exit(EXIT_FAILURE);
+
+    // print a usage message to standard out
+    printf("Usage: %s [ element count ]\n", argv0);
+
+    // done
+    return;
+}
@@ -0,0 +1,626 @@
+/** !
+ * Math microbenchmark suite. Times every linear algebra kernel, the aabb
+ * tests, and frustum extraction, prints nanoseconds per operation as json,
+ * and optionally fails on a regression against a stored baseline
+ *
+ * @file util/math/bench.c
+ *
+ * @author Jacob Smith
+ */
+
+// standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// gsdk
+/// core
+#include <core/log.h>
+#include <core/sync.h>
+
+/// reflection
+#include <reflection/json.h>
+
+// g10
+#include <g10.h>
+#include <linear.h>
+#include <quaternion.h>
+#include <aabb.h>
+#include <camera.h>
+#include <transform.h>
+#include <job.h>
+
+// preprocessor definitions
+#define BENCH_COUNT      4096
+#define BENCH_ITERATIONS 16
+#define BENCH_SAMPLES    7
+#define BENCH_THRESHOLD  10.0
+
+// a case that calls a function once per element
+#define BENCH_CASE(name, call) static void bench_##name ( size_t count ) { for (size_t i = 0; i < count; i++) call; }
+
+// a case that calls a batch function once for every element
+#define BENCH_BATCH(name, call) static void bench_##name ( size_t count ) { call; }
+
+// an entry in the table of cases
+#define BENCH_ENTRY(name) { #name, bench_##name }
+
+// type definitions
+/** !
+ * Run one case of the benchmark over count elements
+ *
+ * @param count the quantity of elements
+ *
+ * @return void
+ */
+typedef void (fn_bench_case)( size_t count );
+
+// forward declarations
+/** !
+ * Print a usage message to standard out
+ *
+ * @param argv0 the name of the program
+ *
+ * @return void
+ */
+void print_usage ( const char *argv0 );
+
+/** !
+ * Time a case of the benchmark. Each sample runs the case several times,
+ * and the median sample is kept, so one preempted sample does not move
+ * the result
+ *
+ * @param pfn_case the case
+ * @param count    the quantity of elements
+ *
+ * @return nanoseconds per element
+ */
+double bench_time ( fn_bench_case *pfn_case, size_t count );
+
+/** !
+ * Compare results against a baseline, and log each regression
+ *
+ * @param p_path    path to a json baseline written by this program
+ * @param p_ns      nanoseconds per element of each case
+ * @param threshold the largest allowed slow down, in percent
+ *
+ * @return the quantity of regressions on success, -1 on error
+ */
+int bench_compare ( const char *p_path, const double *p_ns, double threshold );
+
+// data
+static size_t     _count = 0;
+static vec2       *p_a2 = NULL, *p_b2 = NULL, *p_r2 = NULL;
+static vec3       *p_a3 = NULL, *p_b3 = NULL, *p_r3 = NULL;
+static vec4       *p_a4 = NULL, *p_b4 = NULL, *p_r4 = NULL;
+static mat2       *p_m2 = NULL, *p_n2 = NULL, *p_rm2 = NULL;
+static mat3       *p_m3 = NULL, *p_n3 = NULL, *p_rm3 = NULL;
+static mat4       *p_m4 = NULL, *p_n4 = NULL, *p_rm4 = NULL;
+static quaternion *p_q  = NULL, *p_r  = NULL, *p_rq = NULL;
+static float      *p_f  = NULL;
+static aabb       *p_boxes = NULL, *p_rboxes = NULL;
+static u8         *p_flags = NULL;
+static u8          _buffer[64] = { 0 };
+static vec4_soa    soa_in = { 0 }, soa_out = { 0 };
+static aabb_soa    boxes_in = { 0 }, boxes_out = { 0 };
+static vec4        planes[6] = { 0 };
+static camera      _camera = { 0 };
+static transform          **pp_transforms = NULL;
+static transform_hierarchy *p_hierarchy   = NULL;
+
+// cases
+/// vec2
+BENCH_CASE(vec2_add_vec2  , vec2_add_vec2(&p_r2[i], p_a2[i], p_b2[i]))
+BENCH_CASE(vec2_sub_vec2  , vec2_sub_vec2(&p_r2[i], p_a2[i], p_b2[i]))
+BENCH_CASE(vec2_mul_vec2  , vec2_mul_vec2(&p_r2[i], p_a2[i], p_b2[i]))
+BENCH_CASE(vec2_div_vec2  , vec2_div_vec2(&p_r2[i], p_a2[i], p_b2[i]))
+BENCH_CASE(vec2_mul_scalar, vec2_mul_scalar(&p_r2[i], p_a2[i], p_f[i]))
+BENCH_CASE(vec2_to_vec3   , vec2_to_vec3(&p_r3[i], p_a2[i]))
+BENCH_CASE(vec2_to_vec4   , vec2_to_vec4(&p_r4[i], p_a2[i]))
+BENCH_CASE(vec2_length    , vec2_length(&p_f[i], p_a2[i]))
+
+/// vec3
+BENCH_CASE(vec3_add_vec3     , vec3_add_vec3(&p_r3[i], p_a3[i], p_b3[i]))
+BENCH_CASE(vec3_sub_vec3     , vec3_sub_vec3(&p_r3[i], p_a3[i], p_b3[i]))
+BENCH_CASE(vec3_mul_vec3     , vec3_mul_vec3(&p_r3[i], p_a3[i], p_b3[i]))
+BENCH_CASE(vec3_div_vec3     , vec3_div_vec3(&p_r3[i], p_a3[i], p_b3[i]))
+BENCH_CASE(vec3_mul_scalar   , vec3_mul_scalar(&p_r3[i], p_a3[i], p_f[i]))
+BENCH_CASE(vec3_to_vec2      , vec3_to_vec2(&p_r2[i], p_a3[i]))
+BENCH_CASE(vec3_to_vec4      , vec3_to_vec4(&p_r4[i], p_a3[i]))
+BENCH_CASE(vec3_dot_product  , vec3_dot_product(&p_f[i], p_a3[i], p_b3[i]))
+BENCH_CASE(vec3_cross_product, vec3_cross_product(&p_r3[i], p_a3[i], p_b3[i]))
+BENCH_CASE(vec3_length       , vec3_length(&p_f[i], p_a3[i]))
+BENCH_CASE(vec3_normalize    , vec3_normalize(&p_r3[i], p_a3[i]))
+BENCH_CASE(vec3_pack         , vec3_pack(_buffer, &p_a3[i]))
+
+/// vec4
+BENCH_CASE(vec4_add_vec4  , vec4_add_vec4(&p_r4[i], p_a4[i], p_b4[i]))
+BENCH_CASE(vec4_sub_vec4  , vec4_sub_vec4(&p_r4[i], p_a4[i], p_b4[i]))
+BENCH_CASE(vec4_mul_vec4  , vec4_mul_vec4(&p_r4[i], p_a4[i], p_b4[i]))
+BENCH_CASE(vec4_div_vec4  , vec4_div_vec4(&p_r4[i], p_a4[i], p_b4[i]))
+BENCH_CASE(vec4_to_vec2   , vec4_to_vec2(&p_r2[i], p_a4[i]))
+BENCH_CASE(vec4_to_vec3   , vec4_to_vec3(&p_r3[i], p_a4[i]))
+BENCH_CASE(vec4_length    , vec4_length(&p_f[i], p_a4[i]))
+
+/// mat2
+BENCH_CASE(mat2_mul_vec2 , mat2_mul_vec2(&p_r2[i], p_m2[i], p_a2[i]))
+BENCH_CASE(mat2_mul_mat2 , mat2_mul_mat2(&p_rm2[i], p_m2[i], p_n2[i]))
+BENCH_CASE(mat2_transpose, mat2_transpose(&p_rm2[i], p_m2[i]))
+BENCH_CASE(mat2_identity , mat2_identity(&p_rm2[i]))
+BENCH_CASE(mat2_to_mat3  , mat2_to_mat3(&p_rm3[i], p_m2[i]))
+BENCH_CASE(mat2_to_mat4  , mat2_to_mat4(&p_rm4[i], p_m2[i]))
+
+/// mat3
+BENCH_CASE(mat3_mul_vec3 , mat3_mul_vec3(&p_r3[i], p_m3[i], p_a3[i]))
+BENCH_CASE(mat3_mul_mat3 , mat3_mul_mat3(&p_rm3[i], p_m3[i], p_n3[i]))
+BENCH_CASE(mat3_transpose, mat3_transpose(&p_rm3[i], p_m3[i]))
+BENCH_CASE(mat3_identity , mat3_identity(&p_rm3[i]))
+BENCH_CASE(mat3_to_mat2  , mat3_to_mat2(&p_rm2[i], p_m3[i]))
+BENCH_CASE(mat3_to_mat4  , mat3_to_mat4(&p_rm4[i], p_m3[i]))
+BENCH_CASE(mat3_pack     , mat3_pack(_buffer, &p_m3[i]))
+
+/// mat4
+BENCH_CASE(mat4_mul_vec4           , mat4_mul_vec4(&p_r4[i], p_m4[i], p_a4[i]))
+BENCH_CASE(mat4_mul_mat4           , mat4_mul_mat4(&p_rm4[i], p_m4[i], p_n4[i]))
+BENCH_CASE(mat4_identity           , mat4_identity(&p_rm4[i]))
+BENCH_CASE(mat4_to_mat2            , mat4_to_mat2(&p_rm2[i], p_m4[i]))
+BENCH_CASE(mat4_to_mat3            , mat4_to_mat3(&p_rm3[i], p_m4[i]))
+BENCH_CASE(mat4_transpose          , mat4_transpose(&p_rm4[i], p_m4[i]))
+BENCH_CASE(mat4_inverse            , mat4_inverse(&p_rm4[i], p_m4[i]))
+BENCH_CASE(mat4_translation        , mat4_translation(&p_rm4[i], p_a3[i]))
+BENCH_CASE(mat4_scale              , mat4_scale(&p_rm4[i], p_a3[i]))
+BENCH_CASE(mat4_rotation_from_vec3 , mat4_rotation_from_vec3(&p_rm4[i], p_a3[i]))
+BENCH_CASE(mat4_model_from_vec3    , mat4_model_from_vec3(&p_rm4[i], p_a3[i], p_b3[i], p_a3[i]))
+BENCH_CASE(mat4_model_from_rotation, mat4_model_from_rotation(&p_rm4[i], p_a3[i], p_n4[i], p_b3[i]))
+BENCH_CASE(mat4_model_from_bounds  , mat4_model_from_bounds(&p_rm4[i], p_boxes[i]._min, p_boxes[i]._max))
+BENCH_CASE(mat4_pack               , mat4_pack(_buffer, &p_m4[i]))
+
+/// affine
+BENCH_CASE(mat4_mul_mat4_affine, mat4_mul_mat4_affine(&p_rm4[i], p_m4[i], p_n4[i]))
+BENCH_CASE(mat4_inverse_affine , mat4_inverse_affine(&p_rm4[i], p_m4[i]))
+BENCH_CASE(mat4_inverse_rigid  , mat4_inverse_rigid(&p_rm4[i], p_n4[i]))
+BENCH_CASE(mat4_mul_point      , mat4_mul_point(&p_r3[i], p_m4[i], p_a3[i]))
+BENCH_CASE(mat4_mul_direction  , mat4_mul_direction(&p_r3[i], p_m4[i], p_a3[i]))
+BENCH_CASE(mat4_normal_matrix  , mat4_normal_matrix(&p_rm3[i], p_m4[i]))
+
+/// batches
+BENCH_BATCH(mat4_mul_vec4_array       , mat4_mul_vec4_array(p_r4, p_m4[0], p_a4, count))
+BENCH_BATCH(mat4_mul_vec4_soa         , mat4_mul_vec4_soa(&soa_out, p_m4[0], soa_in, count))
+BENCH_BATCH(mat4_mul_mat4_array       , mat4_mul_mat4_array(p_rm4, p_m4, p_n4, count))
+BENCH_BATCH(mat4_model_from_vec3_array, mat4_model_from_vec3_array(p_rm4, p_a3, p_b3, p_a3, count))
+
+/// quaternion
+BENCH_CASE(quaternion_identity       , quaternion_identity(&p_rq[i]))
+BENCH_CASE(quaternion_from_euler     , quaternion_from_euler(&p_rq[i], p_b3[i]))
+BENCH_CASE(quaternion_from_axis_angle, quaternion_from_axis_angle(&p_rq[i], p_a3[i], p_f[i]))
+BENCH_CASE(quaternion_mul_quaternion , quaternion_mul_quaternion(&p_rq[i], p_q[i], p_r[i]))
+BENCH_CASE(quaternion_conjugate      , quaternion_conjugate(&p_rq[i], p_q[i]))
+BENCH_CASE(quaternion_normalize      , quaternion_normalize(&p_rq[i], p_q[i]))
+BENCH_CASE(quaternion_nlerp          , quaternion_nlerp(&p_rq[i], p_q[i], p_r[i], 0.25f))
+BENCH_CASE(quaternion_slerp          , quaternion_slerp(&p_rq[i], p_q[i], p_r[i], 0.25f))
+BENCH_CASE(quaternion_rotate_vec3    , quaternion_rotate_vec3(&p_r3[i], p_q[i], p_a3[i]))
+BENCH_CASE(quaternion_to_mat4        , quaternion_to_mat4(&p_rm4[i], p_q[i]))
+BENCH_CASE(quaternion_to_euler       , quaternion_to_euler(&p_r3[i], p_q[i]))
+BENCH_CASE(mat4_model_from_quaternion, mat4_model_from_quaternion(&p_rm4[i], p_a3[i], p_q[i], p_b3[i]))
+BENCH_CASE(quaternion_pack           , quaternion_pack(_buffer, &p_q[i]))
+
+/// aabb
+BENCH_CASE(aabb_transform          , aabb_transform(&p_rboxes[i], &p_boxes[i], p_m4[i]))
+BENCH_CASE(aabb_intersect          , p_flags[i] = (u8) aabb_intersect(&p_boxes[i], &p_boxes[count - 1 - i]))
+BENCH_CASE(aabb_contains           , p_flags[i] = (u8) aabb_contains(&p_boxes[i], p_a3[i]))
+BENCH_CASE(aabb_cull_frustum       , p_flags[i] = (u8) aabb_cull_frustum(&p_boxes[i], planes))
+BENCH_BATCH(aabb_transform_batch   , aabb_transform_batch(&boxes_out, p_m4, boxes_in, count))
+BENCH_BATCH(aabb_cull_frustum_batch, aabb_cull_frustum_batch(p_flags, planes, boxes_in, count))
+BENCH_BATCH(aabb_overlap_batch     , aabb_overlap_batch(p_flags, &p_boxes[0], boxes_in, count))
+
+/// camera
+BENCH_CASE(camera_update_frustum, camera_update_frustum(&_camera))
+
+/// transform hierarchy. every transform moves, then the hierarchy updates
+static void bench_transform_hierarchy_update ( size_t count )
+{
+    for (size_t i = 0; i < count; i++) transform_set_location(pp_transforms[i], p_a3[i]);
+
+    transform_hierarchy_update(p_hierarchy);
+}
+
+static const struct
+{
+    const char    *p_name;
+    fn_bench_case *pfn_case;
+} _cases[] =
+{
+    BENCH_ENTRY(vec2_add_vec2), BENCH_ENTRY(vec2_sub_vec2), BENCH_ENTRY(vec2_mul_vec2), BENCH_ENTRY(vec2_div_vec2),
+    BENCH_ENTRY(vec2_mul_scalar), BENCH_ENTRY(vec2_to_vec3), BENCH_ENTRY(vec2_to_vec4), BENCH_ENTRY(vec2_length),
+
+    BENCH_ENTRY(vec3_add_vec3), BENCH_ENTRY(vec3_sub_vec3), BENCH_ENTRY(vec3_mul_vec3), BENCH_ENTRY(vec3_div_vec3),
+    BENCH_ENTRY(vec3_mul_scalar), BENCH_ENTRY(vec3_to_vec2), BENCH_ENTRY(vec3_to_vec4), BENCH_ENTRY(vec3_dot_product),
+    BENCH_ENTRY(vec3_cross_product), BENCH_ENTRY(vec3_length), BENCH_ENTRY(vec3_normalize), BENCH_ENTRY(vec3_pack),
+
+    BENCH_ENTRY(vec4_add_vec4), BENCH_ENTRY(vec4_sub_vec4), BENCH_ENTRY(vec4_mul_vec4), BENCH_ENTRY(vec4_div_vec4),
+    BENCH_ENTRY(vec4_to_vec2), BENCH_ENTRY(vec4_to_vec3), BENCH_ENTRY(vec4_length),
+
+    BENCH_ENTRY(mat2_mul_vec2), BENCH_ENTRY(mat2_mul_mat2), BENCH_ENTRY(mat2_transpose), BENCH_ENTRY(mat2_identity),
+    BENCH_ENTRY(mat2_to_mat3), BENCH_ENTRY(mat2_to_mat4),
+
+    BENCH_ENTRY(mat3_mul_vec3), BENCH_ENTRY(mat3_mul_mat3), BENCH_ENTRY(mat3_transpose), BENCH_ENTRY(mat3_identity),
+    BENCH_ENTRY(mat3_to_mat2), BENCH_ENTRY(mat3_to_mat4), BENCH_ENTRY(mat3_pack),
+
+    BENCH_ENTRY(mat4_mul_vec4), BENCH_ENTRY(mat4_mul_mat4), BENCH_ENTRY(mat4_identity), BENCH_ENTRY(mat4_to_mat2),
+    BENCH_ENTRY(mat4_to_mat3), BENCH_ENTRY(mat4_transpose), BENCH_ENTRY(mat4_inverse), BENCH_ENTRY(mat4_translation),
+    BENCH_ENTRY(mat4_scale), BENCH_ENTRY(mat4_rotation_from_vec3), BENCH_ENTRY(mat4_model_from_vec3),
+    BENCH_ENTRY(mat4_model_from_rotation), BENCH_ENTRY(mat4_model_from_bounds), BENCH_ENTRY(mat4_pack),
+
+    BENCH_ENTRY(mat4_mul_mat4_affine), BENCH_ENTRY(mat4_inverse_affine), BENCH_ENTRY(mat4_inverse_rigid),
+    BENCH_ENTRY(mat4_mul_point), BENCH_ENTRY(mat4_mul_direction), BENCH_ENTRY(mat4_normal_matrix),
+
+    BENCH_ENTRY(mat4_mul_vec4_array), BENCH_ENTRY(mat4_mul_vec4_soa), BENCH_ENTRY(mat4_mul_mat4_array),
+    BENCH_ENTRY(mat4_model_from_vec3_array),
+
+    BENCH_ENTRY(quaternion_identity), BENCH_ENTRY(quaternion_from_euler), BENCH_ENTRY(quaternion_from_axis_angle),
+    BENCH_ENTRY(quaternion_mul_quaternion), BENCH_ENTRY(quaternion_conjugate), BENCH_ENTRY(quaternion_normalize),
+    BENCH_ENTRY(quaternion_nlerp), BENCH_ENTRY(quaternion_slerp), BENCH_ENTRY(quaternion_rotate_vec3),
+    BENCH_ENTRY(quaternion_to_mat4), BENCH_ENTRY(quaternion_to_euler), BENCH_ENTRY(mat4_model_from_quaternion),
+    BENCH_ENTRY(quaternion_pack),
+
+    BENCH_ENTRY(aabb_transform), BENCH_ENTRY(aabb_intersect), BENCH_ENTRY(aabb_contains), BENCH_ENTRY(aabb_cull_frustum),
+    BENCH_ENTRY(aabb_transform_batch), BENCH_ENTRY(aabb_cull_frustum_batch), BENCH_ENTRY(aabb_overlap_batch),
+
+    BENCH_ENTRY(camera_update_frustum),
+
+    BENCH_ENTRY(transform_hierarchy_update)
+};
+
+#define BENCH_CASE_QTY ( sizeof(_cases) / sizeof(*_cases) )
+
+// entry point
+int main ( int argc, const char *argv[] )
+{
+
+    // initialized data
+    const char *p_baseline = NULL;
+    double threshold = BENCH_THRESHOLD;
+    double ns[BENCH_CASE_QTY] = { 0 };
+    int regressions = 0;
+
+    // default count
+    _count = BENCH_COUNT;
+
+    // parse command line arguments
+    for (int i = 1; i < argc; i++)
+    {
+
+        // each option takes a value
+        if ( i + 1 == argc ) goto invalid_arguments;
+
+        // element count
+        if      ( 0 == strcmp(argv[i], "--count") )     _count     = strtoull(argv[++i], NULL, 10);
+
+        // baseline
+        else if ( 0 == strcmp(argv[i], "--baseline") )  p_baseline = argv[++i];
+
+        // threshold
+        else if ( 0 == strcmp(argv[i], "--threshold") ) threshold  = strtod(argv[++i], NULL);
+
+        // default
+        else goto invalid_arguments;
+    }
+
+    // error check
+    if ( 0 == _count || threshold < 0.0 ) goto invalid_arguments;
+
+    // allocate the operands
+    p_a2     = default_allocator(0, _count * sizeof(vec2)),
+    p_b2     = default_allocator(0, _count * sizeof(vec2)),
+    p_r2     = default_allocator(0, _count * sizeof(vec2)),
+    p_a3     = default_allocator(0, _count * sizeof(vec3)),
+    p_b3     = default_allocator(0, _count * sizeof(vec3)),
+    p_r3     = default_allocator(0, _count * sizeof(vec3)),
+    p_a4     = default_allocator(0, _count * sizeof(vec4)),
+    p_b4     = default_allocator(0, _count * sizeof(vec4)),
+    p_r4     = default_allocator(0, _count * sizeof(vec4)),
+    p_m2     = default_allocator(0, _count * sizeof(mat2)),
+    p_n2     = default_allocator(0, _count * sizeof(mat2)),
+    p_rm2    = default_allocator(0, _count * sizeof(mat2)),
+    p_m3     = default_allocator(0, _count * sizeof(mat3)),
+    p_n3     = default_allocator(0, _count * sizeof(mat3)),
+    p_rm3    = default_allocator(0, _count * sizeof(mat3)),
+    p_m4     = default_allocator(0, _count * sizeof(mat4)),
+    p_n4     = default_allocator(0, _count * sizeof(mat4)),
+    p_rm4    = default_allocator(0, _count * sizeof(mat4)),
+    p_q      = default_allocator(0, _count * sizeof(quaternion)),
+    p_r      = default_allocator(0, _count * sizeof(quaternion)),
+    p_rq     = default_allocator(0, _count * sizeof(quaternion)),
+    p_f      = default_allocator(0, _count * sizeof(float)),
+    p_boxes  = default_allocator(0, _count * sizeof(aabb)),
+    p_rboxes = default_allocator(0, _count * sizeof(aabb)),
+    p_flags  = default_allocator(0, _count * sizeof(u8));
+
+    for (size_t i = 0; i < 4; i++)
+        (&soa_in.p_x)[i]  = default_allocator(0, _count * sizeof(float)),
+        (&soa_out.p_x)[i] = default_allocator(0, _count * sizeof(float));
+
+    for (size_t i = 0; i < 6; i++)
+        (&boxes_in.p_cx)[i]  = default_allocator(0, _count * sizeof(float)),
+        (&boxes_out.p_cx)[i] = default_allocator(0, _count * sizeof(float));
+
+    // populate the operands. the matrices are the model matrices of a scene
+    for (size_t i = 0; i < _count; i++)
+    {
+
+        // initialized data
+        float x = (float) ( i % 97 ) * 0.25f + 1.f,
+              y = (float) ( i % 13 ) * 0.5f  + 1.f,
+              z = (float) ( i % 7 )  + 1.f;
+
+        p_a2[i] = (vec2) { x, y },
+        p_b2[i] = (vec2) { y, z },
+        p_a3[i] = (vec3) { x, y, z },
+        p_b3[i] = (vec3) { z * 10.f, x * 10.f, y * 10.f },
+        p_a4[i] = (vec4) { x, y, z, 1.f },
+        p_b4[i] = (vec4) { z, x, y, 1.f },
+        p_m2[i] = (mat2) { x, y, z, x },
+        p_n2[i] = (mat2) { y, z, x, y },
+        p_f[i]  = y;
+
+        mat4_model_from_vec3(&p_m4[i], p_a3[i], p_b3[i], (vec3) { 1.f, y, 1.f }),
+        mat4_model_from_vec3(&p_n4[i], p_b3[i], p_a3[i], (vec3) { 1.f, 1.f, 1.f }),
+        mat4_to_mat3(&p_m3[i], p_m4[i]),
+        mat4_to_mat3(&p_n3[i], p_n4[i]),
+        quaternion_from_euler(&p_q[i], p_b3[i]),
+        quaternion_from_euler(&p_r[i], p_a3[i]);
+
+        p_boxes[i] = (aabb) { ._min = { x - 1.f, y - 1.f, -z }, ._max = { x + 1.f, y + z, z } };
+
+        soa_in.p_x[i] = p_a4[i].x,
+        soa_in.p_y[i] = p_a4[i].y,
+        soa_in.p_z[i] = p_a4[i].z,
+        soa_in.p_w[i] = p_a4[i].w;
+
+        aabb_soa_set(boxes_in, i, &p_boxes[i]);
+    }
+
+    // a hierarchy of root transforms
+    pp_transforms = default_allocator(0, _count * sizeof(transform *));
+    transform_hierarchy_construct(&p_hierarchy);
+    for (size_t i = 0; i < _count; i++)
+        transform_construct(&pp_transforms[i], p_a3[i], p_b3[i], (vec3) { 1.f, 1.f, 1.f }, (void *) 0),
+        transform_hierarchy_add(p_hierarchy, pp_transforms[i]);
+
+    // a camera looking across the boxes
+    _camera.view.location = (vec3) { -10.f, 5.f, 0.f },
+    _camera.view.target   = (vec3) {   0.f, 5.f, 0.f },
+    _camera.view.up       = (vec3) {   0.f, 0.f, 1.f };
+
+    camera_matrix_view(&_camera.matrix._view, _camera.view.location, _camera.view.target, _camera.view.up);
+    camera_matrix_projection_perspective(&_camera.matrix._projection, 1.2f, 16.f / 9.f, 0.1f, 100.f);
+    camera_update_frustum(&_camera);
+    memcpy(planes, _camera.frustum.planes, sizeof(planes));
+
+    // time each case
+    for (size_t i = 0; i < BENCH_CASE_QTY; i++) ns[i] = bench_time(_cases[i].pfn_case, _count);
+
+    // print the results
+    printf("{\n");
+    printf("    \"isa\"        : \"%s\",\n", linear_isa_name(linear_isa_get()));
+    printf("    \"workers\"    : %zu,\n", job_worker_count());
+    printf("    \"count\"      : %zu,\n", _count);
+    printf("    \"iterations\" : %d,\n", BENCH_ITERATIONS);
+    printf("    \"samples\"    : %d,\n", BENCH_SAMPLES);
+    printf("    \"ns_per_op\"  :\n    {\n");
+
+    for (size_t i = 0; i < BENCH_CASE_QTY; i++)
+        printf("        \"%s\"%*s: %.3f%s\n", _cases[i].p_name, (int) ( 28 - strlen(_cases[i].p_name) ), "", ns[i], ( i + 1 < BENCH_CASE_QTY ) ? "," : "");
+
+    printf("    }\n}\n");
+
+    // compare against the baseline
+    if ( p_baseline ) regressions = bench_compare(p_baseline, ns, threshold);
+
+    // error check
+    if ( -1 == regressions ) goto failed_to_load_baseline;
+
+    // clean up
+    transform_hierarchy_destroy(&p_hierarchy);
+    for (size_t i = 0; i < _count; i++) transform_destroy(&pp_transforms[i]);
+    pp_transforms = default_allocator(pp_transforms, 0);
+    job_quit();
+
+    for (size_t i = 0; i < 4; i++)
+        (&soa_in.p_x)[i]  = default_allocator((&soa_in.p_x)[i], 0),
+        (&soa_out.p_x)[i] = default_allocator((&soa_out.p_x)[i], 0);
+
+    for (size_t i = 0; i < 6; i++)
+        (&boxes_in.p_cx)[i]  = default_allocator((&boxes_in.p_cx)[i], 0),
+        (&boxes_out.p_cx)[i] = default_allocator((&boxes_out.p_cx)[i], 0);
+
+    p_a2     = default_allocator(p_a2, 0),
+    p_b2     = default_allocator(p_b2, 0),
+    p_r2     = default_allocator(p_r2, 0),
+    p_a3     = default_allocator(p_a3, 0),
+    p_b3     = default_allocator(p_b3, 0),
+    p_r3     = default_allocator(p_r3, 0),
+    p_a4     = default_allocator(p_a4, 0),
+    p_b4     = default_allocator(p_b4, 0),
+    p_r4     = default_allocator(p_r4, 0),
+    p_m2     = default_allocator(p_m2, 0),
+    p_n2     = default_allocator(p_n2, 0),
+    p_rm2    = default_allocator(p_rm2, 0),
+    p_m3     = default_allocator(p_m3, 0),
+    p_n3     = default_allocator(p_n3, 0),
+    p_rm3    = default_allocator(p_rm3, 0),
+    p_m4     = default_allocator(p_m4, 0),
+    p_n4     = default_allocator(p_n4, 0),
+    p_rm4    = default_allocator(p_rm4, 0),
+    p_q      = default_allocator(p_q, 0),
+    p_r      = default_allocator(p_r, 0),
+    p_rq     = default_allocator(p_rq, 0),
+    p_f      = default_allocator(p_f, 0),
+    p_boxes  = default_allocator(p_boxes, 0),
+    p_rboxes = default_allocator(p_rboxes, 0),
+    p_flags  = default_allocator(p_flags, 0);
+
+    // done
+    return ( regressions ) ? EXIT_FAILURE : EXIT_SUCCESS;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            invalid_arguments:
+
+                // print a usage message to standard out
+                print_usage(argv[0]);
+
+                // error
+                return EXIT_FAILURE;
+        }
+
+        // file errors
+        {
+            failed_to_load_baseline:
+                log_error("Error: Failed to load baseline \"%s\"\n", p_baseline);
+
+                // error
+                return EXIT_FAILURE;
+        }
+    }
+}
+
+double bench_time ( fn_bench_case *pfn_case, size_t count )
+{
+
+    // initialized data
+    double samples[BENCH_SAMPLES] = { 0 };
+
+    // warm up
+    pfn_case(count);
+
+    // take each sample
+    for (size_t s = 0; s < BENCH_SAMPLES; s++)
+    {
+
+        // initialized data
+        timestamp t0 = 0, t1 = 0;
+
+        // time the case
+        t0 = timer_high_precision();
+        for (size_t i = 0; i < BENCH_ITERATIONS; i++) pfn_case(count);
+        t1 = timer_high_precision();
+
+        // store the sample
+        samples[s] = (double)( t1 - t0 ) * 1000000000.0 / (double) timer_seconds_divisor() / BENCH_ITERATIONS / (double) count;
+    }
+
+    // sort the samples
+    for (size_t i = 1; i < BENCH_SAMPLES; i++)
+        for (size_t j = i; j > 0 && samples[j - 1] > samples[j]; j--)
+        {
+            double t = samples[j];
+            samples[j] = samples[j - 1], samples[j - 1] = t;
+        }
+
+    // done
+    return samples[BENCH_SAMPLES / 2];
+}
+
+int bench_compare ( const char *p_path, const double *p_ns, double threshold )
+{
+
+    // initialized data
+    size_t      len      = load_file(p_path, NULL, false);
+    char       *p_text   = NULL;
+    json_value *p_value  = NULL,
+               *p_result = NULL;
+    int         regressions = 0;
+
+    // error check
+    if ( 0 == len ) goto failed_to_load_file;
+
+    // load the file
+    p_text = default_allocator(0, len + 1);
+    load_file(p_path, p_text, false);
+    p_text[len] = '\0';
+
+    // parse the file into a json value
+    if ( 0 == json_value_parse(p_text, NULL, &p_value) ) goto failed_to_parse_json;
+
+    // error check
+    if ( JSON_VALUE_OBJECT != p_value->type ) goto wrong_type;
+    if ( 0 == dict_get(p_value->object, "ns_per_op", (void **) &p_result) ) goto wrong_type;
+    if ( JSON_VALUE_OBJECT != p_result->type ) goto wrong_type;
+
+    // compare each case the baseline knows about
+    for (size_t i = 0; i < BENCH_CASE_QTY; i++)
+    {
+
+        // initialized data
+        json_value *p_base = NULL;
+        double base = 0;
+
+        // cases that are new since the baseline are not compared
+        if ( 0 == dict_get(p_result->object, _cases[i].p_name, (void **) &p_base) ) continue;
+
+        // the baseline time
+        if      ( JSON_VALUE_NUMBER  == p_base->type ) base = p_base->number;
+        else if ( JSON_VALUE_INTEGER == p_base->type ) base = (double) p_base->integer;
+        else continue;
+
+        // slower than the threshold allows
+        if ( base > 0 && p_ns[i] > base * ( 1.0 + threshold / 100.0 ) )
+            log_error("[math bench] %s regressed %.1f%% ( %.3f ns -> %.3f ns )\n", _cases[i].p_name, ( p_ns[i] / base - 1.0 ) * 100.0, base, p_ns[i]),
+            regressions++;
+    }
+
+    // clean up
+    json_value_free(p_value, 0);
+    p_text = default_allocator(p_text, 0);
+
+    // done
+    return regressions;
+
+    // error handling
+    {
+
+        // file errors
+        {
+            failed_to_load_file:
+
+                // error
+                return -1;
+        }
+
+        // json errors
+        {
+            wrong_type:
+
+                // release the value
+                json_value_free(p_value, 0);
+
+                // fall through
+                goto failed_to_parse_json;
+
+            failed_to_parse_json:
+
+                // release the text
+                p_text = default_allocator(p_text, 0);
+
+                // error
+                return -1;
+        }
+    }
+}
+
+void print_usage ( const char *argv0 )
+{
+
+    // argument check
+    if ( NULL == argv0 ) exit(EXIT_FAILURE);
+
+    // print a usage message to standard out
+    printf("Usage: %s [ --count elements ] [ --baseline baseline.json ] [ --threshold percent ]\n", argv0);
+
+    // done
+    return;
+}
@@ -0,0 +1,280 @@
+/** !
+ * Schedule test, for the waves of conflicting and reading systems
+ *
+ * @file util/schedule/test.c
+ *
+ * @author Jacob Smith
+ */
+
+// standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+
+// gsdk
+/// core
+#include <core/log.h>
+
+/// reflection
+#include <reflection/json.h>
+
+// g10
+#include <g10.h>
+#include <schedule.h>
+
+// forward declarations
+/** !
+ * Print a usage message to standard out
+ *
+ * @param argv0 the name of the program
+ *
+ * @return void
+ */
+void print_usage ( const char *argv0 );
+
+/** !
+ * Record the result of a check, and print it if it failed
+ *
+ * @param ok     the result
+ * @param p_what what was checked
+ *
+ * @return ok
+ */
+bool test_check ( bool ok, const char *p_what );
+
+/** !
+ * Check the waves of a schedule with read after write, write after read,
+ * and write after write conflicts, and of two systems that only read
+ *
+ * @param p_instance the instance
+ *
+ * @return void
+ */
+void test_waves ( g_instance *p_instance );
+
+/** !
+ * Check that systems that read the transforms or the bounds run after render
+ *
+ * @param p_instance the instance
+ *
+ * @return void
+ */
+void test_render ( g_instance *p_instance );
+
+/** !
+ * Count a run of a test system
+ *
+ * @param p_instance the instance
+ *
+ * @return 1
+ */
+int test_system ( g_instance *p_instance );
+
+// data
+static size_t checks = 0, failures = 0;
+static atomic_size_t runs = 0;
+
+// entry point
+int main ( int argc, const char *argv[] )
+{
+
+    // initialized data
+    g_instance *p_instance = NULL;
+    const char *p_instance_path = ( argc > 1 ) ? argv[1] : "assets/headless.json";
+
+    // error check
+    if ( argc > 2 ) goto invalid_arguments;
+
+    // initialize g10
+    if ( 0 == g_init(&p_instance, p_instance_path) ) goto failed_to_initialize_g10;
+
+    // error check
+    if ( G10_BACKEND_NULL != p_instance->backend ) goto not_headless;
+
+    // the test systems
+    schedule_system_register("write"    , test_system, 0                  , SCHEDULE_TRANSFORMS, 0);
+    schedule_system_register("read"     , test_system, SCHEDULE_TRANSFORMS, 0                  , 0);
+    schedule_system_register("read too" , test_system, SCHEDULE_TRANSFORMS, 0                  , 0);
+    schedule_system_register("overwrite", test_system, 0                  , SCHEDULE_TRANSFORMS, 0);
+    schedule_system_register("camera"   , test_system, 0                  , SCHEDULE_CAMERA    , 0);
+    schedule_system_register("recamera" , test_system, 0                  , SCHEDULE_CAMERA    , 0);
+    schedule_system_register("bounds"   , test_system, SCHEDULE_BOUNDS    , 0                  , 0);
+
+    // run the tests
+    test_waves(p_instance);
+    test_render(p_instance);
+
+    // summary
+    printf("schedule test: %zu of %zu checks passed\n", checks - failures, checks);
+
+    // done
+    return ( failures ) ? EXIT_FAILURE : EXIT_SUCCESS;
+
+    // error handling
+    {
+
+        // argument errors
+        {
+            invalid_arguments:
+
+                // print a usage message to standard out
+                print_usage(argv[0]);
+
+                // error
+                return EXIT_FAILURE;
+        }
+
+        // g10 errors
+        {
+            failed_to_initialize_g10:
+
+                // log the error
+                log_error("Error: Failed to initialize g10!\n");
+
+                // error
+                return EXIT_FAILURE;
+
+            not_headless:
+
+                // log the error
+                log_error("Error: \"%s\" does not select the null backend!\n", p_instance_path);
+
+                // error
+                return EXIT_FAILURE;
+        }
+    }
+}
+
+bool test_check ( bool ok, const char *p_what )
+{
+
+    // count the check
+    checks++;
+
+    // report a failure
+    if ( false == ok )
+        failures++,
+        log_error("[schedule test] FAIL: %s\n", p_what);
+
+    // done
+    return ok;
+}
+
+int test_system ( g_instance *p_instance )
+{
+
+    // unused
+    (void) p_instance;
+
+    // count the run
+    atomic_fetch_add_explicit(&runs, 1, memory_order_relaxed);
+
+    // success
+    return 1;
+}
+
+/** !
+ * Construct a schedule from json text, and run it once to place its systems
+ *
+ * @param pp_schedule return
+ * @param p_instance  the instance
+ * @param p_text      the json array of systems
+ *
+ * @return 1 on success, 0 on error
+ */
+static int test_schedule ( schedule **pp_schedule, g_instance *p_instance, char *p_text )
+{
+
+    // initialized data
+    json_value *p_value = NULL;
+    int result = 0;
+
+    // parse the systems
+    if ( false == test_check(json_value_parse(p_text, NULL, &p_value), "parse the schedule") ) return 0;
+
+    // construct the schedule, and run it
+    result = test_check(schedule_from_json(pp_schedule, p_value), "construct the schedule") &&
+             test_check(schedule_run(*pp_schedule, p_instance)  , "run the schedule");
+
+    // clean up
+    json_value_free(p_value, 0);
+
+    // done
+    return result;
+}
+
+void test_waves ( g_instance *p_instance )
+{
+
+    // initialized data
+    schedule *p_schedule = NULL;
+    char _text[] = "[ \"write\", \"read\", \"read too\", \"overwrite\", \"camera\", \"recamera\" ]";
+    const schedule_entry *p_entries = NULL;
+
+    // construct and run the schedule
+    atomic_store(&runs, 0);
+    if ( false == test_schedule(&p_schedule, p_instance, _text) ) return;
+
+    p_entries = p_schedule->_entries;
+
+    // every system ran once
+    test_check(6 == atomic_load(&runs), "every system runs once");
+
+    // the waves
+    test_check(0 == p_entries[0].wave                     , "the first writer runs in the first wave");
+    test_check(p_entries[1].wave > p_entries[0].wave      , "a read after a write runs in a later wave");
+    test_check(p_entries[2].wave == p_entries[1].wave     , "two systems that only read run in the same wave");
+    test_check(p_entries[3].wave > p_entries[1].wave &&
+               p_entries[3].wave > p_entries[2].wave      , "a write after a read runs in a later wave");
+    test_check(p_entries[3].wave > p_entries[0].wave      , "a write after a write runs in a later wave");
+    test_check(0 == p_entries[4].wave                     , "a system without conflicts runs in the first wave");
+    test_check(p_entries[5].wave > p_entries[4].wave      , "a second writer of other data runs in a later wave");
+    test_check(3 == p_schedule->waves                     , "the schedule has three waves");
+
+    // clean up
+    schedule_destroy(&p_schedule);
+
+    // done
+    return;
+}
+
+void test_render ( g_instance *p_instance )
+{
+
+    // initialized data
+    schedule *p_schedule = NULL;
+    char _text[] = "[ \"render\", \"read\", \"bounds\" ]";
+    const schedule_entry *p_entries = NULL;
+
+    // construct and run the schedule
+    if ( false == test_schedule(&p_schedule, p_instance, _text) ) return;
+
+    p_entries = p_schedule->_entries;
+
+    // render updates the world matrices, and refits the bounds
+    test_check(p_entries[0].writes & SCHEDULE_TRANSFORMS, "render writes the transforms");
+    test_check(p_entries[0].writes & SCHEDULE_BOUNDS    , "render writes the bounds");
+    test_check(p_entries[1].wave > p_entries[0].wave    , "a transform reader runs after render");
+    test_check(p_entries[2].wave > p_entries[0].wave    , "a bounds reader runs after render");
+
+    // clean up
+    schedule_destroy(&p_schedule);
+
+    // done
+    return;
+}
+
+void print_usage ( const char *argv0 )
+{
+
+    // argument check
+    if ( NULL == argv0 ) exit(EXIT_FAILURE);
+
+    // print a usage message to standard out
+    printf("Usage: %s [ instance ]\n", argv0);
+    printf("    instance  an instance with \"backend\" : \"null\", assets/headless.json by default\n");
+
+    // done
+    return;
+}
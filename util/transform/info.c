@@ -1,8 +1,8 @@
-/** ! 
+/** !
  * Transform info
- * 
+ *
  * @file util/transform/info.c
- * 
+ *
  * @author Jacob Smith
  */
 
@@ -11,7 +11,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <limits.h>
+#include <float.h>
 #include <time.h>
+#include <sys/mman.h>
 
 // gsdk
 /// core
@@ -25,64 +27,217 @@
 #include <reflection/json.h>
 
 // g10
+#include <g10.h>
+
 /// world
 #include <transform.h>
 
+// preprocessor definitions
+#define READ_SIZE     ( 1 << 20 )
+#define STREAM_RECORDS 65536
+
 // forward declarations
 /** !
  * Print a usage message to standard out
- * 
+ *
  * @param argv0 the name of the program
- * 
+ *
  * @return void
  */
 void print_usage ( const char *argv0 );
 
 /** !
  * Parse command line arguments
- * 
+ *
  * @param argc the argc parameter of the entry point
  * @param argv the argv parameter of the entry point
- * 
+ *
  * @return void on success, program abort on failure
  */
 void parse_command_line_arguments ( int argc, const char *argv[] );
 
+/** !
+ * Filter and summarise a block of records
+ *
+ * @param p_records the records
+ * @param count     the quantity of records
+ * @param base      the index of the first record in the stream
+ *
+ * @return void
+ */
+void scan_records ( const transform_record *p_records, size_t count, size_t base );
+
+/** !
+ * Print the summary of a stream to standard out
+ *
+ * @return void
+ */
+void print_summary ( void );
+
 // data
-bool binary = false;
-char *p_data = NULL;
-size_t buffer_len = 4096;
-size_t bytes_read = 0;
+enum { INPUT_JSON, INPUT_BINARY, INPUT_STREAM } format = INPUT_JSON;
+const char *p_path = NULL;
+bool print_records = false,
+     roots_only    = false,
+     within        = false;
+f32 within_min[3] = { 0 },
+    within_max[3] = { 0 };
+
+struct
+{
+    size_t records, matched, roots;
+    f32    location_min[3], location_max[3],
+           scale_min[3],    scale_max[3];
+    f64    location_sum[3];
+} summary =
+{
+    .location_min = {  FLT_MAX,  FLT_MAX,  FLT_MAX },
+    .location_max = { -FLT_MAX, -FLT_MAX, -FLT_MAX },
+    .scale_min    = {  FLT_MAX,  FLT_MAX,  FLT_MAX },
+    .scale_max    = { -FLT_MAX, -FLT_MAX, -FLT_MAX }
+};
 
 // entry point
 int main ( int argc, const char *argv[] )
 {
-    
+
     // initialized data
     transform *p_transform = NULL;
+    FILE *p_file = stdin;
+    char *p_data = NULL;
+    size_t buffer_len = READ_SIZE,
+           bytes_read = 0;
 
     // parse command line arguments
     parse_command_line_arguments(argc, argv);
 
+    // record stream
+    if ( format == INPUT_STREAM )
+    {
+
+        // map the file, and scan the records in place
+        if ( p_path )
+        {
+
+            // initialized data
+            size_t size = 0, count = 0;
+            const void *p_map = map_file(p_path, &size);
+            const transform_record *p_records = NULL;
+
+            // error check
+            if ( p_map == NULL ) goto failed_to_open_file;
+
+            // the records are read once, front to back
+            posix_madvise((void *) p_map, size, POSIX_MADV_SEQUENTIAL);
+
+            // validate the header
+            p_records = transform_stream_records(p_map, size, &count);
+
+            // error check
+            if ( p_records == NULL ) goto invalid_stream;
+
+            // scan
+            scan_records(p_records, count, 0);
+
+            // release the mapping
+            unmap_file(p_map, size);
+        }
+
+        // read blocks of records from standard in
+        else
+        {
+
+            // initialized data
+            transform_stream_header _header = { 0 };
+            size_t remaining = 0;
+            transform_record *p_records = NULL;
+
+            // read the header
+            if ( fread(&_header, sizeof(transform_stream_header), 1, stdin) != 1 ) goto invalid_stream;
+            if ( _header.magic       != TRANSFORM_STREAM_MAGIC          ||
+                 _header.version     != TRANSFORM_STREAM_VERSION        ||
+                 _header.header_size != sizeof(transform_stream_header) ||
+                 _header.record_size != sizeof(transform_record)        ) goto invalid_stream;
+
+            // allocate memory
+            p_records = default_allocator(0, STREAM_RECORDS * sizeof(transform_record));
+
+            // error check
+            if ( p_records == NULL ) goto no_mem;
+
+            // scan each block
+            for (remaining = (size_t) _header.count; remaining; )
+            {
+
+                // initialized data
+                size_t want = ( remaining < STREAM_RECORDS ) ? remaining : STREAM_RECORDS,
+                       got  = fread(p_records, sizeof(transform_record), want, stdin);
+
+                // scan
+                scan_records(p_records, got, (size_t) _header.count - remaining);
+
+                remaining -= got;
+
+                // truncated
+                if ( got < want ) break;
+            }
+
+            // release the buffer
+            p_records = default_allocator(p_records, 0);
+
+            // error check
+            if ( remaining ) log_warning("Warning: Stream ended %zu records early\n", remaining);
+        }
+
+        // print the summary
+        print_summary();
+
+        // success
+        return EXIT_SUCCESS;
+    }
+
+    // open the file
+    if ( p_path ) p_file = fopen(p_path, "rb");
+
+    // error check
+    if ( p_file == NULL ) goto failed_to_open_file;
+
     // allocate memory
     p_data = default_allocator(0, buffer_len);
 
-    // load the file
-    while ( !feof(stdin) )
+    // error check
+    if ( p_data == NULL ) goto no_mem;
+
+    // load the file, in blocks
+    for (;;)
     {
 
-        if ( buffer_len - bytes_read < 2 )
+        // grow, and keep room for a null terminator
+        if ( buffer_len - bytes_read < READ_SIZE + 1 )
         {
             buffer_len += buffer_len;
             p_data = default_allocator(p_data, buffer_len);
+
+            // error check
+            if ( p_data == NULL ) goto no_mem;
         }
 
-        p_data[bytes_read] = getchar();
-        
-        bytes_read++;
+        // initialized data
+        size_t got = fread(p_data + bytes_read, 1, READ_SIZE, p_file);
+
+        bytes_read += got;
+
+        // done
+        if ( got < READ_SIZE ) break;
     }
 
-    if ( binary )
+    // null terminate
+    p_data[bytes_read] = '\0';
+
+    // close the file
+    if ( p_file != stdin ) fclose(p_file);
+
+    if ( format == INPUT_BINARY )
         transform_unpack(&p_transform, p_data);
     else
     {
@@ -94,13 +249,24 @@ int main ( int argc, const char *argv[] )
     if ( NULL == p_transform ) return EXIT_FAILURE;
 
     transform_info(p_transform);
-    
+
     // success
     return EXIT_SUCCESS;
 
     // error handling
     {
 
+        // g10 errors
+        {
+            invalid_stream:
+
+                // log the error
+                log_error("Error: Input is not a transform stream!\n");
+
+                // error
+                return EXIT_FAILURE;
+        }
+
         // standard library errors
         {
             failed_to_open_file:
@@ -110,8 +276,103 @@ int main ( int argc, const char *argv[] )
 
                 // error
                 return EXIT_FAILURE;
+
+            no_mem:
+
+                // log the error
+                log_error("Error: Out of memory!\n");
+
+                // error
+                return EXIT_FAILURE;
+        }
+    }
+}
+
+void scan_records ( const transform_record *p_records, size_t count, size_t base )
+{
+
+    // iterate through each record
+    for (size_t i = 0; i < count; i++)
+    {
+
+        // initialized data
+        const transform_record *p = &p_records[i];
+        bool root = ( p->parent == TRANSFORM_RECORD_ROOT );
+
+        // count
+        summary.roots += root;
+
+        // filter
+        if ( roots_only && root == false ) continue;
+
+        if ( within )
+        {
+            if ( p->location[0] < within_min[0] || p->location[0] > within_max[0] ) continue;
+            if ( p->location[1] < within_min[1] || p->location[1] > within_max[1] ) continue;
+            if ( p->location[2] < within_min[2] || p->location[2] > within_max[2] ) continue;
+        }
+
+        // accumulate
+        for (size_t j = 0; j < 3; j++)
+        {
+            summary.location_min[j]  = ( p->location[j] < summary.location_min[j] ) ? p->location[j] : summary.location_min[j];
+            summary.location_max[j]  = ( p->location[j] > summary.location_max[j] ) ? p->location[j] : summary.location_max[j];
+            summary.scale_min[j]     = ( p->scale[j]    < summary.scale_min[j]    ) ? p->scale[j]    : summary.scale_min[j];
+            summary.scale_max[j]     = ( p->scale[j]    > summary.scale_max[j]    ) ? p->scale[j]    : summary.scale_max[j];
+            summary.location_sum[j] += p->location[j];
+        }
+
+        summary.matched++;
+
+        // print
+        if ( print_records )
+        {
+            printf("%zu: location ( %g, %g, %g ) orientation ( %g, %g, %g, %g ) scale ( %g, %g, %g ) parent ",
+                base + i,
+                p->location[0], p->location[1], p->location[2],
+                p->orientation[0], p->orientation[1], p->orientation[2], p->orientation[3],
+                p->scale[0], p->scale[1], p->scale[2]
+            );
+
+            if ( root ) printf("none\n");
+            else        printf("%u\n", p->parent);
         }
     }
+
+    // count
+    summary.records += count;
+
+    // done
+    return;
+}
+
+void print_summary ( void )
+{
+
+    // initialized data
+    f64 n = ( summary.matched ) ? (f64) summary.matched : 1.0;
+
+    // counts
+    printf("records : %zu\n", summary.records);
+    printf("matched : %zu\n", summary.matched);
+    printf("roots   : %zu\n", summary.roots);
+
+    // nothing else to report
+    if ( summary.matched == 0 ) return;
+
+    // ranges
+    printf("location: min ( %g, %g, %g ) max ( %g, %g, %g ) mean ( %g, %g, %g )\n",
+        summary.location_min[0], summary.location_min[1], summary.location_min[2],
+        summary.location_max[0], summary.location_max[1], summary.location_max[2],
+        summary.location_sum[0] / n, summary.location_sum[1] / n, summary.location_sum[2] / n
+    );
+    printf("scale   : min ( %g, %g, %g ) max ( %g, %g, %g )\n",
+        summary.scale_min[0], summary.scale_min[1], summary.scale_min[2],
+        summary.scale_max[0], summary.scale_max[1], summary.scale_max[2]
+    );
+
+    // done
+    return;
 }
 
 void print_usage ( const char *argv0 )
@@ -121,7 +382,12 @@ void print_usage ( const char *argv0 )
     if ( NULL == argv0 ) exit(EXIT_FAILURE);
 
     // print a usage message to standard out
-    printf("Usage: %s < --binary | --json >\n", argv0);
+    printf("Usage: %s < --binary | --json | --stream > [ --file path ] [ --roots ] [ --within x0 y0 z0 x1 y1 z1 ] [ --print ]\n", argv0);
+    printf("    --binary, --json  print one transform\n");
+    printf("    --stream          summarise a transform stream. A file is mapped, standard in is read in blocks\n");
+    printf("    --roots           only records without a parent\n");
+    printf("    --within          only records located inside the box\n");
+    printf("    --print           print each matching record\n");
 
     // done
     return;
@@ -133,19 +399,50 @@ void parse_command_line_arguments ( int argc, const char *argv[] )
     // iterate through each command line argument
     for (size_t i = 1; i < (size_t) argc; i++)
     {
-        
+
         // json
         if ( 0 == strcmp(argv[i], "--json") )
-            binary = false;
+            format = INPUT_JSON;
 
         // binary
         else if ( 0 == strcmp(argv[i], "--binary") )
-            binary = true;
+            format = INPUT_BINARY;
+
+        // stream
+        else if ( 0 == strcmp(argv[i], "--stream") )
+            format = INPUT_STREAM;
+
+        // file
+        else if ( 0 == strcmp(argv[i], "--file") )
+        {
+            if ( i + 1 >= (size_t) argc ) goto invalid_arguments;
+
+            p_path = argv[++i];
+        }
+
+        // roots
+        else if ( 0 == strcmp(argv[i], "--roots") )
+            roots_only = true;
+
+        // box
+        else if ( 0 == strcmp(argv[i], "--within") )
+        {
+            if ( i + 6 >= (size_t) argc ) goto invalid_arguments;
+
+            for (size_t j = 0; j < 3; j++) within_min[j] = strtof(argv[++i], NULL);
+            for (size_t j = 0; j < 3; j++) within_max[j] = strtof(argv[++i], NULL);
+
+            within = true;
+        }
+
+        // print
+        else if ( 0 == strcmp(argv[i], "--print") )
+            print_records = true;
 
         // default
         else goto invalid_arguments;
     }
-    
+
     // success
     return;
 
@@ -155,7 +452,7 @@ void parse_command_line_arguments ( int argc, const char *argv[] )
         // argument errors
         {
             invalid_arguments:
-                
+
                 // print a usage message to standard out
                 print_usage(argv[0]);
 
@@ -0,0 +1,471 @@
+/** !
+ * Transform tests, for the world matrices of the hierarchy, blending
+ * between ticks, and record streams
+ *
+ * @file util/transform/test.c
+ *
+ * @author Jacob Smith
+ */
+
+// standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// gsdk
+/// core
+#include <core/log.h>
+
+// g10
+#include <g10.h>
+#include <job.h>
+#include <transform.h>
+
+// preprocessor definitions
+#define TEST_COUNT 5000
+
+// forward declarations
+/** !
+ * Record the result of a check, and print it if it failed
+ *
+ * @param ok     the result
+ * @param p_what what was checked
+ *
+ * @return ok
+ */
+bool test_check ( bool ok, const char *p_what );
+
+/** !
+ * Check that reading a world matrix leaves the cache alone, and that the
+ * hierarchy update rebuilds it
+ *
+ * @return void
+ */
+void test_world_read_only ( void );
+
+/** !
+ * Check the world matrices of a hierarchy blended between two ticks against
+ * the blended states
+ *
+ * @return void
+ */
+void test_interpolate ( void );
+
+/** !
+ * Check that a stream written out of order keeps its parents, and that
+ * cycles and missing parents are read as roots
+ *
+ * @return void
+ */
+void test_stream ( void );
+
+/** !
+ * Check the world matrices of a large hierarchy, updated across the worker
+ * threads, against its parent chains. The hierarchy has one subtree larger
+ * than a range, and many roots that share ranges
+ *
+ * @return void
+ */
+void test_hierarchy_world ( void );
+
+// data
+static size_t checks = 0, failures = 0;
+
+// entry point
+int main ( int argc, const char *argv[] )
+{
+
+    // unused
+    (void) argc, (void) argv;
+
+    // run the tests
+    test_world_read_only();
+    test_interpolate();
+    test_stream();
+    test_hierarchy_world();
+
+    // summary
+    printf("transform test: %zu of %zu checks passed\n", checks - failures, checks);
+
+    // clean up
+    job_quit();
+
+    // done
+    return ( failures ) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+bool test_check ( bool ok, const char *p_what )
+{
+
+    // count the check
+    checks++;
+
+    // report a failure
+    if ( false == ok )
+        failures++,
+        log_error("[transform test] FAIL: %s\n", p_what);
+
+    // done
+    return ok;
+}
+
+/** !
+ * Get the largest difference between two matrices, relative to the first
+ *
+ * @param a the expected matrix
+ * @param b the matrix
+ *
+ * @return the difference
+ */
+static float test_difference ( mat4 a, mat4 b )
+{
+
+    // initialized data
+    const float *p_a = &a.a, *p_b = &b.a;
+    float worst = 0.f;
+
+    for (size_t i = 0; i < 16; i++)
+    {
+
+        // initialized data
+        float d = fabsf(p_a[i] - p_b[i]) / ( 1.f + fabsf(p_a[i]) );
+
+        if ( d > worst ) worst = d;
+    }
+
+    // done
+    return worst;
+}
+
+void test_world_read_only ( void )
+{
+
+    // initialized data
+    transform *p_parent = NULL,
+              *p_child  = NULL;
+    transform_hierarchy *p_hierarchy = NULL;
+    mat4 cached = { 0 }, world = { 0 }, expected = { 0 };
+
+    // a parent and child
+    if ( false == test_check(transform_hierarchy_construct(&p_hierarchy), "construct a hierarchy") ) return;
+
+    transform_construct(&p_parent, (vec3) { 1.f, 2.f, 3.f }, (vec3) { 0.f, 90.f, 0.f }, (vec3) { 2.f, 2.f, 2.f }, NULL);
+    transform_construct(&p_child , (vec3) { 1.f, 0.f, 0.f }, (vec3) { 45.f, 0.f, 0.f }, (vec3) { 1.f, 1.f, 1.f }, p_parent);
+
+    test_check(transform_hierarchy_add(p_hierarchy, p_child), "add the child, and its parent");
+    test_check(2 == transform_hierarchy_update(p_hierarchy), "the update builds both world matrices");
+
+    // the cache is current
+    mat4_mul_mat4(&expected, p_parent->model, p_child->model);
+    transform_get_matrix_world(p_child, &world);
+    test_check(test_difference(expected, world) < 1e-5f, "a current cache is returned");
+
+    // move the parent, and read the child before the update
+    cached = p_child->world;
+    transform_set_location(p_parent, (vec3) { -4.f, 0.f, 1.f });
+    mat4_mul_mat4(&expected, p_parent->model, p_child->model);
+    transform_get_matrix_world(p_child, &world);
+
+    test_check(test_difference(expected, world) < 1e-5f, "a stale cache is bypassed");
+    test_check(0 == memcmp(&cached, &p_child->world, sizeof(mat4)), "reading a world matrix does not write the cache");
+
+    // the update rebuilds the cache
+    test_check(2 == transform_hierarchy_update(p_hierarchy), "the update rebuilds the moved subtree");
+    test_check(test_difference(expected, p_child->world) < 1e-5f, "the update writes the cache");
+
+    // clean up
+    transform_hierarchy_destroy(&p_hierarchy);
+    transform_destroy(&p_child);
+    transform_destroy(&p_parent);
+
+    // done
+    return;
+}
+
+void test_interpolate ( void )
+{
+
+    // initialized data
+    transform *p_parent = NULL,
+              *p_child  = NULL;
+    transform_hierarchy *p_hierarchy = NULL;
+    quaternion q0 = { 0 }, q1 = { 0 }, q = { 0 };
+    vec3 l0 = { 1.f, 2.f, 3.f }, l1 = { 5.f, -2.f, 0.f },
+         s0 = { 1.f, 1.f, 1.f }, s1 = { 2.f, 3.f, 0.5f };
+    mat4 parent = { 0 }, expected = { 0 }, current = { 0 };
+
+    // a parent and child
+    if ( false == test_check(transform_hierarchy_construct(&p_hierarchy), "construct a hierarchy") ) return;
+
+    transform_construct(&p_parent, l0, (vec3) { 0.f, 30.f, 0.f }, s0, NULL);
+    transform_construct(&p_child , (vec3) { 1.f, 0.f, 0.f }, (vec3) { 45.f, 0.f, 0.f }, (vec3) { 1.f, 1.f, 1.f }, p_parent);
+    transform_hierarchy_add(p_hierarchy, p_child);
+
+    // the first tick, still
+    test_check(transform_hierarchy_tick(p_hierarchy), "start a tick");
+    transform_hierarchy_update(p_hierarchy);
+    q0 = p_parent->orientation;
+
+    // the next tick moves the parent
+    test_check(transform_hierarchy_tick(p_hierarchy), "start a tick");
+    quaternion_from_euler(&q1, (vec3) { 20.f, 120.f, -40.f });
+    transform_set_location(p_parent, (vec3) { 0.f, 0.f, 0.f });
+    transform_set_location(p_parent, l1);
+    transform_set_rotation(p_parent, q1);
+    transform_set_scale(p_parent, s1);
+    test_check(p_parent->moving && false == p_child->moving, "only the parent moved");
+
+    // the current world matrix
+    mat4_model_from_quaternion(&parent, l1, q1, s1);
+    mat4_mul_mat4(&current, parent, p_child->model);
+
+    // between the ticks
+    for (size_t i = 0; i <= 4; i++)
+    {
+
+        // initialized data
+        float t = (float) i / 4.f;
+        char _what[128] = { 0 };
+
+        // the blend. halfway, the normalized lerp is the spherical lerp
+        if ( i == 2 ) quaternion_slerp(&q, q0, q1, t);
+        else          quaternion_nlerp(&q, q0, q1, t);
+
+        mat4_model_from_quaternion(&parent, (vec3) { l0.x + ( l1.x - l0.x ) * t, l0.y + ( l1.y - l0.y ) * t, l0.z + ( l1.z - l0.z ) * t }, q, (vec3) { s0.x + ( s1.x - s0.x ) * t, s0.y + ( s1.y - s0.y ) * t, s0.z + ( s1.z - s0.z ) * t });
+        mat4_mul_mat4(&expected, parent, p_child->model);
+
+        // interpolate, and rebuild the world matrices
+        test_check(transform_hierarchy_interpolate(p_hierarchy, t), "interpolate the hierarchy");
+        test_check(2 == transform_hierarchy_update(p_hierarchy), "the update rebuilds the blended subtree");
+
+        snprintf(_what, sizeof(_what), "the child follows the parent blended at %.2f", (double) t);
+        test_check(test_difference(expected, p_child->world) < 1e-5f, _what);
+    }
+
+    // the state is not blended
+    test_check(0 == memcmp(&l1, &p_parent->location, sizeof(vec3)) && 0 == memcmp(&q1, &p_parent->orientation, sizeof(quaternion)), "interpolating does not change the state");
+
+    // the next tick restores the current matrices, and a still transform is not blended
+    test_check(transform_hierarchy_tick(p_hierarchy), "start a tick");
+    test_check(false == p_parent->moving, "the tick settles the parent");
+    test_check(transform_hierarchy_interpolate(p_hierarchy, 0.f), "interpolate the hierarchy");
+    transform_hierarchy_update(p_hierarchy);
+    test_check(test_difference(current, p_child->world) < 1e-5f, "a still transform is at its current state");
+
+    // a tick moves the parent, then a change after the interpolation teleports it
+    test_check(transform_hierarchy_tick(p_hierarchy), "start a tick");
+    transform_set_location(p_parent, l0);
+    test_check(transform_hierarchy_interpolate(p_hierarchy, 0.5f), "interpolate the hierarchy");
+    transform_set_location(p_parent, (vec3) { 9.f, 9.f, 9.f });
+    test_check(false == p_parent->moving, "a change outside a tick is not blended");
+
+    // the next frame runs no tick, and the teleport snaps
+    test_check(transform_hierarchy_interpolate(p_hierarchy, 0.75f), "interpolate the hierarchy");
+    transform_hierarchy_update(p_hierarchy);
+    mat4_model_from_quaternion(&parent, (vec3) { 9.f, 9.f, 9.f }, q1, s1);
+    mat4_mul_mat4(&expected, parent, p_child->model);
+    test_check(test_difference(expected, p_child->world) < 1e-5f, "a change outside a tick snaps");
+
+    // clean up
+    transform_hierarchy_destroy(&p_hierarchy);
+    transform_destroy(&p_child);
+    transform_destroy(&p_parent);
+
+    // done
+    return;
+}
+
+void test_stream ( void )
+{
+
+    // initialized data
+    transform *p_root = NULL,
+              *p_a    = NULL,
+              *p_b    = NULL;
+    transform _read[3] = { 0 };
+    transform_record _records[4] = { 0 };
+    const transform_record *p_records = NULL;
+    size_t size = 0, count = 0;
+    void *p_buffer = NULL;
+    mat4 expected = { 0 }, world = { 0 };
+
+    // a chain of 3, written children first
+    transform_construct(&p_root, (vec3) { 1.f, 2.f, 3.f }, (vec3) { 0.f, 30.f, 0.f }, (vec3) { 2.f, 2.f, 2.f }, NULL);
+    transform_construct(&p_a   , (vec3) { 0.f, 1.f, 0.f }, (vec3) { 10.f, 0.f, 0.f }, (vec3) { 1.f, 1.f, 1.f }, p_root);
+    transform_construct(&p_b   , (vec3) { 0.f, 0.f, 4.f }, (vec3) { 0.f, 0.f, 60.f }, (vec3) { 1.f, 1.f, 1.f }, p_a);
+
+    {
+
+        // initialized data
+        transform *const _written[3] = { p_b, p_a, p_root };
+
+        size     = transform_pack_many(NULL, _written, 3),
+        p_buffer = default_allocator(0, size);
+
+        if ( false == test_check(p_buffer && size == transform_pack_many(p_buffer, _written, 3), "write a stream out of order") ) goto done;
+    }
+
+    // read it back
+    p_records = transform_stream_records(p_buffer, size, &count);
+    test_check(p_records && 3 == count, "read the records");
+    test_check(3 == transform_unpack_many(_read, p_records, count), "unpack the records");
+    test_check(_read[0].p_parent == &_read[1] && _read[1].p_parent == &_read[2] && _read[2].p_parent == NULL, "parents that follow their children are kept");
+
+    // the chain is intact
+    mat4_mul_mat4(&expected, p_root->model, p_a->model);
+    mat4_mul_mat4(&expected, expected, p_b->model);
+    transform_get_matrix_world(&_read[0], &world);
+    test_check(test_difference(expected, world) < 1e-5f, "the read chain has the written world matrix");
+
+    // 0 -> 1 -> 2 -> 0 is a cycle, and 3 has a parent outside the stream
+    for (size_t i = 0; i < 4; i++)
+        _records[i] = (transform_record) { .orientation = { 1.f, 0.f, 0.f, 0.f }, .scale = { 1.f, 1.f, 1.f }, .parent = (u32) ( i + 1 ) % 3 };
+
+    _records[3].parent = 7;
+
+    {
+
+        // initialized data
+        transform _cycle[4] = { 0 };
+        size_t roots = 0;
+
+        test_check(4 == transform_unpack_many(_cycle, _records, 4), "unpack a cycle");
+
+        for (size_t i = 0; i < 4; i++)
+        {
+
+            // initialized data
+            size_t steps = 0;
+
+            // every chain ends at a root
+            for (transform *p = &_cycle[i]; p && steps <= 4; p = p->p_parent) steps++;
+
+            test_check(steps <= 4, "a cycle is broken");
+            test_check(0 == _cycle[i]._index, "the marks are cleared");
+
+            roots += ( _cycle[i].p_parent == NULL );
+        }
+
+        test_check(2 == roots, "one link of the cycle, and the missing parent, are dropped");
+    }
+
+    done:
+
+    // clean up
+    p_buffer = default_allocator(p_buffer, 0);
+    transform_destroy(&p_b);
+    transform_destroy(&p_a);
+    transform_destroy(&p_root);
+
+    // done
+    return;
+}
+
+/** !
+ * Compute the expected world matrices of the nested half of the hierarchy
+ * of test_hierarchy_world
+ *
+ * @param pp_transforms the transforms
+ * @param p_expected    return
+ *
+ * @return void
+ */
+static void test_hierarchy_expected ( transform **pp_transforms, mat4 *p_expected )
+{
+
+    // the last chain is the root, so walk from it back to the first
+    for (size_t c = ( TEST_COUNT - 1 ) / 4 + 1; c-- > 0; )
+        for (size_t i = c * 4; i < c * 4 + 4 && i < TEST_COUNT; i++)
+
+            // the head of a chain hangs off the head of the next one
+            if      ( i % 4 == 0 && i + 4 < TEST_COUNT ) mat4_mul_mat4(&p_expected[i], p_expected[i + 4], pp_transforms[i]->model);
+            else if ( i % 4 )                            mat4_mul_mat4(&p_expected[i], p_expected[i - 1], pp_transforms[i]->model);
+            else                                         p_expected[i] = pp_transforms[i]->model;
+
+    // done
+    return;
+}
+
+void test_hierarchy_world ( void )
+{
+
+    // initialized data
+    transform_hierarchy *p_hierarchy = NULL;
+    transform **pp_transforms = default_allocator(0, 2 * TEST_COUNT * sizeof(transform *));
+    mat4 *p_expected = default_allocator(0, TEST_COUNT * sizeof(mat4));
+    size_t moved = 0;
+    float worst = 0.f;
+
+    // error check
+    if ( false == test_check(pp_transforms && p_expected, "allocate the test arrays") ) goto done;
+
+    memset(pp_transforms, 0, 2 * TEST_COUNT * sizeof(transform *));
+
+    if ( false == test_check(transform_hierarchy_construct(&p_hierarchy), "construct a hierarchy") ) goto done;
+
+    // chains of 4, then as many roots
+    for (size_t i = 0; i < 2 * TEST_COUNT; i++)
+    {
+
+        // initialized data
+        transform *p_parent = ( i < TEST_COUNT && i % 4 ) ? pp_transforms[i - 1] : NULL;
+
+        if ( false == test_check(transform_construct(&pp_transforms[i], (vec3) { (float) i * 0.01f, 1.f, 2.f }, (vec3) { (float) ( i % 360 ), (float) ( i * 7 % 360 ), (float) ( i * 3 % 360 ) }, (vec3) { 1.f, 1.5f, 0.5f }, p_parent), "construct a transform") ) goto done;
+    }
+
+    // the head of each chain becomes a child of the head of the next chain, 
+    // so the chains are one subtree, larger than a range
+    for (size_t i = 0; i + 4 < TEST_COUNT; i += 4)
+        test_check(transform_set_parent(pp_transforms[i], pp_transforms[i + 4]), "reparent under a later transform");
+
+    for (size_t i = 0; i < 2 * TEST_COUNT; i++)
+        test_check(transform_hierarchy_add(p_hierarchy, pp_transforms[i]), "add a transform");
+
+    // the first update builds every world matrix
+    test_check(2 * TEST_COUNT == transform_hierarchy_update(p_hierarchy), "the update builds every world matrix");
+
+    // move the root of the chains, and every third root
+    transform_set_location(pp_transforms[( TEST_COUNT - 1 ) / 4 * 4], (vec3) { -3.f, 2.f, 1.f });
+
+    for (size_t i = TEST_COUNT; i < 2 * TEST_COUNT; i += 3)
+        transform_set_scale(pp_transforms[i], (vec3) { 2.f, 2.f, 2.f }),
+        moved++;
+
+    test_check(TEST_COUNT + moved == transform_hierarchy_update(p_hierarchy), "the update rebuilds the moved subtrees");
+
+    // the chains follow their parents
+    test_hierarchy_expected(pp_transforms, p_expected);
+
+    for (size_t i = 0; i < TEST_COUNT; i++)
+    {
+
+        // initialized data
+        float d = test_difference(p_expected[i], pp_transforms[i]->world);
+
+        if ( d > worst ) worst = d;
+    }
+
+    test_check(worst < 1e-3f, "world matrices follow the parent chains");
+
+    // the roots are their model matrices
+    for (size_t i = TEST_COUNT; i < 2 * TEST_COUNT; i++)
+        if ( false == test_check(0 == memcmp(&pp_transforms[i]->model, &pp_transforms[i]->world, sizeof(mat4)), "a root is its model matrix") ) break;
+
+    // everything is clean
+    test_check(0 == transform_hierarchy_update(p_hierarchy), "a clean hierarchy updates nothing");
+
+    done:
+
+    // clean up
+    transform_hierarchy_destroy(&p_hierarchy);
+
+    if ( pp_transforms )
+        for (size_t i = 0; i < 2 * TEST_COUNT; i++) transform_destroy(&pp_transforms[i]);
+
+    pp_transforms = default_allocator(pp_transforms, 0),
+    p_expected    = default_allocator(p_expected, 0);
+
+    // done
+    return;
+}